@@ -0,0 +1,332 @@
+// History log codec: an exact round trip of the cases the Gorilla style
+// encoding has to get right, then encode and decode throughput on a
+// typical commit. Every decoded sample must match its original bit for
+// bit, values compared as IEEE 754 bits so NaN payloads and -0.0 count;
+// any mismatch is reported and the bench exits non-zero.
+//
+// Usage: history_codec_bench [commits]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "history_codec.h"
+
+#define BENCH_LOG_SIZE 2048         // HISTORY_LOG_MAX of historian.c
+#define BENCH_MAX_SAMPLES HISTORY_STAGE_COUNT
+#define BENCH_RAW_SAMPLE 21         // HISTORY_RAW_SAMPLE of historian.c
+#define BENCH_BASE_MS 1700000000000ULL
+
+static history_sample_t g_in[BENCH_MAX_SAMPLES];
+static history_sample_t g_out[BENCH_MAX_SAMPLES];
+static int g_out_count;
+static uint8_t g_log[BENCH_LOG_SIZE];
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t bits_of(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static double value_of(uint64_t bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static void collect(const history_sample_t *s, void *arg) {
+    (void)arg;
+    if (g_out_count < BENCH_MAX_SAMPLES) {
+        g_out[g_out_count] = *s;
+    }
+    g_out_count++;
+}
+
+static bool same_sample(const history_sample_t *a, const history_sample_t *b) {
+    return a->key == b->key && a->quality == b->quality &&
+           a->time_ms == b->time_ms && bits_of(a->value) == bits_of(b->value);
+}
+
+// Encode samples into as many logs as the historian would, decode each
+// and compare. *bytes gets the encoded size.
+static bool round_trip(const char *name, const history_sample_t *samples, int count,
+                       uint64_t base_ms, size_t *bytes) {
+    int done = 0;
+
+    *bytes = 0;
+    while (done < count) {
+        size_t len;
+        int n = history_encode_log(g_log, sizeof(g_log), base_ms, samples + done,
+                                   count - done, &len);
+        if (n <= 0 || len > sizeof(g_log)) {
+            printf("%-14s encoded %d samples in %lu bytes\n", name, n, (unsigned long)len);
+            return false;
+        }
+
+        g_out_count = 0;
+        if (!history_decode_log(g_log, len, collect, NULL) || g_out_count != n) {
+            printf("%-14s decoded %d of %d samples\n", name, g_out_count, n);
+            return false;
+        }
+        for (int i = 0; i < n; i++) {
+            const history_sample_t *a = &samples[done + i];
+            const history_sample_t *b = &g_out[i];
+            if (!same_sample(a, b)) {
+                printf("%-14s sample %d: key %08x q %u t %llu v %016llx, got key %08x q %u t %llu v %016llx\n",
+                       name, done + i, a->key, a->quality, (unsigned long long)a->time_ms,
+                       (unsigned long long)bits_of(a->value), b->key, b->quality,
+                       (unsigned long long)b->time_ms, (unsigned long long)bits_of(b->value));
+                return false;
+            }
+        }
+        done += n;
+        *bytes += len;
+    }
+    return true;
+}
+
+static bool check(const char *name, const history_sample_t *samples, int count, uint64_t base_ms) {
+    size_t bytes;
+    bool ok = round_trip(name, samples, count, base_ms, &bytes);
+    if (ok) {
+        printf("%-14s %5d samples %6lu bytes  ok\n", name, count, (unsigned long)bytes);
+    }
+    return ok;
+}
+
+static history_sample_t sample(uint32_t key, uint64_t time_ms, double value, uint8_t quality) {
+    history_sample_t s = { .key = key, .quality = quality, .time_ms = time_ms, .value = value };
+    return s;
+}
+
+// A flat signal: every value after the first is the 1 bit '0'
+static bool check_equal_values(void) {
+    int n = 0;
+    for (int i = 0; i < 200; i++) {
+        g_in[n++] = sample(1, BENCH_BASE_MS + i * 1000, 21.5, 1);
+    }
+    return check("equal", g_in, n, BENCH_BASE_MS);
+}
+
+// Values whose bits the XOR coding must carry unchanged
+static bool check_special_values(void) {
+    static const uint64_t bits[] = {
+        0x0000000000000000ULL,      // 0.0
+        0x8000000000000000ULL,      // -0.0
+        0x7ff8000000000000ULL,      // Quiet NaN
+        0x7ff8000000000000ULL,      // The same NaN again
+        0x7ff0000000000001ULL,      // Signaling NaN with a payload
+        0xfff8000000000000ULL,      // Negative NaN
+        0x7ff0000000000000ULL,      // +inf
+        0xfff0000000000000ULL,      // -inf
+        0xfff0000000000000ULL,      // -inf again
+        0x0000000000000001ULL,      // Smallest subnormal
+        0x0010000000000000ULL,      // DBL_MIN
+        0x7fefffffffffffffULL,      // DBL_MAX
+        0xffefffffffffffffULL,      // -DBL_MAX
+        0x7ff0000000000000ULL,      // +inf
+    };
+    int count = sizeof(bits) / sizeof(bits[0]);
+    int n = 0;
+
+    // Each as the start of a node and as a continuation
+    for (int i = 0; i < count; i++) {
+        g_in[n++] = sample(2, BENCH_BASE_MS + i * 1000, value_of(bits[i]), 1);
+    }
+    for (int i = 0; i < count; i++) {
+        g_in[n++] = sample(3 + i, BENCH_BASE_MS, value_of(bits[i]), 1);
+    }
+    return check("special", g_in, n, BENCH_BASE_MS);
+}
+
+// Deltas of delta on both edges of every class, then past them
+static bool check_time_deltas(void) {
+    static const int64_t deltas[] = {
+        1000, 1000,                 // dod 0
+        1064, 1001,                 // 64, -63: the 7 bit class
+        1066, 1322, 1067,           // 65, 256, -255: 9 bits
+        3115, 1068,                 // 2048, -2047: 12 bits
+        3117, 1068,                 // 2049, -2049: the u32 delta itself
+        0, 0,                       // Two samples at the same time
+        5000000, 1,                 // Far apart
+    };
+    int count = sizeof(deltas) / sizeof(deltas[0]);
+    uint64_t time_ms = BENCH_BASE_MS;
+    int n = 0;
+
+    g_in[n++] = sample(1, time_ms, 1.0, 1);
+    for (int i = 0; i < count; i++) {
+        time_ms += deltas[i];
+        g_in[n++] = sample(1, time_ms, 1.0 + i, 1);
+    }
+    // The widest times one log holds: a delta and a start at 2^32 - 1 ms
+    g_in[n++] = sample(2, BENCH_BASE_MS, 0.0, 1);
+    g_in[n++] = sample(2, BENCH_BASE_MS + UINT32_MAX, 0.0, 1);
+    g_in[n++] = sample(3, BENCH_BASE_MS + UINT32_MAX, 0.0, 1);
+    return check("time deltas", g_in, n, BENCH_BASE_MS);
+}
+
+// The longest start and continuation: a u32 delta, a new quality and a
+// 64 bit XOR without a window to reuse
+static void longest_pair(history_sample_t *out, uint32_t key, uint64_t time_ms) {
+    out[0] = sample(key, time_ms, value_of(0x4035000000000000ULL), 1);
+    out[1] = sample(key, time_ms + 5000000, value_of(0x4035000000000000ULL ^ 0x8000000000000001ULL), 4);
+}
+
+// Eight runs end on a byte boundary, so the payload of a log of eight is
+// exactly as many bytes as one run takes bits
+static bool measure_bits(const char *name, bool continuation, int expected) {
+    history_sample_t pair[2];
+    size_t bytes;
+    int n = 0;
+
+    for (uint32_t key = 1; key <= 8; key++) {
+        longest_pair(pair, key, BENCH_BASE_MS);
+        g_in[n++] = pair[0];
+        if (continuation) {
+            g_in[n++] = pair[1];
+        }
+    }
+    if (!round_trip(name, g_in, n, BENCH_BASE_MS, &bytes)) {
+        return false;
+    }
+
+    int bits = (int)(bytes - HISTORY_LOG_HEADER);
+    if (continuation) {
+        bits -= HISTORY_START_BITS;
+    }
+    if (bits != expected) {
+        printf("%-14s %d bits, expected %d\n", name, bits, expected);
+        return false;
+    }
+    printf("%-14s %5d samples %6lu bytes  ok, %d bits\n", name, n, (unsigned long)bytes, bits);
+    return true;
+}
+
+static bool check_longest_record(void) {
+    if (!measure_bits("longest start", false, HISTORY_START_BITS) ||
+        !measure_bits("longest", true, HISTORY_CONTINUE_MAX_BITS)) {
+        return false;
+    }
+
+    // Logs filled with nothing but worst case samples must still fit
+    int n = 0;
+    for (uint32_t key = 0; n + 2 <= BENCH_MAX_SAMPLES; key++) {
+        longest_pair(&g_in[n], key, BENCH_BASE_MS);
+        n += 2;
+    }
+    return check("longest full", g_in, n, BENCH_BASE_MS);
+}
+
+// Random commits: runs of nodes with small integers, scaled floats, noise
+// bits and wide time jitter
+static bool check_random(int commits) {
+    srand(1);
+    for (int c = 0; c < commits; c++) {
+        int count = 1 + rand() % BENCH_MAX_SAMPLES;
+        int nodes = 1 + rand() % 40;
+        int mode = c % 4;
+        uint64_t base_ms = BENCH_BASE_MS + (uint64_t)rand();
+
+        for (int i = 0; i < count; i++) {
+            history_sample_t *s = &g_in[i];
+            int node = i * nodes / count;       // Sorted by key, then time
+            s->key = 0x9e3779b9u * (uint32_t)(node + 1);
+            s->time_ms = base_ms + (uint64_t)(i - node * count / nodes) * 1000 +
+                         (mode == 3 ? (uint64_t)(rand() % 2000) * 1000 : (uint64_t)(rand() % 7));
+            s->quality = rand() % 30 == 0 ? 3 : 1;
+            if (mode == 0) {
+                s->value = rand() % 100;
+            } else if (mode == 1) {
+                s->value = 20.0 + (float)(rand() % 100) / 10.0f;
+            } else {
+                s->value = value_of(((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 2) ^ (uint64_t)rand());
+            }
+        }
+        // Times within a node must not go backwards
+        for (int i = 1; i < count; i++) {
+            if (g_in[i].key == g_in[i - 1].key && g_in[i].time_ms < g_in[i - 1].time_ms) {
+                g_in[i].time_ms = g_in[i - 1].time_ms;
+            }
+        }
+
+        size_t bytes;
+        if (!round_trip("random", g_in, count, base_ms, &bytes)) {
+            return false;
+        }
+    }
+    printf("%-14s %5d commits  ok\n", "random", commits);
+    return true;
+}
+
+// A commit of 32 nodes polled once a second, slowly varying floats
+static int typical_commit(void) {
+    int n = 0;
+    for (int node = 0; node < 32; node++) {
+        for (int t = 0; t < 32; t++) {
+            g_in[n++] = sample(node, BENCH_BASE_MS + t * 1000 + rand() % 5,
+                               (float)(20.0f + (float)((t / 4 + node) % 10) / 10.0f), 1);
+        }
+    }
+    return n;
+}
+
+static void report_throughput(int commits) {
+    int count = typical_commit();
+    size_t bytes = 0;
+    double start = now_s();
+
+    for (int c = 0; c < commits; c++) {
+        int done = 0;
+        bytes = 0;
+        while (done < count) {
+            size_t len;
+            done += history_encode_log(g_log, sizeof(g_log), BENCH_BASE_MS, g_in + done,
+                                       count - done, &len);
+            bytes += len;
+        }
+    }
+    double encode_s = now_s() - start;
+
+    size_t len;
+    int n = history_encode_log(g_log, sizeof(g_log), BENCH_BASE_MS, g_in, count, &len);
+    start = now_s();
+    for (int c = 0; c < commits; c++) {
+        g_out_count = 0;
+        history_decode_log(g_log, len, collect, NULL);
+    }
+    double decode_s = now_s() - start;
+
+    printf("typical: %d samples in %lu bytes, ratio %.2f to %d byte records\n", count,
+           (unsigned long)bytes, (double)count * BENCH_RAW_SAMPLE / bytes, BENCH_RAW_SAMPLE);
+    printf("encode %10.0f samples/s\n", (double)count * commits / encode_s);
+    printf("decode %10.0f samples/s\n", (double)n * commits / decode_s);
+}
+
+int main(int argc, char *argv[]) {
+    int commits = argc > 1 ? atoi(argv[1]) : 2000;
+
+    if (commits <= 0) {
+        fprintf(stderr, "usage: %s [commits]\n", argv[0]);
+        return 1;
+    }
+
+    bool ok = check_equal_values() &&
+              check_special_values() &&
+              check_time_deltas() &&
+              check_longest_record() &&
+              check_random(commits);
+    if (!ok) {
+        printf("MISMATCH\n");
+        return 1;
+    }
+
+    report_throughput(commits);
+    return 0;
+}
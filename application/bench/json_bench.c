@@ -0,0 +1,166 @@
+// Node value encoding: the previous cJSON path (build a tree per value,
+// print it, free it) against json_writer streaming a batched update
+// message into a fixed buffer.
+//
+// Usage: json_bench [values]
+//
+// Allocations are counted through cJSON_InitHooks(). json_writer never
+// calls the allocator, so its column reads zero by construction.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cJSON.h"
+#include "json_writer.h"
+
+#define NODE_COUNT 32
+#define UPDATE_BUFFER_SIZE 4096
+
+typedef enum {
+    VALUE_INT16,
+    VALUE_FLOAT,
+    VALUE_DOUBLE,
+} value_type_t;
+
+typedef struct {
+    char name[32];
+    value_type_t type;
+    int16_t int16_val;
+    float float_val;
+    double double_val;
+} bench_node_t;
+
+static bench_node_t g_nodes[NODE_COUNT];
+static unsigned long g_allocs;
+
+static void *counting_malloc(size_t size) {
+    g_allocs++;
+    return malloc(size);
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Typical register map: raw counters, scaled floats and a few doubles
+static void init_nodes(void) {
+    for (int i = 0; i < NODE_COUNT; i++) {
+        bench_node_t *node = &g_nodes[i];
+        snprintf(node->name, sizeof(node->name), "node%02d", i);
+        node->type = (value_type_t)(i % 3);
+    }
+}
+
+static void update_nodes(int scan) {
+    for (int i = 0; i < NODE_COUNT; i++) {
+        bench_node_t *node = &g_nodes[i];
+        node->int16_val = (int16_t)(scan * 7 + i);
+        node->float_val = 20.0f + (float)((scan + i) % 100) / 10.0f;
+        node->double_val = 230.0 + (double)((scan * 3 + i) % 1000) / 100.0;
+    }
+}
+
+// One message per value, as build_node_json() did
+static size_t encode_cjson(const bench_node_t *node) {
+    cJSON *root = cJSON_CreateObject();
+    if (!root) return 0;
+
+    cJSON_AddStringToObject(root, "type", "update");
+    cJSON_AddStringToObject(root, "n", node->name);
+    switch (node->type) {
+        case VALUE_INT16: cJSON_AddNumberToObject(root, "v", node->int16_val); break;
+        case VALUE_FLOAT: cJSON_AddNumberToObject(root, "v", node->float_val); break;
+        case VALUE_DOUBLE: cJSON_AddNumberToObject(root, "v", node->double_val); break;
+    }
+
+    char *json_str = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (!json_str) return 0;
+
+    size_t len = strlen(json_str);
+    cJSON_free(json_str);
+    return len;
+}
+
+static size_t run_cjson(int values) {
+    size_t bytes = 0;
+    for (int i = 0; i < values; i++) {
+        if (i % NODE_COUNT == 0) {
+            update_nodes(i / NODE_COUNT);
+        }
+        bytes += encode_cjson(&g_nodes[i % NODE_COUNT]);
+    }
+    return bytes;
+}
+
+// One batched message per scan, as rtu_master publishes now
+static size_t run_writer(int values) {
+    static char buf[UPDATE_BUFFER_SIZE];
+    size_t bytes = 0;
+
+    for (int i = 0; i < values; i += NODE_COUNT) {
+        json_writer_t w;
+
+        update_nodes(i / NODE_COUNT);
+        json_writer_init(&w, buf, sizeof(buf));
+        json_writer_begin_object(&w);
+        json_writer_key(&w, "type");
+        json_writer_string(&w, "updates");
+        json_writer_key(&w, "vs");
+        json_writer_begin_array(&w);
+        for (int n = 0; n < NODE_COUNT && i + n < values; n++) {
+            const bench_node_t *node = &g_nodes[n];
+            json_writer_begin_object(&w);
+            json_writer_key(&w, "n");
+            json_writer_string(&w, node->name);
+            json_writer_key(&w, "v");
+            switch (node->type) {
+                case VALUE_INT16: json_writer_int(&w, node->int16_val); break;
+                case VALUE_FLOAT: json_writer_float(&w, node->float_val); break;
+                case VALUE_DOUBLE: json_writer_double(&w, node->double_val); break;
+            }
+            json_writer_end_object(&w);
+        }
+        json_writer_end_array(&w);
+        json_writer_end_object(&w);
+
+        int len = json_writer_finish(&w);
+        if (len > 0) {
+            bytes += len;
+        }
+    }
+    return bytes;
+}
+
+static void report(const char *name, size_t (*run)(int), int values) {
+    g_allocs = 0;
+    double start = now_s();
+    size_t bytes = run(values);
+    double elapsed = now_s() - start;
+
+    printf("%-8s %8.1f ns/value %8.2f allocs/value %8.1f bytes/value\n",
+           name, elapsed * 1e9 / values, (double)g_allocs / values, (double)bytes / values);
+}
+
+int main(int argc, char *argv[]) {
+    int values = argc > 1 ? atoi(argv[1]) : 2000000;
+    cJSON_Hooks hooks = { counting_malloc, free };
+
+    if (values <= 0) {
+        fprintf(stderr, "usage: %s [values]\n", argv[0]);
+        return 1;
+    }
+
+    cJSON_InitHooks(&hooks);
+    init_nodes();
+
+    // Warm up caches and the allocator before measuring
+    run_cjson(NODE_COUNT * 100);
+    run_writer(NODE_COUNT * 100);
+
+    report("cjson", run_cjson, values);
+    report("writer", run_writer, values);
+    return 0;
+}
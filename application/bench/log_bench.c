@@ -0,0 +1,246 @@
+// Contention benchmark for the log ring: N producer threads calling
+// log_buffer_add() while one consumer drains with log_buffer_get(),
+// compared with the previous mutex-protected ring. The "add_fmt" run passes
+// the format and arguments through log_buffer_add_fmt() the way the LOG()
+// macro does; build log_bench_binary to measure the deferred (LOG_BINARY) path.
+//
+// Producers never run more than BENCH_WINDOW entries ahead of the consumer,
+// so the ring never fills: the rate is of entries that went all the way
+// through, not of calls returning early on a full ring. A run that still
+// lost more than BENCH_MAX_LOSS of its entries is reported invalid and the
+// bench exits non-zero.
+//
+// That rate is bounded by the single consumer whichever ring is used, so
+// the "burst" runs time the producer side alone: in rounds, the producers
+// together add BENCH_WINDOW entries with nobody reading, then the ring is
+// drained untimed. Any entry dropped on a full ring makes the run invalid.
+//
+// Usage: log_bench [producers] [entries per producer]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <sched.h>
+#include "log_buffer.h"
+
+// Entries in flight, below the ring size with room for every producer
+#define BENCH_WINDOW (LOG_BUFFER_COUNT / 2)
+#define BENCH_MAX_LOSS 0.001
+
+// Previous implementation: one global mutex around a circular buffer
+typedef struct {
+    log_entry_t entries[LOG_BUFFER_COUNT];
+    int head;
+    int tail;
+    int count;
+} mutex_ring_t;
+
+static mutex_ring_t g_mutex_ring;
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void mutex_ring_add(const char* tag, log_level_t level, const char* message, const char* file, int line) {
+    pthread_mutex_lock(&g_mutex);
+    log_entry_t* entry = &g_mutex_ring.entries[g_mutex_ring.head];
+    strncpy(entry->tag, tag, sizeof(entry->tag) - 1);
+    entry->level = level;
+    strncpy(entry->message, message, sizeof(entry->message) - 1);
+    strncpy(entry->file, file, sizeof(entry->file) - 1);
+    entry->line = line;
+    entry->timestamp = time(NULL);
+    g_mutex_ring.head = (g_mutex_ring.head + 1) % LOG_BUFFER_COUNT;
+    if (g_mutex_ring.count < LOG_BUFFER_COUNT) {
+        g_mutex_ring.count++;
+    } else {
+        g_mutex_ring.tail = g_mutex_ring.head;
+    }
+    pthread_mutex_unlock(&g_mutex);
+}
+
+static int mutex_ring_get(log_entry_t* entry) {
+    int success = 0;
+    pthread_mutex_lock(&g_mutex);
+    if (g_mutex_ring.count > 0) {
+        memcpy(entry, &g_mutex_ring.entries[g_mutex_ring.tail], sizeof(log_entry_t));
+        g_mutex_ring.tail = (g_mutex_ring.tail + 1) % LOG_BUFFER_COUNT;
+        g_mutex_ring.count--;
+        success = 1;
+    }
+    pthread_mutex_unlock(&g_mutex);
+    return success;
+}
+
+typedef struct {
+    void (*emit)(long id, int i);   // Log entry i of producer id
+    void (*add)(const char*, log_level_t, const char*, const char*, int);
+    int (*get)(log_entry_t*);
+} ring_ops_t;
+
+static ring_ops_t g_ops;
+static int g_entries;
+static atomic_int g_producers_done;
+static atomic_long g_issued;        // Entries producers have claimed a place for
+static atomic_long g_consumed;
+static int g_burst;                 // Entries per producer and burst round
+static pthread_barrier_t g_round_start;
+static pthread_barrier_t g_round_done;
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Wait until the entry about to be added fits in the window
+static void pace(void) {
+    long ticket = atomic_fetch_add(&g_issued, 1);
+    while (ticket - atomic_load(&g_consumed) >= BENCH_WINDOW) {
+        sched_yield();
+    }
+}
+
+static void emit_add(long id, int i) {
+    char msg[64];
+    snprintf(msg, sizeof(msg), "device01.node%02ld = %d", id, i);
+    g_ops.add("RTU_MASTER", LOG_INFO, msg, __FILE__, __LINE__);
+}
+
+// Same message through the format API, nothing is formatted here in binary mode
+static void emit_fmt(long id, int i) {
+    log_buffer_add_fmt("RTU_MASTER", LOG_INFO, __FILE__, __LINE__, "device01.node%02ld = %d", id, i);
+}
+
+static void *producer(void *arg) {
+    long id = (long)arg;
+    for (int i = 0; i < g_entries; i++) {
+        pace();
+        g_ops.emit(id, i);
+    }
+    atomic_fetch_add(&g_producers_done, 1);
+    return NULL;
+}
+
+static void *burst_producer(void *arg) {
+    long id = (long)arg;
+    for (int i = 0; i < g_entries; ) {
+        int end = i + g_burst < g_entries ? i + g_burst : g_entries;
+        pthread_barrier_wait(&g_round_start);
+        for (; i < end; i++) {
+            g_ops.emit(id, i);
+        }
+        pthread_barrier_wait(&g_round_done);
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg) {
+    int producers = *(int *)arg;
+    log_entry_t entry;
+    while (1) {
+        if (g_ops.get(&entry)) {
+            atomic_fetch_add(&g_consumed, 1);
+        } else if (atomic_load(&g_producers_done) == producers) {
+            while (g_ops.get(&entry)) {
+                atomic_fetch_add(&g_consumed, 1);
+            }
+            break;
+        }
+    }
+    return NULL;
+}
+
+// Returns false when the run lost too many entries to mean anything
+static bool run(const char *name, ring_ops_t ops, int producers) {
+    pthread_t threads[64];
+    pthread_t reader;
+
+    g_ops = ops;
+    atomic_store(&g_producers_done, 0);
+    atomic_store(&g_issued, 0);
+    atomic_store(&g_consumed, 0);
+
+    double start = now_s();
+    pthread_create(&reader, NULL, consumer, &producers);
+    for (long i = 0; i < producers; i++) {
+        pthread_create(&threads[i], NULL, producer, (void *)i);
+    }
+    for (int i = 0; i < producers; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_join(reader, NULL);
+    double elapsed = now_s() - start;
+
+    long produced = (long)producers * g_entries;
+    long consumed = atomic_load(&g_consumed);
+    double loss = (double)(produced - consumed) / produced;
+    bool valid = loss <= BENCH_MAX_LOSS;
+    printf("%-10s %2d producers: %9.0f consumed/s, %ld of %ld consumed, %.3f%% lost%s\n",
+           name, producers, consumed / elapsed, consumed, produced, loss * 100,
+           valid ? "" : "  INVALID");
+    return valid;
+}
+
+// Producer side only, see the top of the file. Returns false when entries
+// were dropped, the ring was full and the rate is of early returns.
+static bool run_burst(const char *name, ring_ops_t ops, int producers) {
+    pthread_t threads[64];
+    log_entry_t entry;
+    uint32_t dropped = log_buffer_dropped();
+    long consumed = 0;
+    double elapsed = 0;
+
+    g_ops = ops;
+    g_burst = BENCH_WINDOW / producers > 0 ? BENCH_WINDOW / producers : 1;
+    pthread_barrier_init(&g_round_start, NULL, producers + 1);
+    pthread_barrier_init(&g_round_done, NULL, producers + 1);
+    for (long i = 0; i < producers; i++) {
+        pthread_create(&threads[i], NULL, burst_producer, (void *)i);
+    }
+    for (int i = 0; i < g_entries; i += g_burst) {
+        double start = now_s();
+        pthread_barrier_wait(&g_round_start);
+        pthread_barrier_wait(&g_round_done);
+        elapsed += now_s() - start;
+        while (ops.get(&entry)) {
+            consumed++;
+        }
+    }
+    for (int i = 0; i < producers; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_barrier_destroy(&g_round_start);
+    pthread_barrier_destroy(&g_round_done);
+
+    long produced = (long)producers * g_entries;
+    dropped = log_buffer_dropped() - dropped;
+    bool valid = dropped == 0 && consumed == produced;
+    printf("%-10s %2d producers: %9.0f added/s, producer side only, %u dropped%s\n",
+           name, producers, produced / elapsed, dropped, valid ? "" : "  INVALID");
+    return valid;
+}
+
+int main(int argc, char *argv[]) {
+    int producers = argc > 1 ? atoi(argv[1]) : 4;
+    g_entries = argc > 2 ? atoi(argv[2]) : 200000;
+
+    if (producers < 1 || producers > 64) {
+        fprintf(stderr, "producers must be between 1 and 64\n");
+        return 1;
+    }
+
+    log_buffer_init();
+    ring_ops_t mutex = { emit_add, mutex_ring_add, mutex_ring_get };
+    ring_ops_t lock_free = { emit_add, log_buffer_add, log_buffer_get };
+    ring_ops_t add_fmt = { emit_fmt, log_buffer_add, log_buffer_get };
+
+    bool valid = run("mutex", mutex, producers);
+    valid &= run("lock-free", lock_free, producers);
+    valid &= run("add_fmt", add_fmt, producers);
+    valid &= run_burst("mutex", mutex, producers);
+    valid &= run_burst("lock-free", lock_free, producers);
+    valid &= run_burst("add_fmt", add_fmt, producers);
+    printf("lock-free dropped counter: %u\n", log_buffer_dropped());
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+// Log sink throughput: the previous per-entry output (format, one write per
+// line, one websocket message per line) against batched output (format a
+// batch into one arena, one write, one coalesced websocket message).
+//
+// Usage: log_sink_bench [output file] [lines]
+//
+// The default output is /dev/null, so the numbers show formatting plus
+// syscall cost. The websocket sink is modelled by a write to a socketpair,
+// the same transport mg_wakeup() uses to hand messages to the web thread.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/socket.h>
+#include "log_buffer.h"
+#include "log_sink.h"
+
+static log_arena_t g_arena;
+static int g_ws_fds[2];
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Fill the ring the way the RTU thread logs node values
+static void produce(int count, int *next) {
+    char msg[64];
+    for (int i = 0; i < count; i++) {
+        snprintf(msg, sizeof(msg), "device01.node%02d = %d", *next % 32, *next);
+        log_buffer_add("RTU_MASTER", LOG_INFO, msg, __FILE__, __LINE__);
+        (*next)++;
+    }
+}
+
+// Drain whatever reached the websocket side so the socketpair never fills
+static void drain_ws(void) {
+    char buf[8192];
+    while (read(g_ws_fds[1], buf, sizeof(buf)) > 0) {
+    }
+}
+
+static int per_entry(int fd) {
+    log_entry_t entry;
+    char line[LOG_SINK_LINE_SIZE];
+    int count = 0;
+
+    while (log_buffer_get(&entry)) {
+        size_t len = log_sink_format(&entry, line, sizeof(line));
+        log_sink_write(fd, line, len);
+        send(g_ws_fds[0], line, len - 1, MSG_DONTWAIT);
+        count++;
+    }
+    return count;
+}
+
+static int batched(int fd) {
+    int total = 0;
+    int count;
+
+    while ((count = log_sink_fill(&g_arena)) > 0) {
+        log_sink_write(fd, g_arena.data, g_arena.len);
+        send(g_ws_fds[0], g_arena.data, g_arena.len - 1, MSG_DONTWAIT);
+        total += count;
+    }
+    return total;
+}
+
+static void run(const char *name, int (*sink)(int), int fd, int lines) {
+    int next = 0;
+    int written = 0;
+    double busy = 0;
+
+    while (written < lines) {
+        produce(LOG_BUFFER_COUNT / 2, &next);
+        double start = now_s();
+        written += sink(fd);
+        busy += now_s() - start;
+        drain_ws();
+    }
+    printf("%-10s %8d lines, %10.0f lines/s\n", name, written, written / busy);
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = argc > 1 ? argv[1] : "/dev/null";
+    int lines = argc > 2 ? atoi(argv[2]) : 200000;
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        perror(path);
+        return 1;
+    }
+    if (socketpair(AF_UNIX, SOCK_DGRAM, 0, g_ws_fds) < 0) {
+        perror("socketpair");
+        return 1;
+    }
+    fcntl(g_ws_fds[1], F_SETFL, O_NONBLOCK);
+
+    log_buffer_init();
+    run("per-entry", per_entry, fd, lines);
+    run("batched", batched, fd, lines);
+
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,218 @@
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "cJSON.h"
+#include "db.h"
+
+#define DBG_TAG "CONFIG"
+#define DBG_LVL LOG_INFO
+#include "dbg.h"
+
+static const struct {
+    const char *name;
+    size_t max_size;
+} s_blobs[CONFIG_COUNT] = {
+    [CONFIG_SYSTEM] = { "system_config", 4096 },
+    [CONFIG_NETWORK] = { "network_config", 4096 },
+    [CONFIG_DEVICE] = { "device_config", 16 * 4096 },
+    [CONFIG_CARD] = { "card_config", 8 * 4096 },
+};
+
+// Read-copy-update: writers build a new config and swap the pointer.
+// Readers count themselves in s_readers around their use, and the writer
+// frees the old config only once the count has dropped to zero after the
+// swap. Readers hold it for microseconds and changes come from the web
+// UI, so the wait is short.
+static _Atomic(config_t *) s_config;
+static atomic_int s_readers;
+static pthread_mutex_t s_write_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void free_config(config_t *cfg) {
+    if (!cfg) return;
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        free(cfg->json[i]);
+    }
+    free(cfg);
+}
+
+// Cookie token, a hash of the credentials so it changes with them
+static void derive_token(config_t *cfg) {
+    unsigned long hash = 5381;
+    const char *parts[2] = { cfg->username, cfg->password };
+
+    for (int i = 0; i < 2; i++) {
+        for (const char *p = parts[i]; *p; p++) {
+            hash = ((hash << 5) + hash) + (unsigned char)*p; // hash * 33 + c
+        }
+    }
+    snprintf(cfg->access_token, sizeof(cfg->access_token), "%016lx", hash);
+}
+
+static void copy_string(char *dst, size_t size, const cJSON *item) {
+    if (cJSON_IsString(item) && item->valuestring) {
+        snprintf(dst, size, "%s", item->valuestring);
+    }
+}
+
+static int get_int(const cJSON *root, const char *key, int fallback) {
+    const cJSON *item = cJSON_GetObjectItem(root, key);
+    return cJSON_IsNumber(item) ? item->valueint : fallback;
+}
+
+// Fill the typed fields from the system_config text
+static void parse_system(config_t *cfg) {
+    cfg->http_port = CONFIG_DEFAULT_HTTP_PORT;
+    cfg->ws_port = CONFIG_DEFAULT_WS_PORT;
+    cfg->log_method = 0;
+
+    cJSON *root = cfg->json[CONFIG_SYSTEM] ? cJSON_Parse(cfg->json[CONFIG_SYSTEM]) : NULL;
+    if (!root) {
+        DBG_ERROR("Failed to parse system config, using defaults");
+    } else {
+        copy_string(cfg->username, sizeof(cfg->username), cJSON_GetObjectItem(root, "username"));
+        copy_string(cfg->password, sizeof(cfg->password), cJSON_GetObjectItem(root, "password"));
+        cfg->http_port = get_int(root, "hport", cfg->http_port);
+        cfg->ws_port = get_int(root, "wport", cfg->ws_port);
+        cfg->log_method = get_int(root, "logMethod", cfg->log_method);
+        cJSON_Delete(root);
+    }
+    derive_token(cfg);
+}
+
+static char *read_blob(config_key_t key) {
+    size_t size = s_blobs[key].max_size;
+    char *buf = calloc(1, size + 1);
+    if (!buf) {
+        DBG_ERROR("Failed to allocate memory for %s", s_blobs[key].name);
+        return NULL;
+    }
+
+    int read_len = db_read(s_blobs[key].name, buf, size);
+    if (read_len <= 0) {
+        DBG_WARN("No %s in database", s_blobs[key].name);
+        free(buf);
+        return NULL;
+    }
+
+    // Small copy instead of the worst case buffer
+    char *json = strdup(buf);
+    free(buf);
+    return json;
+}
+
+// Swap in next and free the config it replaces once no reader holds it
+static void publish(config_t *next) {
+    config_t *prev = atomic_exchange(&s_config, next);
+
+    while (atomic_load(&s_readers) != 0) {
+        usleep(100);
+    }
+    free_config(prev);
+}
+
+const config_t *config_acquire(void) {
+    atomic_fetch_add(&s_readers, 1);
+    return atomic_load(&s_config);
+}
+
+void config_release(void) {
+    atomic_fetch_sub(&s_readers, 1);
+}
+
+char *config_dup(config_key_t key) {
+    if (key >= CONFIG_COUNT) return NULL;
+
+    const config_t *cfg = config_acquire();
+    char *json = cfg && cfg->json[key] ? strdup(cfg->json[key]) : NULL;
+    config_release();
+    return json;
+}
+
+int config_reload(void) {
+    config_t *cfg = calloc(1, sizeof(config_t));
+    if (!cfg) {
+        DBG_ERROR("Failed to allocate memory for config");
+        return -1;
+    }
+
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        cfg->json[i] = read_blob(i);
+    }
+    parse_system(cfg);
+
+    pthread_mutex_lock(&s_write_lock);
+    publish(cfg);
+    pthread_mutex_unlock(&s_write_lock);
+
+    DBG_INFO("Config loaded");
+    return 0;
+}
+
+int config_init(void) {
+    return config_reload();
+}
+
+// The system_config to store: json, keeping the current password when the
+// UI left it out because it was not changed. NULL if json is not valid.
+static char *merge_system(const config_t *cur, const char *json) {
+    cJSON *root = cJSON_Parse(json);
+    if (!root) {
+        DBG_ERROR("Failed to parse system config JSON");
+        return NULL;
+    }
+
+    char *merged;
+    if (!cJSON_GetObjectItem(root, "password") && cur && cur->password[0]) {
+        cJSON_AddStringToObject(root, "password", cur->password);
+        merged = cJSON_PrintUnformatted(root);
+    } else {
+        merged = strdup(json);
+    }
+    cJSON_Delete(root);
+    return merged;
+}
+
+int config_set(config_key_t key, const char *json) {
+    if (key >= CONFIG_COUNT || !json) {
+        return -1;
+    }
+
+    pthread_mutex_lock(&s_write_lock);
+
+    // Only writers replace the config and we hold the write lock
+    const config_t *cur = atomic_load(&s_config);
+    char *text = key == CONFIG_SYSTEM ? merge_system(cur, json) : strdup(json);
+    config_t *next = calloc(1, sizeof(config_t));
+    if (!text || !next) {
+        pthread_mutex_unlock(&s_write_lock);
+        free(text);
+        free(next);
+        return -1;
+    }
+
+    if (db_write(s_blobs[key].name, text, strlen(text) + 1) != 0) {
+        DBG_ERROR("Failed to write %s to database", s_blobs[key].name);
+        pthread_mutex_unlock(&s_write_lock);
+        free(text);
+        free(next);
+        return -1;
+    }
+
+    for (int i = 0; i < CONFIG_COUNT; i++) {
+        if (i == (int)key) {
+            next->json[i] = text;
+        } else if (cur && cur->json[i]) {
+            next->json[i] = strdup(cur->json[i]);
+        }
+    }
+    parse_system(next);
+    publish(next);
+
+    pthread_mutex_unlock(&s_write_lock);
+    DBG_INFO("%s updated", s_blobs[key].name);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <stdbool.h>
+
+#define CONFIG_DEFAULT_HTTP_PORT 8000
+#define CONFIG_DEFAULT_WS_PORT 4002
+
+// Configuration blobs kept in the KVDB
+typedef enum {
+    CONFIG_SYSTEM = 0,      // "system_config"
+    CONFIG_NETWORK,         // "network_config"
+    CONFIG_DEVICE,          // "device_config"
+    CONFIG_CARD,            // "card_config"
+    CONFIG_COUNT
+} config_key_t;
+
+// In-memory copy of the stored configuration, system_config parsed.
+// Loaded once, replaced as a whole on every change and never modified in
+// place, so readers need no lock.
+typedef struct {
+    char username[64];
+    char password[64];
+    char access_token[17];  // Derived from the credentials
+    int http_port;
+    int ws_port;
+    int log_method;
+    char *json[CONFIG_COUNT];   // Stored text of each blob, NULL if missing
+} config_t;
+
+// Load every blob from the KVDB, after db_init()
+int config_init(void);
+
+// Reload after the KVDB changed underneath, e.g. a factory reset
+int config_reload(void);
+
+// Readers: bracket every use of the returned config, never blocks. The
+// config stays valid until config_release(); do not call config_set() or
+// config_reload() in between.
+const config_t *config_acquire(void);
+void config_release(void);
+
+// Malloc'ed copy of the text of a blob, NULL if it is missing
+char *config_dup(config_key_t key);
+
+// Store a blob and publish the config with it. A system_config without
+// "password" keeps the current one. Returns 0 on success.
+int config_set(config_key_t key, const char *json);
+
+#endif // CONFIG_H
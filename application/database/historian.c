@@ -0,0 +1,482 @@
+#include "historian.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <flashdb.h>
+#include "rtu_master.h"
+#include "history_codec.h"
+
+#define DBG_TAG "HISTORY"
+#define DBG_LVL LOG_INFO
+#include "dbg.h"
+
+#define HISTORY_DB_NAME "history"
+#define HISTORY_DB_PATH "fdb_tsdb1"
+#define HISTORY_SEC_SIZE 4096
+#define HISTORY_MAX_SIZE (HISTORY_SEC_SIZE * 512)
+#define HISTORY_DRAIN_MS 100        // Queue drain period of the historian thread
+#define HISTORY_QUERY_MAX_LOGS 256  // Logs one query reads, newest first, 512 KB at most
+#define HISTORY_QUERY_TRIES 3       // Flash reads a query repeats while commits race it
+#define HISTORY_LOG_MAX 2048        // Largest log, see history_codec.h for its layout
+
+// Size of a sample as a plain record (u32 key, u8 quality, u64 time,
+// u64 value), the reference of the reported compression ratio
+#define HISTORY_RAW_SAMPLE 21
+
+// A log is stamped when its samples are committed, at most this long after
+// the oldest of them (seconds, rounded up with a margin for drain delays)
+#define HISTORY_LOG_LAG_S (HISTORY_COMMIT_MS / 1000 + 2)
+
+#define HISTORY_QUEUE_MASK (HISTORY_QUEUE_COUNT - 1)
+
+_Static_assert((HISTORY_QUEUE_COUNT & HISTORY_QUEUE_MASK) == 0, "HISTORY_QUEUE_COUNT must be a power of two");
+
+// Multi-producer/single-consumer ring, the same sequence protocol as
+// log_buffer.c: a producer fills the slot for position pos when
+// sequence == pos and publishes it with sequence = pos + 1, the consumer
+// hands it back for the next lap with sequence = pos + HISTORY_QUEUE_COUNT.
+// Sequences are stored relative to the slot index so zeroed slots are valid.
+typedef struct {
+    atomic_size_t sequence;
+    history_sample_t sample;
+} history_slot_t;
+
+static history_slot_t s_slots[HISTORY_QUEUE_COUNT];
+static atomic_size_t s_enqueue_pos;
+static size_t s_dequeue_pos;        // Under s_stage_lock
+static atomic_uint s_dropped;
+static atomic_bool s_running;
+
+static struct fdb_tsdb s_tsdb;
+static pthread_mutex_t s_tsdb_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Staging buffer in front of the TSDB, committed when it holds
+// HISTORY_STAGE_COUNT samples or its oldest one is HISTORY_COMMIT_MS old.
+// Guarded by s_stage_lock. Queries read flash without it and only take it
+// to add the staged samples; s_commit_seq, odd while a commit is appending,
+// tells them whether a commit moved samples in between.
+static pthread_mutex_t s_stage_lock = PTHREAD_MUTEX_INITIALIZER;
+static atomic_uint s_commit_seq;
+static history_sample_t s_stage[HISTORY_STAGE_COUNT];
+static int s_stage_count;
+static uint64_t s_stage_since_ms;   // Monotonic time the first sample was staged
+static uint64_t s_stage_min_ms;     // Time range of the staged samples
+static uint64_t s_stage_max_ms;
+
+// Time stamped on the next log. FlashDB refuses logs older than the last
+// one, so it never goes backwards even if the wall clock does.
+static fdb_time_t s_log_time;
+
+// Write counters, under s_stats_lock so the status page never waits on flash
+static pthread_mutex_t s_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static history_stats_t s_stats;
+static uint64_t s_start_ms;
+
+static void lock(fdb_db_t db)
+{
+    pthread_mutex_lock((pthread_mutex_t *)db->user_data);
+}
+
+static void unlock(fdb_db_t db)
+{
+    pthread_mutex_unlock((pthread_mutex_t *)db->user_data);
+}
+
+static fdb_time_t get_log_time(void)
+{
+    return s_log_time;
+}
+
+static uint64_t monotonic_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// FNV-1a over the device name, a NUL and the node name
+uint32_t historian_key(const char *device, const char *node)
+{
+    uint32_t hash = 2166136261u;
+    const char *parts[2] = { device ? device : "", node ? node : "" };
+
+    for (int i = 0; i < 2; i++) {
+        const unsigned char *p = (const unsigned char *)parts[i];
+        do {
+            hash ^= *p;
+            hash *= 16777619u;
+        } while (*p++);
+    }
+    return hash;
+}
+
+static inline size_t slot_sequence(history_slot_t *slot, size_t index)
+{
+    return atomic_load_explicit(&slot->sequence, memory_order_acquire) + index;
+}
+
+static inline void set_slot_sequence(history_slot_t *slot, size_t index, size_t seq)
+{
+    atomic_store_explicit(&slot->sequence, seq - index, memory_order_release);
+}
+
+bool historian_record(uint32_t key, uint64_t time_ms, double value, uint8_t quality)
+{
+    if (!atomic_load_explicit(&s_running, memory_order_relaxed)) {
+        return false;
+    }
+
+    size_t pos = atomic_load_explicit(&s_enqueue_pos, memory_order_relaxed);
+    history_slot_t *slot;
+
+    while (1) {
+        slot = &s_slots[pos & HISTORY_QUEUE_MASK];
+        intptr_t diff = (intptr_t)slot_sequence(slot, pos & HISTORY_QUEUE_MASK) - (intptr_t)pos;
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&s_enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Full: the historian is stuck behind flash, shed instead of waiting
+            atomic_fetch_add_explicit(&s_dropped, 1, memory_order_relaxed);
+            return false;
+        } else {
+            pos = atomic_load_explicit(&s_enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    slot->sample.key = key;
+    slot->sample.quality = quality;
+    slot->sample.time_ms = time_ms;
+    slot->sample.value = value;
+    set_slot_sequence(slot, pos & HISTORY_QUEUE_MASK, pos + 1);
+    return true;
+}
+
+// Take the next published sample off the queue, caller holds s_stage_lock
+static bool dequeue(history_sample_t *sample)
+{
+    history_slot_t *slot = &s_slots[s_dequeue_pos & HISTORY_QUEUE_MASK];
+
+    if (slot_sequence(slot, s_dequeue_pos & HISTORY_QUEUE_MASK) != s_dequeue_pos + 1) {
+        return false;
+    }
+    *sample = slot->sample;
+    set_slot_sequence(slot, s_dequeue_pos & HISTORY_QUEUE_MASK, s_dequeue_pos + HISTORY_QUEUE_COUNT);
+    s_dequeue_pos++;
+    return true;
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+    const history_sample_t *x = (const history_sample_t *)a;
+    const history_sample_t *y = (const history_sample_t *)b;
+
+    if (x->key != y->key) {
+        return x->key < y->key ? -1 : 1;
+    }
+    if (x->time_ms != y->time_ms) {
+        return x->time_ms < y->time_ms ? -1 : 1;
+    }
+    return 0;
+}
+
+// Append the staged samples as few TSDB logs as they fit in, caller
+// holds s_stage_lock
+static void commit_stage(void)
+{
+    static uint8_t buf[HISTORY_LOG_MAX];
+    struct fdb_blob blob;
+    int done = 0;
+
+    if (s_stage_count == 0) {
+        return;
+    }
+
+    // Runs per node compress far better than the interleaved poll order
+    qsort(s_stage, s_stage_count, sizeof(s_stage[0]), compare_samples);
+
+    fdb_time_t now = (fdb_time_t)time(NULL);
+    if (now > s_log_time) {
+        s_log_time = now;
+    }
+
+    atomic_fetch_add_explicit(&s_commit_seq, 1, memory_order_acq_rel);
+
+    while (done < s_stage_count) {
+        size_t len;
+        int n = history_encode_log(buf, sizeof(buf), s_stage_min_ms, s_stage + done,
+                                   s_stage_count - done, &len);
+
+        fdb_err_t result = fdb_tsl_append(&s_tsdb, fdb_blob_make(&blob, buf, len));
+
+        pthread_mutex_lock(&s_stats_lock);
+        if (result != FDB_NO_ERR) {
+            s_stats.failed++;
+        } else {
+            s_stats.samples += n;
+            s_stats.logs++;
+            s_stats.bytes += len;
+            s_stats.raw_bytes += (uint64_t)n * HISTORY_RAW_SAMPLE;
+        }
+        pthread_mutex_unlock(&s_stats_lock);
+
+        if (result != FDB_NO_ERR) {
+            DBG_ERROR("Failed to append %d samples: %d", n, result);
+        } else {
+            DBG_DEBUG("Committed %d samples in %lu bytes", n, (unsigned long)len);
+        }
+        done += n;
+    }
+    s_stage_count = 0;
+    atomic_fetch_add_explicit(&s_commit_seq, 1, memory_order_release);
+}
+
+// Stage one sample, committing first when the buffer is full or the
+// sample falls outside the time range one log can express
+static void stage_sample(const history_sample_t *sample)
+{
+    if (s_stage_count > 0) {
+        uint64_t min_ms = sample->time_ms < s_stage_min_ms ? sample->time_ms : s_stage_min_ms;
+        uint64_t max_ms = sample->time_ms > s_stage_max_ms ? sample->time_ms : s_stage_max_ms;
+        if (s_stage_count == HISTORY_STAGE_COUNT || max_ms - min_ms > UINT32_MAX) {
+            commit_stage();
+        }
+    }
+    if (s_stage_count == 0) {
+        s_stage_since_ms = monotonic_ms();
+        s_stage_min_ms = sample->time_ms;
+        s_stage_max_ms = sample->time_ms;
+    } else if (sample->time_ms < s_stage_min_ms) {
+        s_stage_min_ms = sample->time_ms;
+    } else if (sample->time_ms > s_stage_max_ms) {
+        s_stage_max_ms = sample->time_ms;
+    }
+    s_stage[s_stage_count++] = *sample;
+}
+
+// Move everything queued into the staging buffer, caller holds s_stage_lock
+static void drain_queue(void)
+{
+    history_sample_t sample;
+
+    while (dequeue(&sample)) {
+        stage_sample(&sample);
+    }
+}
+
+static void *historian_thread(void *arg)
+{
+    DBG_INFO("Historian thread started");
+
+    while (1) {
+        pthread_mutex_lock(&s_stage_lock);
+        drain_queue();
+        if (s_stage_count > 0 && monotonic_ms() - s_stage_since_ms >= HISTORY_COMMIT_MS) {
+            commit_stage();
+        }
+        pthread_mutex_unlock(&s_stage_lock);
+
+        usleep(HISTORY_DRAIN_MS * 1000);
+    }
+
+    return NULL;
+}
+
+void historian_flush(void)
+{
+    if (!atomic_load(&s_running)) {
+        return;
+    }
+
+    pthread_mutex_lock(&s_stage_lock);
+    drain_queue();
+    int count = s_stage_count;
+    commit_stage();
+    pthread_mutex_unlock(&s_stage_lock);
+
+    DBG_INFO("Flushed %d samples", count);
+}
+
+void historian_get_stats(history_stats_t *stats)
+{
+    if (!stats) return;
+
+    pthread_mutex_lock(&s_stats_lock);
+    *stats = s_stats;
+    pthread_mutex_unlock(&s_stats_lock);
+
+    stats->dropped = atomic_load_explicit(&s_dropped, memory_order_relaxed);
+    stats->uptime_ms = atomic_load(&s_running) ? monotonic_ms() - s_start_ms : 0;
+}
+
+int historian_init(void)
+{
+    fdb_err_t result;
+    bool file_mode = true;
+    bool rollover = true;
+    uint32_t sec_size = HISTORY_SEC_SIZE, db_size = HISTORY_MAX_SIZE;
+
+    if (atomic_load(&s_running)) {
+        DBG_WARN("Historian already running");
+        return 0;
+    }
+
+    fdb_tsdb_control(&s_tsdb, FDB_TSDB_CTRL_SET_LOCK, (void *)lock);
+    fdb_tsdb_control(&s_tsdb, FDB_TSDB_CTRL_SET_UNLOCK, (void *)unlock);
+    fdb_tsdb_control(&s_tsdb, FDB_TSDB_CTRL_SET_SEC_SIZE, &sec_size);
+    fdb_tsdb_control(&s_tsdb, FDB_TSDB_CTRL_SET_MAX_SIZE, &db_size);
+    fdb_tsdb_control(&s_tsdb, FDB_TSDB_CTRL_SET_FILE_MODE, &file_mode);
+
+    mkdir(HISTORY_DB_PATH, 0777);
+
+    result = fdb_tsdb_init(&s_tsdb, HISTORY_DB_NAME, HISTORY_DB_PATH, get_log_time,
+                           HISTORY_LOG_MAX, &s_tsdb_lock);
+    if (result != FDB_NO_ERR) {
+        DBG_ERROR("Failed to initialize TSDB: %d", result);
+        return -1;
+    }
+    // Recycle the oldest sectors once full
+    fdb_tsdb_control(&s_tsdb, FDB_TSDB_CTRL_SET_ROLLOVER, &rollover);
+    fdb_tsdb_control(&s_tsdb, FDB_TSDB_CTRL_GET_LAST_TIME, &s_log_time);
+
+    pthread_t thread;
+    pthread_attr_t attr;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    int ret = pthread_create(&thread, &attr, historian_thread, NULL);
+    pthread_attr_destroy(&attr);
+    if (ret != 0) {
+        DBG_ERROR("Failed to create historian thread: %s", strerror(ret));
+        return -1;
+    }
+
+    s_start_ms = monotonic_ms();
+    atomic_store(&s_running, true);
+    DBG_INFO("TSDB initialized");
+    return 0;
+}
+
+// Range query state
+typedef struct {
+    uint32_t key;
+    uint64_t from_ms;
+    uint64_t to_ms;
+    uint64_t bucket_ms;
+    history_bucket_t *buckets;
+    int bucket_count;
+    int logs;               // Logs read so far
+    bool truncated;         // Stopped at HISTORY_QUERY_MAX_LOGS
+} history_query_t;
+
+static void add_to_bucket(const history_sample_t *s, void *arg)
+{
+    history_query_t *q = (history_query_t *)arg;
+
+    if (s->key != q->key || s->time_ms < q->from_ms || s->time_ms > q->to_ms) {
+        return;
+    }
+
+    history_bucket_t *b = &q->buckets[(s->time_ms - q->from_ms) / q->bucket_ms];
+    b->samples++;
+    b->quality = s->quality;
+    if (s->quality != NODE_QUALITY_GOOD || isnan(s->value)) {
+        return;
+    }
+    if (b->good == 0 || s->value < b->min) {
+        b->min = s->value;
+    }
+    if (b->good == 0 || s->value > b->max) {
+        b->max = s->value;
+    }
+    b->sum += s->value;
+    b->good++;
+}
+
+static bool query_log(fdb_tsl_t tsl, void *arg)
+{
+    static uint8_t buf[HISTORY_LOG_MAX];
+    history_query_t *q = (history_query_t *)arg;
+    struct fdb_blob blob;
+
+    if (q->logs++ == HISTORY_QUERY_MAX_LOGS) {
+        q->truncated = true;
+        return true;    // Stop, the older part of the range is left out
+    }
+
+    size_t len = fdb_blob_read((fdb_db_t)&s_tsdb,
+                               fdb_tsl_to_blob(tsl, fdb_blob_make(&blob, buf, sizeof(buf))));
+    if (!history_decode_log(buf, len, add_to_bucket, arg)) {
+        DBG_WARN("Skipping malformed history log at %ld", (long)tsl->time);
+    }
+    return false;  // Keep iterating
+}
+
+uint64_t historian_query(uint32_t key, uint64_t from_ms, uint64_t to_ms,
+                         history_bucket_t *buckets, int bucket_count, bool *truncated)
+{
+    if (!atomic_load(&s_running) || !buckets || bucket_count <= 0 || to_ms < from_ms) {
+        return 0;
+    }
+
+    history_query_t q = {
+        .key = key,
+        .from_ms = from_ms,
+        .to_ms = to_ms,
+        .bucket_ms = (to_ms - from_ms) / bucket_count + 1,
+        .buckets = buckets,
+        .bucket_count = bucket_count,
+    };
+
+    // A log is stamped up to HISTORY_LOG_LAG_S after its samples
+    fdb_time_t from_s = (fdb_time_t)(from_ms / 1000);
+    fdb_time_t to_s = (fdb_time_t)(to_ms / 1000 + HISTORY_LOG_LAG_S);
+
+    for (int attempt = 0; attempt < HISTORY_QUERY_TRIES; attempt++) {
+        memset(buckets, 0, sizeof(*buckets) * bucket_count);
+        for (int i = 0; i < bucket_count; i++) {
+            buckets[i].start_ms = from_ms + q.bucket_ms * i;
+        }
+        q.logs = 0;
+        q.truncated = false;
+
+        // Flash is read without s_stage_lock, so neither the historian
+        // thread nor a commit waits on the query. Newest first, so a
+        // query cut at HISTORY_QUERY_MAX_LOGS keeps the recent part.
+        unsigned seq = atomic_load_explicit(&s_commit_seq, memory_order_acquire);
+        fdb_tsl_iter_by_time(&s_tsdb, to_s, from_s, query_log, &q);
+
+        // A sample is either staged or committed: staged ones only count if
+        // no commit ran during the flash read, otherwise read flash again
+        pthread_mutex_lock(&s_stage_lock);
+        bool settled = !(seq & 1) &&
+                       atomic_load_explicit(&s_commit_seq, memory_order_relaxed) == seq;
+        if (settled) {
+            for (int i = 0; i < s_stage_count; i++) {
+                add_to_bucket(&s_stage[i], &q);
+            }
+        }
+        pthread_mutex_unlock(&s_stage_lock);
+
+        if (settled) {
+            if (truncated) {
+                *truncated = q.truncated;
+            }
+            return q.bucket_ms;
+        }
+    }
+
+    DBG_WARN("History query gave up, commits kept racing it");
+    return 0;
+}
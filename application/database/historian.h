@@ -0,0 +1,78 @@
+#ifndef HISTORIAN_H
+#define HISTORIAN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Node value history in the FlashDB TSDB. Poll threads hand samples to a
+// lock-free queue and return immediately; the historian thread collects
+// them in a staging buffer and group commits it, compressed per node, when
+// it is full or its oldest sample is HISTORY_COMMIT_MS old. Flash thus sees
+// a few writes per commit rather than one per sample. A power loss costs at
+// most the staged samples; on a normal shutdown historian_flush() commits
+// them. The oldest sectors are recycled once the database is full.
+//
+// Samples are keyed by historian_key() of the device and node name, so the
+// history of a node survives config edits that move or renumber it, and
+// renaming the node or its device starts a new one.
+
+#define HISTORY_COMMIT_MS 60000     // Longest time a sample stays in RAM
+#define HISTORY_STAGE_COUNT 1024    // Samples staged before a commit is forced
+#define HISTORY_QUEUE_COUNT 4096    // Must be a power of two
+#define HISTORY_MAX_BUCKETS 1000
+
+typedef struct {
+    uint32_t key;           // historian_key() of the node
+    uint8_t quality;        // node_quality_t of the poll
+    uint64_t time_ms;       // Wall clock
+    double value;           // Last good value, NaN if there is none yet
+} history_sample_t;
+
+// Aggregate of the samples of one node in [start_ms, start_ms + bucket)
+typedef struct {
+    uint64_t start_ms;
+    uint32_t samples;       // Samples of any quality
+    uint32_t good;          // Good samples, the ones min/max/sum cover
+    double min;
+    double max;
+    double sum;
+    uint8_t quality;        // Quality of the last sample
+} history_bucket_t;
+
+// Write counters since start
+typedef struct {
+    uint64_t samples;       // Samples committed
+    uint64_t logs;          // TSDB logs appended
+    uint64_t bytes;         // Bytes appended
+    uint64_t raw_bytes;     // The same samples as plain 21 byte records
+    uint32_t failed;        // Appends the TSDB refused
+    uint32_t dropped;       // Samples lost because the queue was full
+    uint64_t uptime_ms;     // Time the counters cover
+} history_stats_t;
+
+// Stable history key of a node, a hash of its device and node name.
+// NULL names hash as empty ones.
+uint32_t historian_key(const char *device, const char *node);
+
+// Open the database and start the historian thread
+int historian_init(void);
+
+// Commit everything queued or staged, for the shutdown path
+void historian_flush(void);
+
+void historian_get_stats(history_stats_t *stats);
+
+// Queue a sample, never blocks. False when the queue is full, the sample
+// is then dropped and counted in dropped, or when the historian is not
+// running, which is not counted.
+bool historian_record(uint32_t key, uint64_t time_ms, double value, uint8_t quality);
+
+// Downsample the history of a node over [from_ms, to_ms] into bucket_count
+// buckets of equal length, samples still staged in RAM included. Flash is
+// read newest first and at most a fixed number of logs per query; when the
+// older part of the range is cut off, *truncated (if given) is set.
+// Returns the bucket length in milliseconds, 0 on error.
+uint64_t historian_query(uint32_t key, uint64_t from_ms, uint64_t to_ms,
+                         history_bucket_t *buckets, int bucket_count, bool *truncated);
+
+#endif // HISTORIAN_H
@@ -0,0 +1,295 @@
+#include "history_codec.h"
+#include <string.h>
+
+static void put_le(uint8_t *out, uint64_t value, int width)
+{
+    for (int i = 0; i < width; i++) {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static uint64_t get_le(const uint8_t *in, int width)
+{
+    uint64_t value = 0;
+    for (int i = 0; i < width; i++) {
+        value |= (uint64_t)in[i] << (8 * i);
+    }
+    return value;
+}
+
+static uint64_t value_bits(double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static double bits_value(uint64_t bits)
+{
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Bit stream over a log buffer, most significant bit first
+typedef struct {
+    uint8_t *buf;
+    size_t size;        // Bytes
+    size_t bit;         // Next bit to write or read
+} bit_stream_t;
+
+static void put_bits(bit_stream_t *bs, uint64_t value, int count)
+{
+    while (count > 0) {
+        size_t byte = bs->bit >> 3;
+        int room = 8 - (int)(bs->bit & 7);
+        int n = count < room ? count : room;
+        uint8_t chunk = (uint8_t)((value >> (count - n)) & ((1u << n) - 1));
+
+        if (room == 8) {
+            bs->buf[byte] = 0;
+        }
+        bs->buf[byte] |= (uint8_t)(chunk << (room - n));
+        bs->bit += n;
+        count -= n;
+    }
+}
+
+// Reads past the end return zero bits, callers check bits_left() first
+static uint64_t get_bits(bit_stream_t *bs, int count)
+{
+    uint64_t value = 0;
+
+    while (count > 0) {
+        size_t byte = bs->bit >> 3;
+        int room = 8 - (int)(bs->bit & 7);
+        int n = count < room ? count : room;
+        uint8_t in = byte < bs->size ? bs->buf[byte] : 0;
+
+        value = (value << n) | ((in >> (room - n)) & ((1u << n) - 1));
+        bs->bit += n;
+        count -= n;
+    }
+    return value;
+}
+
+static bool bits_left(const bit_stream_t *bs)
+{
+    return bs->bit < bs->size * 8;
+}
+
+// Previous sample of the node being coded
+typedef struct {
+    uint32_t key;
+    uint8_t quality;
+    uint64_t time_ms;
+    int64_t delta_ms;
+    uint64_t bits;
+    int leading;        // Zero window of the last meaningful XOR, -1 if none
+    int trailing;
+} series_state_t;
+
+// Delta of delta ranges: prefix, prefix length, value bits
+static const struct {
+    uint8_t prefix;
+    int prefix_bits;
+    int value_bits;
+} s_dod_classes[] = {
+    { 0x2, 2, 7 },
+    { 0x6, 3, 9 },
+    { 0xE, 4, 12 },
+};
+
+static void put_time(bit_stream_t *bs, series_state_t *st, uint64_t time_ms)
+{
+    int64_t delta = (int64_t)(time_ms - st->time_ms);
+    int64_t dod = delta - st->delta_ms;
+
+    if (dod == 0) {
+        put_bits(bs, 0, 1);
+    } else {
+        size_t i;
+        for (i = 0; i < sizeof(s_dod_classes) / sizeof(s_dod_classes[0]); i++) {
+            int64_t half = (int64_t)1 << (s_dod_classes[i].value_bits - 1);
+            if (dod >= 1 - half && dod <= half) {
+                put_bits(bs, s_dod_classes[i].prefix, s_dod_classes[i].prefix_bits);
+                put_bits(bs, (uint64_t)(dod + half - 1), s_dod_classes[i].value_bits);
+                break;
+            }
+        }
+        if (i == sizeof(s_dod_classes) / sizeof(s_dod_classes[0])) {
+            put_bits(bs, 0xF, 4);
+            put_bits(bs, (uint64_t)delta, 32);
+        }
+    }
+    st->delta_ms = delta;
+    st->time_ms = time_ms;
+}
+
+static void get_time(bit_stream_t *bs, series_state_t *st)
+{
+    int ones = 0;
+
+    while (ones < 4 && get_bits(bs, 1)) {
+        ones++;
+    }
+    if (ones == 4) {
+        st->delta_ms = (int64_t)get_bits(bs, 32);
+    } else if (ones > 0) {
+        int value_bits = s_dod_classes[ones - 1].value_bits;
+        int64_t half = (int64_t)1 << (value_bits - 1);
+        st->delta_ms += (int64_t)get_bits(bs, value_bits) - half + 1;
+    }
+    st->time_ms += st->delta_ms;
+}
+
+static void put_value(bit_stream_t *bs, series_state_t *st, uint64_t bits)
+{
+    uint64_t x = bits ^ st->bits;
+
+    st->bits = bits;
+    if (x == 0) {
+        put_bits(bs, 0, 1);
+        return;
+    }
+
+    int leading = __builtin_clzll(x);
+    int trailing = __builtin_ctzll(x);
+    if (leading > 31) {
+        leading = 31;
+    }
+
+    if (st->leading >= 0 && leading >= st->leading && trailing >= st->trailing) {
+        put_bits(bs, 0x2, 2);
+        put_bits(bs, x >> st->trailing, 64 - st->leading - st->trailing);
+        return;
+    }
+
+    int length = 64 - leading - trailing;
+    put_bits(bs, 0x3, 2);
+    put_bits(bs, leading, 5);
+    put_bits(bs, length - 1, 6);
+    put_bits(bs, x >> trailing, length);
+    st->leading = leading;
+    st->trailing = trailing;
+}
+
+// False if the stream asks for a window it never set
+static bool get_value(bit_stream_t *bs, series_state_t *st)
+{
+    if (!get_bits(bs, 1)) {
+        return true;
+    }
+    if (get_bits(bs, 1)) {
+        st->leading = (int)get_bits(bs, 5);
+        int length = (int)get_bits(bs, 6) + 1;
+        st->trailing = 64 - st->leading - length;
+    }
+    if (st->leading < 0 || st->trailing < 0) {
+        return false;
+    }
+    int length = 64 - st->leading - st->trailing;
+    st->bits ^= get_bits(bs, length) << st->trailing;
+    return true;
+}
+
+int history_encode_log(uint8_t *buf, size_t size, uint64_t base_ms,
+                       const history_sample_t *samples, int count, size_t *len)
+{
+    bit_stream_t bs = { buf, size, HISTORY_LOG_HEADER * 8 };
+    series_state_t st = { 0 };
+    int n;
+
+    for (n = 0; n < count && n < UINT16_MAX; n++) {
+        const history_sample_t *s = &samples[n];
+
+        if (bs.bit + HISTORY_SAMPLE_MAX_BITS > size * 8) {
+            break;
+        }
+        if (n == 0 || s->key != st.key) {
+            put_bits(&bs, 1, 1);
+            put_bits(&bs, s->key, 32);
+            put_bits(&bs, s->quality, 8);
+            put_bits(&bs, s->time_ms - base_ms, 32);
+            put_bits(&bs, value_bits(s->value), 64);
+            st.key = s->key;
+            st.quality = s->quality;
+            st.time_ms = s->time_ms;
+            st.delta_ms = 0;
+            st.bits = value_bits(s->value);
+            st.leading = -1;
+            continue;
+        }
+
+        put_bits(&bs, 0, 1);
+        put_time(&bs, &st, s->time_ms);
+        if (s->quality == st.quality) {
+            put_bits(&bs, 0, 1);
+        } else {
+            put_bits(&bs, 1, 1);
+            put_bits(&bs, s->quality, 8);
+            st.quality = s->quality;
+        }
+        put_value(&bs, &st, value_bits(s->value));
+    }
+
+    buf[0] = HISTORY_LOG_VERSION;
+    put_le(buf + 1, n, 2);
+    put_le(buf + 3, base_ms, 8);
+    *len = (bs.bit + 7) / 8;
+    return n;
+}
+
+bool history_decode_log(const uint8_t *buf, size_t len,
+                        void (*fn)(const history_sample_t *s, void *arg), void *arg)
+{
+    if (len >= 1 && buf[0] < HISTORY_LOG_VERSION) {
+        return true;    // Keyed by node position, nothing to match
+    }
+    if (len < HISTORY_LOG_HEADER || buf[0] != HISTORY_LOG_VERSION) {
+        return false;
+    }
+
+    int count = (int)get_le(buf + 1, 2);
+    uint64_t base_ms = get_le(buf + 3, 8);
+    // Only read through, the stream type is shared with the encoder
+    bit_stream_t bs = { (uint8_t *)buf, len, HISTORY_LOG_HEADER * 8 };
+    series_state_t st = { 0 };
+
+    for (int i = 0; i < count; i++) {
+        if (!bits_left(&bs)) {
+            return false;
+        }
+        if (get_bits(&bs, 1)) {
+            st.key = (uint32_t)get_bits(&bs, 32);
+            st.quality = (uint8_t)get_bits(&bs, 8);
+            st.time_ms = base_ms + get_bits(&bs, 32);
+            st.delta_ms = 0;
+            st.bits = get_bits(&bs, 64);
+            st.leading = -1;
+        } else {
+            if (i == 0) {
+                return false;
+            }
+            get_time(&bs, &st);
+            if (get_bits(&bs, 1)) {
+                st.quality = (uint8_t)get_bits(&bs, 8);
+            }
+            if (!get_value(&bs, &st)) {
+                return false;
+            }
+        }
+        if (bs.bit > len * 8) {
+            return false;
+        }
+
+        history_sample_t s = {
+            .key = st.key,
+            .quality = st.quality,
+            .time_ms = st.time_ms,
+            .value = bits_value(st.bits),
+        };
+        fn(&s, arg);
+    }
+    return true;
+}
@@ -0,0 +1,45 @@
+#ifndef HISTORY_CODEC_H
+#define HISTORY_CODEC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "historian.h"
+
+// One TSDB log holds the samples of one commit, or a part of it, sorted
+// by key and time and compressed per node the way Gorilla does:
+//   u8 HISTORY_LOG_VERSION, u16 count, u64 base time (ms), then a bit
+//   stream, most significant bit first, of count samples:
+//   '1' starts a node: u32 key, u8 quality, u32 time - base (ms),
+//       u64 IEEE 754 value bits
+//   '0' continues it:
+//       time, delta of the delta to the previous sample (ms):
+//         '0' 0 | '10' 7 bits | '110' 9 bits | '1110' 12 bits, biased
+//         | '1111' u32 delta itself
+//       quality: '0' unchanged | '1' u8 quality
+//       value, XOR with the previous one:
+//         '0' equal | '10' bits inside the previous leading/trailing zero
+//         window | '11' 5 bits leading zeros, 6 bits length - 1, the bits
+// Version 2 logs carried a u16 node id, the position of the node in
+// device_config; they cannot be mapped to keys and are skipped.
+#define HISTORY_LOG_VERSION 3
+#define HISTORY_LOG_HEADER 11
+
+// Longest encoded samples: a node start is 1 + 32 + 8 + 32 + 64 bits, a
+// continuation at most 1 + 36 (time) + 9 (quality) + 77 (value) bits
+#define HISTORY_START_BITS 137
+#define HISTORY_CONTINUE_MAX_BITS 123
+#define HISTORY_SAMPLE_MAX_BITS 144     // Room the encoder keeps for one more sample
+
+// Encode samples (sorted by key and time, all at or after base_ms and less
+// than 2^32 ms after it) into one log of at most size bytes, until it is
+// full. Returns how many samples went in and sets *len.
+int history_encode_log(uint8_t *buf, size_t size, uint64_t base_ms,
+                       const history_sample_t *samples, int count, size_t *len);
+
+// Decode a log, calling fn for every sample. Logs of an older version are
+// accepted without samples. False if it is malformed.
+bool history_decode_log(const uint8_t *buf, size_t len,
+                        void (*fn)(const history_sample_t *s, void *arg), void *arg);
+
+#endif // HISTORY_CODEC_H
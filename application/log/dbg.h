@@ -5,6 +5,7 @@
 #include <stdarg.h>
 #include "log_types.h"
 #include "log_buffer.h"
+#include "log_tag.h"
 
 // Default log level if not defined
 #ifndef DBG_LVL
@@ -16,20 +17,73 @@
 #define DBG_TAG "APP"
 #endif
 
+// Global compile-time floor (0 = error ... 3 = debug). Calls above it are
+// compiled out entirely, e.g. build with -DLOG_COMPILE_LEVEL=2 to drop debug.
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 3
+#endif
+
+// Runtime level of this file's tag, starts at DBG_LVL and can be changed
+// with log_tag_set_level()
+static log_tag_t dbg_log_tag = { DBG_TAG, DBG_LVL, DBG_LVL, NULL };
+
+__attribute__((constructor)) static void dbg_log_tag_register(void) {
+    log_tag_register(&dbg_log_tag);
+}
+
+#define LOG_ENABLED(lvl) \
+    ((int)(lvl) <= atomic_load_explicit(&dbg_log_tag.level, memory_order_relaxed))
+
 // Log macro that checks level and adds message to buffer
+#ifdef LOG_BINARY
+// Binary mode: fmt must be a string literal, it is formatted on the log thread
 #define LOG(level, fmt, ...) \
     do { \
-        if (level <= DBG_LVL) { \
+        if (LOG_ENABLED(level)) { \
+            log_buffer_add_fmt(DBG_TAG, level, __FILE__, __LINE__, fmt, ##__VA_ARGS__); \
+        } \
+    } while(0)
+#else
+#define LOG(level, fmt, ...) \
+    do { \
+        if (LOG_ENABLED(level)) { \
             char msg[LOG_BUFFER_SIZE]; \
             snprintf(msg, sizeof(msg), fmt, ##__VA_ARGS__); \
             log_buffer_add(DBG_TAG, level, msg, __FILE__, __LINE__); \
         } \
     } while(0)
+#endif
+
+// Compiled-out call: keeps the format checked and the arguments referenced
+static inline __attribute__((format(printf, 1, 2))) void dbg_discard(const char *fmt, ...) {
+    (void)fmt;
+}
+#define LOG_DISCARD(fmt, ...) \
+    do { \
+        if (0) { \
+            dbg_discard(fmt, ##__VA_ARGS__); \
+        } \
+    } while(0)
 
 // Convenience macros for different log levels
 #define DBG_ERROR(fmt, ...) LOG(LOG_ERROR, fmt, ##__VA_ARGS__)
+
+#if LOG_COMPILE_LEVEL >= 1
 #define DBG_WARN(fmt, ...)  LOG(LOG_WARN, fmt, ##__VA_ARGS__)
+#else
+#define DBG_WARN(fmt, ...)  LOG_DISCARD(fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL >= 2
 #define DBG_INFO(fmt, ...)  LOG(LOG_INFO, fmt, ##__VA_ARGS__)
+#else
+#define DBG_INFO(fmt, ...)  LOG_DISCARD(fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL >= 3
 #define DBG_DEBUG(fmt, ...) LOG(LOG_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define DBG_DEBUG(fmt, ...) LOG_DISCARD(fmt, ##__VA_ARGS__)
+#endif
 
 #endif // DBG_H
@@ -0,0 +1,400 @@
+#include "log_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/types.h>
+
+// Packed layout, in format order: an int for every '*' width or precision,
+// then the value itself. Integers are widened to 64 bit so the consumer can
+// print them with an "ll" conversion, floating point values are stored as
+// double, strings are copied inline including the terminator because the
+// caller's buffer is gone by the time the log thread formats the entry.
+typedef enum {
+    ARG_NONE = 0,   // %% or an unsupported conversion
+    ARG_SIGNED,
+    ARG_UNSIGNED,
+    ARG_CHAR,
+    ARG_DOUBLE,
+    ARG_STRING,
+    ARG_POINTER,
+    ARG_ERRNO       // %m, stored as the errno string at the call site
+} arg_type_t;
+
+typedef enum {
+    LEN_NONE = 0,
+    LEN_HH,
+    LEN_H,
+    LEN_L,
+    LEN_LL,
+    LEN_BIG_L,
+    LEN_Z,
+    LEN_J,
+    LEN_T
+} arg_length_t;
+
+typedef struct {
+    const char *flags;      // Points into the format string
+    int flags_len;
+    const char *width;      // Digits, or NULL when absent or '*'
+    int width_len;
+    int width_star;
+    int has_precision;
+    const char *precision;
+    int precision_len;
+    int precision_star;
+    arg_length_t length;
+    char conversion;
+    arg_type_t type;
+} arg_spec_t;
+
+// Parse a conversion specification, p points just past the '%'
+static const char *parse_spec(const char *p, arg_spec_t *spec) {
+    memset(spec, 0, sizeof(*spec));
+
+    spec->flags = p;
+    while (*p && strchr("-+ #0'", *p)) p++;
+    spec->flags_len = p - spec->flags;
+
+    if (*p == '*') {
+        spec->width_star = 1;
+        p++;
+    } else {
+        spec->width = p;
+        while (*p >= '0' && *p <= '9') p++;
+        spec->width_len = p - spec->width;
+    }
+
+    if (*p == '.') {
+        spec->has_precision = 1;
+        p++;
+        if (*p == '*') {
+            spec->precision_star = 1;
+            p++;
+        } else {
+            spec->precision = p;
+            while (*p >= '0' && *p <= '9') p++;
+            spec->precision_len = p - spec->precision;
+        }
+    }
+
+    switch (*p) {
+        case 'h':
+            p++;
+            spec->length = LEN_H;
+            if (*p == 'h') {
+                spec->length = LEN_HH;
+                p++;
+            }
+            break;
+        case 'l':
+            p++;
+            spec->length = LEN_L;
+            if (*p == 'l') {
+                spec->length = LEN_LL;
+                p++;
+            }
+            break;
+        case 'L': spec->length = LEN_BIG_L; p++; break;
+        case 'z': spec->length = LEN_Z; p++; break;
+        case 'j': spec->length = LEN_J; p++; break;
+        case 't': spec->length = LEN_T; p++; break;
+        default: break;
+    }
+
+    spec->conversion = *p;
+    switch (*p) {
+        case 'd': case 'i':
+            spec->type = ARG_SIGNED;
+            break;
+        case 'u': case 'o': case 'x': case 'X':
+            spec->type = ARG_UNSIGNED;
+            break;
+        case 'c':
+            spec->type = ARG_CHAR;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            spec->type = ARG_DOUBLE;
+            break;
+        case 's':
+            spec->type = ARG_STRING;
+            break;
+        case 'p': case 'n':
+            spec->type = ARG_POINTER;
+            break;
+        case 'm':
+            spec->type = ARG_ERRNO;
+            break;
+        default:
+            spec->type = ARG_NONE;
+            break;
+    }
+
+    return *p ? p + 1 : p;
+}
+
+static int put_bytes(uint8_t *buf, size_t size, size_t *used, const void *data, size_t len) {
+    if (*used + len > size) {
+        return 0;
+    }
+    memcpy(buf + *used, data, len);
+    *used += len;
+    return 1;
+}
+
+static int get_bytes(const uint8_t *args, size_t args_len, size_t *offset, void *data, size_t len) {
+    if (*offset + len > args_len) {
+        return 0;
+    }
+    memcpy(data, args + *offset, len);
+    *offset += len;
+    return 1;
+}
+
+// Store a string inline, truncating it to the space left
+static int put_string(uint8_t *buf, size_t size, size_t *used, const char *s, size_t max_len) {
+    if (!s) {
+        s = "(null)";
+    }
+    if (*used >= size) {
+        return 0;
+    }
+
+    size_t len = strnlen(s, max_len);
+    int complete = 1;
+    if (len + 1 > size - *used) {
+        len = size - *used - 1;
+        complete = 0;
+    }
+    memcpy(buf + *used, s, len);
+    buf[*used + len] = '\0';
+    *used += len + 1;
+    return complete;
+}
+
+static int64_t read_signed(va_list *ap, arg_length_t length) {
+    switch (length) {
+        case LEN_HH: return (signed char)va_arg(*ap, int);
+        case LEN_H: return (short)va_arg(*ap, int);
+        case LEN_L: return va_arg(*ap, long);
+        case LEN_LL: return va_arg(*ap, long long);
+        case LEN_Z: return va_arg(*ap, ssize_t);
+        case LEN_J: return va_arg(*ap, intmax_t);
+        case LEN_T: return va_arg(*ap, ptrdiff_t);
+        default: return va_arg(*ap, int);
+    }
+}
+
+static uint64_t read_unsigned(va_list *ap, arg_length_t length) {
+    switch (length) {
+        case LEN_HH: return (unsigned char)va_arg(*ap, unsigned int);
+        case LEN_H: return (unsigned short)va_arg(*ap, unsigned int);
+        case LEN_L: return va_arg(*ap, unsigned long);
+        case LEN_LL: return va_arg(*ap, unsigned long long);
+        case LEN_Z: return va_arg(*ap, size_t);
+        case LEN_J: return va_arg(*ap, uintmax_t);
+        case LEN_T: return va_arg(*ap, ptrdiff_t);
+        default: return va_arg(*ap, unsigned int);
+    }
+}
+
+size_t log_args_pack(uint8_t *buf, size_t size, const char *fmt, va_list ap) {
+    size_t used = 0;
+    const char *p = fmt;
+    va_list args;
+
+    if (!buf || !fmt) return 0;
+
+    va_copy(args, ap);
+    while ((p = strchr(p, '%')) != NULL) {
+        arg_spec_t spec;
+        int precision = -1;
+
+        p = parse_spec(p + 1, &spec);
+
+        if (spec.width_star) {
+            int width = va_arg(args, int);
+            if (!put_bytes(buf, size, &used, &width, sizeof(width))) break;
+        }
+        if (spec.precision_star) {
+            precision = va_arg(args, int);
+            if (!put_bytes(buf, size, &used, &precision, sizeof(precision))) break;
+        } else if (spec.has_precision) {
+            precision = 0;
+            for (int i = 0; i < spec.precision_len; i++) {
+                precision = precision * 10 + (spec.precision[i] - '0');
+            }
+        }
+
+        int ok = 1;
+        switch (spec.type) {
+            case ARG_SIGNED: {
+                int64_t value = read_signed(&args, spec.length);
+                ok = put_bytes(buf, size, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_UNSIGNED: {
+                uint64_t value = read_unsigned(&args, spec.length);
+                ok = put_bytes(buf, size, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_CHAR: {
+                int value = va_arg(args, int);
+                ok = put_bytes(buf, size, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_DOUBLE: {
+                double value = spec.length == LEN_BIG_L ? (double)va_arg(args, long double)
+                                                        : va_arg(args, double);
+                ok = put_bytes(buf, size, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_STRING: {
+                const char *s = va_arg(args, const char *);
+                ok = put_string(buf, size, &used, s, precision >= 0 ? (size_t)precision : size);
+                break;
+            }
+            case ARG_POINTER: {
+                uint64_t value = (uintptr_t)va_arg(args, void *);
+                ok = put_bytes(buf, size, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_ERRNO:
+                ok = put_string(buf, size, &used, strerror(errno), size);
+                break;
+            default:
+                break;
+        }
+        if (!ok) break;
+    }
+    va_end(args);
+
+    return used;
+}
+
+// Append printf output at *pos, keeping the output terminated
+#define APPEND(output, size, pos, ...) \
+    do { \
+        if (*(pos) + 1 < (size)) { \
+            int n = snprintf((output) + *(pos), (size) - *(pos), __VA_ARGS__); \
+            if (n > 0) { \
+                *(pos) += (size_t)n < (size) - *(pos) ? (size_t)n : (size) - *(pos) - 1; \
+            } \
+        } \
+    } while (0)
+
+// Rebuild the specification with '*' resolved and our own length modifier
+static void build_spec(char *out, size_t size, const arg_spec_t *spec, int width, int precision,
+                       const char *length, char conversion) {
+    size_t pos = 0;
+
+    APPEND(out, size, &pos, "%%%.*s", spec->flags_len, spec->flags);
+    if (spec->width_star) {
+        APPEND(out, size, &pos, "%d", width);
+    } else if (spec->width_len > 0) {
+        APPEND(out, size, &pos, "%.*s", spec->width_len, spec->width);
+    }
+    if (spec->has_precision) {
+        APPEND(out, size, &pos, ".%d", precision);
+    }
+    APPEND(out, size, &pos, "%s%c", length, conversion);
+}
+
+void log_args_format(char *output, size_t output_size, const char *fmt,
+                     const uint8_t *args, size_t args_len) {
+    size_t pos = 0;
+    size_t offset = 0;
+    const char *p = fmt;
+
+    if (!output || output_size == 0) return;
+    output[0] = '\0';
+    if (!fmt) return;
+
+    while (*p) {
+        const char *percent = strchr(p, '%');
+        if (!percent) {
+            APPEND(output, output_size, &pos, "%s", p);
+            break;
+        }
+        APPEND(output, output_size, &pos, "%.*s", (int)(percent - p), p);
+
+        arg_spec_t spec;
+        int width = 0;
+        int precision = 0;
+        char spec_fmt[48];
+
+        p = parse_spec(percent + 1, &spec);
+
+        if (spec.conversion == '%') {
+            APPEND(output, output_size, &pos, "%%");
+            continue;
+        }
+        if (spec.width_star && !get_bytes(args, args_len, &offset, &width, sizeof(width))) {
+            goto truncated;
+        }
+        if (spec.precision_star) {
+            if (!get_bytes(args, args_len, &offset, &precision, sizeof(precision))) goto truncated;
+        } else if (spec.has_precision) {
+            for (int i = 0; i < spec.precision_len; i++) {
+                precision = precision * 10 + (spec.precision[i] - '0');
+            }
+        }
+
+        switch (spec.type) {
+            case ARG_SIGNED: {
+                int64_t value;
+                if (!get_bytes(args, args_len, &offset, &value, sizeof(value))) goto truncated;
+                build_spec(spec_fmt, sizeof(spec_fmt), &spec, width, precision, "ll", spec.conversion);
+                APPEND(output, output_size, &pos, spec_fmt, (long long)value);
+                break;
+            }
+            case ARG_UNSIGNED: {
+                uint64_t value;
+                if (!get_bytes(args, args_len, &offset, &value, sizeof(value))) goto truncated;
+                build_spec(spec_fmt, sizeof(spec_fmt), &spec, width, precision, "ll", spec.conversion);
+                APPEND(output, output_size, &pos, spec_fmt, (unsigned long long)value);
+                break;
+            }
+            case ARG_CHAR: {
+                int value;
+                if (!get_bytes(args, args_len, &offset, &value, sizeof(value))) goto truncated;
+                build_spec(spec_fmt, sizeof(spec_fmt), &spec, width, precision, "", 'c');
+                APPEND(output, output_size, &pos, spec_fmt, value);
+                break;
+            }
+            case ARG_DOUBLE: {
+                double value;
+                if (!get_bytes(args, args_len, &offset, &value, sizeof(value))) goto truncated;
+                build_spec(spec_fmt, sizeof(spec_fmt), &spec, width, precision, "", spec.conversion);
+                APPEND(output, output_size, &pos, spec_fmt, value);
+                break;
+            }
+            case ARG_STRING:
+            case ARG_ERRNO: {
+                if (offset >= args_len) goto truncated;
+                const char *s = (const char *)args + offset;
+                size_t len = strnlen(s, args_len - offset);
+                if (len == args_len - offset) goto truncated;   // No terminator
+                offset += len + 1;
+                build_spec(spec_fmt, sizeof(spec_fmt), &spec, width, precision, "", 's');
+                APPEND(output, output_size, &pos, spec_fmt, s);
+                break;
+            }
+            case ARG_POINTER: {
+                uint64_t value;
+                if (!get_bytes(args, args_len, &offset, &value, sizeof(value))) goto truncated;
+                if (spec.conversion == 'p') {
+                    build_spec(spec_fmt, sizeof(spec_fmt), &spec, width, precision, "", 'p');
+                    APPEND(output, output_size, &pos, spec_fmt, (void *)(uintptr_t)value);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return;
+
+truncated:
+    // The producer ran out of argument space, mark where the message was cut
+    APPEND(output, output_size, &pos, "...");
+}
@@ -0,0 +1,16 @@
+#ifndef LOG_ARGS_H
+#define LOG_ARGS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+
+// Copy the arguments described by fmt into buf as raw bytes (integers as
+// 64 bit, floating point as double, strings inline). Returns bytes used.
+size_t log_args_pack(uint8_t *buf, size_t size, const char *fmt, va_list ap);
+
+// Format fmt with arguments previously packed by log_args_pack()
+void log_args_format(char *output, size_t output_size, const char *fmt,
+                     const uint8_t *args, size_t args_len);
+
+#endif // LOG_ARGS_H
@@ -1,94 +1,269 @@
 #include "log_buffer.h"
 #include <string.h>
 #include <time.h>
-#include <pthread.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <poll.h>
+#include <errno.h>
+#include <sys/eventfd.h>
+#ifdef LOG_BINARY
+#include "log_args.h"
+#endif
+
+// Lock-free multi-producer/single-consumer ring. Each slot carries a sequence
+// number: a producer may fill the slot for position pos when sequence == pos,
+// and publishes it by setting sequence = pos + 1. The consumer releases the
+// slot for the next lap by setting sequence = pos + LOG_BUFFER_COUNT.
+// Sequences are stored relative to the slot index so that the zero-initialized
+// ring is already valid and logging works before log_buffer_init() runs.
+#define LOG_BUFFER_MASK (LOG_BUFFER_COUNT - 1)
+
+_Static_assert((LOG_BUFFER_COUNT & LOG_BUFFER_MASK) == 0, "LOG_BUFFER_COUNT must be a power of two");
+
+#ifdef LOG_BINARY
+// Deferred entry: only pointers to string literals and the raw arguments
+typedef struct {
+    const char *tag;
+    const char *file;
+    const char *fmt;
+    log_level_t level;
+    int line;
+    time_t timestamp;
+    uint16_t args_len;
+    uint8_t args[LOG_ARGS_SIZE];
+} log_record_t;
+#endif
 
-// Log buffer structure
 typedef struct {
-    log_entry_t entries[LOG_BUFFER_COUNT];
-    int head;
-    int tail;
-    int count;
-    bool is_full;
-} log_buffer_t;
+    atomic_size_t sequence;
+#ifdef LOG_BINARY
+    log_record_t record;
+#else
+    log_entry_t entry;
+#endif
+} log_slot_t;
+
+static log_slot_t g_slots[LOG_BUFFER_COUNT];
+static atomic_size_t g_enqueue_pos;
+static atomic_size_t g_dequeue_pos;   // Only advanced by the consumer
+static atomic_uint g_dropped;
+
+// Wakeup for the consumer: it sets g_consumer_waiting before blocking on the
+// eventfd, and the producer that publishes into the empty ring clears the flag
+// and signals. While the consumer is busy draining producers never touch it.
+static int g_event_fd = -1;
+static atomic_bool g_consumer_waiting;
+
+// Copy a string up to its terminator instead of padding the whole field
+static void copy_string(char *dst, const char *src, size_t size) {
+    size_t len = strnlen(src, size - 1);
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+static inline size_t slot_sequence(log_slot_t *slot, size_t index) {
+    return atomic_load_explicit(&slot->sequence, memory_order_acquire) + index;
+}
 
-static log_buffer_t g_log_buffer;
-static pthread_mutex_t g_buffer_mutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void set_slot_sequence(log_slot_t *slot, size_t index, size_t seq) {
+    atomic_store_explicit(&slot->sequence, seq - index, memory_order_release);
+}
 
 void log_buffer_init(void) {
-    pthread_mutex_lock(&g_buffer_mutex);
-    memset(&g_log_buffer, 0, sizeof(log_buffer_t));
-    g_log_buffer.head = 0;
-    g_log_buffer.tail = 0;
-    g_log_buffer.count = 0;
-    g_log_buffer.is_full = false;
-    pthread_mutex_unlock(&g_buffer_mutex);
+    // The ring is valid from static initialization, only reset the statistics
+    atomic_store_explicit(&g_dropped, 0, memory_order_relaxed);
+
+    if (g_event_fd < 0) {
+        g_event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    }
+}
+
+// Claim the slot for the next position, NULL when the ring is full
+static log_slot_t *claim_slot(size_t *claimed) {
+    size_t pos = atomic_load_explicit(&g_enqueue_pos, memory_order_relaxed);
+    log_slot_t *slot;
+
+    while (1) {
+        slot = &g_slots[pos & LOG_BUFFER_MASK];
+        size_t seq = slot_sequence(slot, pos & LOG_BUFFER_MASK);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&g_enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                *claimed = pos;
+                return slot;
+            }
+        } else if (diff < 0) {
+            // Ring is full: the consumer has not released this slot yet
+            atomic_fetch_add_explicit(&g_dropped, 1, memory_order_relaxed);
+            return NULL;
+        } else {
+            pos = atomic_load_explicit(&g_enqueue_pos, memory_order_relaxed);
+        }
+    }
+}
+
+// Publish a filled slot to the consumer, waking it if it is blocked
+static void publish_slot(log_slot_t *slot, size_t pos) {
+    set_slot_sequence(slot, pos & LOG_BUFFER_MASK, pos + 1);
+
+    // Pairs with the fence in log_buffer_wait(): either the consumer sees this
+    // entry before sleeping or we see that it is waiting
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&g_consumer_waiting, memory_order_relaxed) &&
+        atomic_exchange_explicit(&g_consumer_waiting, false, memory_order_relaxed)) {
+        uint64_t one = 1;
+        if (g_event_fd >= 0) {
+            (void)write(g_event_fd, &one, sizeof(one));
+        }
+    }
+}
+
+#ifdef LOG_BINARY
+static void add_record(const char* tag, log_level_t level, const char* file, int line,
+                       const char* fmt, va_list args) {
+    size_t pos;
+    log_slot_t *slot = claim_slot(&pos);
+    if (!slot) {
+        return;
+    }
+
+    log_record_t *record = &slot->record;
+    record->tag = tag;
+    record->file = file;
+    record->fmt = fmt;
+    record->level = level;
+    record->line = line;
+    record->timestamp = time(NULL);
+    record->args_len = log_args_pack(record->args, sizeof(record->args), fmt, args);
+
+    publish_slot(slot, pos);
+}
+
+static void add_message(const char* tag, log_level_t level, const char* file, int line, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    add_record(tag, level, file, line, fmt, args);
+    va_end(args);
 }
 
 void log_buffer_add(const char* tag, log_level_t level, const char* message, const char* file, int line) {
-    pthread_mutex_lock(&g_buffer_mutex);
-    
-    // Get current timestamp
-    time_t now;
-    time(&now);
-    
-    // Create new entry
-    log_entry_t* entry = &g_log_buffer.entries[g_log_buffer.head];
-    strncpy(entry->tag, tag, sizeof(entry->tag) - 1);
+    // Preformatted text is stored as a single string argument
+    add_message(tag, level, file, line, "%s", message);
+}
+
+void log_buffer_add_fmt(const char* tag, log_level_t level, const char* file, int line, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    add_record(tag, level, file, line, fmt, args);
+    va_end(args);
+}
+#else
+void log_buffer_add(const char* tag, log_level_t level, const char* message, const char* file, int line) {
+    size_t pos;
+    log_slot_t *slot = claim_slot(&pos);
+    if (!slot) {
+        return;
+    }
+
+    // Fill the entry
+    log_entry_t* entry = &slot->entry;
+    copy_string(entry->tag, tag, sizeof(entry->tag));
     entry->level = level;
-    strncpy(entry->message, message, sizeof(entry->message) - 1);
-    strncpy(entry->file, file, sizeof(entry->file) - 1);
+    copy_string(entry->message, message, sizeof(entry->message));
+    copy_string(entry->file, file, sizeof(entry->file));
     entry->line = line;
-    entry->timestamp = now;
-    
-    // Update buffer indices
-    g_log_buffer.head = (g_log_buffer.head + 1) % LOG_BUFFER_COUNT;
-    if (g_log_buffer.count < LOG_BUFFER_COUNT) {
-        g_log_buffer.count++;
-    } else {
-        g_log_buffer.is_full = true;
-        g_log_buffer.tail = g_log_buffer.head;
-    }
-    
-    pthread_mutex_unlock(&g_buffer_mutex);
+    entry->timestamp = time(NULL);
+
+    publish_slot(slot, pos);
 }
 
+void log_buffer_add_fmt(const char* tag, log_level_t level, const char* file, int line, const char* fmt, ...) {
+    char message[LOG_BUFFER_SIZE];
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(message, sizeof(message), fmt, args);
+    va_end(args);
+    log_buffer_add(tag, level, message, file, line);
+}
+#endif
+
+// Must only be called from the single consumer (the log output thread)
 int log_buffer_get(log_entry_t* entry) {
-    int success = 0;
-    
-    pthread_mutex_lock(&g_buffer_mutex);
-    
-    if (g_log_buffer.count > 0) {
-        // Copy entry to provided buffer
-        memcpy(entry, &g_log_buffer.entries[g_log_buffer.tail], sizeof(log_entry_t));
-        
-        // Update buffer indices
-        g_log_buffer.tail = (g_log_buffer.tail + 1) % LOG_BUFFER_COUNT;
-        g_log_buffer.count--;
-        g_log_buffer.is_full = false;
-        
-        success = 1;
+    size_t pos = atomic_load_explicit(&g_dequeue_pos, memory_order_relaxed);
+    log_slot_t *slot = &g_slots[pos & LOG_BUFFER_MASK];
+
+    if (slot_sequence(slot, pos & LOG_BUFFER_MASK) != pos + 1) {
+        return 0;  // Empty, or the next producer has not finished writing
     }
-    
-    pthread_mutex_unlock(&g_buffer_mutex);
-    return success;
+
+#ifdef LOG_BINARY
+    // Formatting happens here, on the log output thread
+    log_record_t *record = &slot->record;
+    copy_string(entry->tag, record->tag, sizeof(entry->tag));
+    entry->level = record->level;
+    log_args_format(entry->message, sizeof(entry->message), record->fmt, record->args, record->args_len);
+    copy_string(entry->file, record->file, sizeof(entry->file));
+    entry->line = record->line;
+    entry->timestamp = record->timestamp;
+#else
+    memcpy(entry, &slot->entry, sizeof(log_entry_t));
+#endif
+
+    set_slot_sequence(slot, pos & LOG_BUFFER_MASK, pos + LOG_BUFFER_COUNT);
+    atomic_store_explicit(&g_dequeue_pos, pos + 1, memory_order_relaxed);
+    return 1;
 }
 
-void log_buffer_clear(void) {
-    pthread_mutex_lock(&g_buffer_mutex);
-    memset(&g_log_buffer, 0, sizeof(log_buffer_t));
-    g_log_buffer.head = 0;
-    g_log_buffer.tail = 0;
-    g_log_buffer.count = 0;
-    g_log_buffer.is_full = false;
-    pthread_mutex_unlock(&g_buffer_mutex);
+// True when the next entry has been published
+static bool entry_ready(void) {
+    size_t pos = atomic_load_explicit(&g_dequeue_pos, memory_order_relaxed);
+    return slot_sequence(&g_slots[pos & LOG_BUFFER_MASK], pos & LOG_BUFFER_MASK) == pos + 1;
+}
+
+// Must only be called from the single consumer
+int log_buffer_wait(int timeout_ms) {
+    if (entry_ready()) {
+        return 1;
+    }
+    if (g_event_fd < 0) {
+        // log_buffer_init() has not run or eventfd failed, avoid spinning
+        poll(NULL, 0, timeout_ms < 0 ? 20 : timeout_ms);
+        return entry_ready() ? 1 : 0;
+    }
+
+    atomic_store_explicit(&g_consumer_waiting, true, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (entry_ready()) {
+        atomic_store_explicit(&g_consumer_waiting, false, memory_order_relaxed);
+        return 1;
+    }
+
+    struct pollfd pfd = { .fd = g_event_fd, .events = POLLIN };
+    int ret;
+    do {
+        ret = poll(&pfd, 1, timeout_ms);
+    } while (ret < 0 && errno == EINTR);
+    atomic_store_explicit(&g_consumer_waiting, false, memory_order_relaxed);
+
+    if (ret > 0) {
+        uint64_t count;
+        (void)read(g_event_fd, &count, sizeof(count));
+    }
+    return entry_ready() ? 1 : 0;
 }
 
 int log_buffer_count(void) {
-    int count;
-    pthread_mutex_lock(&g_buffer_mutex);
-    count = g_log_buffer.count;
-    pthread_mutex_unlock(&g_buffer_mutex);
-    return count;
-} 
\ No newline at end of file
+    size_t head = atomic_load_explicit(&g_enqueue_pos, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&g_dequeue_pos, memory_order_relaxed);
+    return head > tail ? (int)(head - tail) : 0;
+}
+
+uint32_t log_buffer_dropped(void) {
+    return atomic_load_explicit(&g_dropped, memory_order_relaxed);
+}
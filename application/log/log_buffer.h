@@ -6,7 +6,12 @@
 #include "log_types.h"
 
 #define LOG_BUFFER_SIZE 256
-#define LOG_BUFFER_COUNT 1000
+#define LOG_BUFFER_COUNT 1024  // Must be a power of two
+
+// Build with -DLOG_BINARY to defer formatting to the log output thread.
+// Producers then store the format pointer and the raw argument bytes, so the
+// tag, file and format passed in must be string literals.
+#define LOG_ARGS_SIZE 192
 
 typedef struct {
     char tag[32];
@@ -23,7 +28,22 @@ void log_buffer_init(void);
 // Add a log entry to the buffer
 void log_buffer_add(const char* tag, log_level_t level, const char* message, const char* file, int line);
 
-// Get the next log entry from the buffer
+// Add a log entry from a printf style format. In binary mode the arguments
+// are packed and formatted later by log_buffer_get().
+void log_buffer_add_fmt(const char* tag, log_level_t level, const char* file, int line, const char* fmt, ...)
+    __attribute__((format(printf, 5, 6)));
+
+// Get the next log entry from the buffer (single consumer only)
 int log_buffer_get(log_entry_t* entry);
 
+// Block until an entry is available or timeout_ms elapses (-1 waits forever).
+// Returns 1 when an entry is ready (single consumer only).
+int log_buffer_wait(int timeout_ms);
+
+// Number of entries waiting in the buffer
+int log_buffer_count(void);
+
+// Number of entries dropped because the buffer was full
+uint32_t log_buffer_dropped(void);
+
 #endif // LOG_BUFFER_H 
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "log_output.h"
+#include "log_sink.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include "serial.h"
@@ -11,34 +13,20 @@
 #include "net.h"
 #include "websocket.h"
 #include "cJSON.h"
+#include "config.h"
 
 // Static buffers to avoid stack allocations
-static char g_time_str[20];
-static char g_output_buffer[LOG_BUFFER_SIZE];
+static log_arena_t g_arena;
 static pthread_mutex_t g_output_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 static uint32_t g_output_types = LOG_OUTPUT_STDOUT;  // Always enable stdout by default
 static int g_serial_fd = -1;
 
-// Log level strings - using array for O(1) lookup
-static const char* const level_strings[] = {
-    [LOG_ERROR] = "E",
-    [LOG_WARN]  = "W",
-    [LOG_INFO]  = "I",
-    [LOG_DEBUG] = "D"
-};
-
-// Optimized timestamp formatting
-static void format_timestamp(time_t timestamp) {
-    struct tm* tm_info = localtime(&timestamp);
-    strftime(g_time_str, sizeof(g_time_str), "%Y-%m-%d %H:%M:%S", tm_info);
-}
+// Flush statistics, protected by g_output_mutex
+static log_output_stats_t g_stats;
 
-// Optimized filename extraction
-static const char* get_filename(const char* filepath) {
-    const char* filename = strrchr(filepath, '/');
-    return filename ? filename + 1 : filepath;
-}
+// Websocket frames must fit a single mg_wakeup() datagram
+#define LOG_WS_FRAME_MAX 4096
 
 void log_output_init(uint32_t output_types) {
     pthread_mutex_lock(&g_output_mutex);
@@ -48,7 +36,7 @@ void log_output_init(uint32_t output_types) {
     
     // Add additional outputs
     if (output_types & LOG_OUTPUT_SERIAL) {
-        g_serial_fd = serial_open("/dev/ttyUSB0", 115200);
+        g_serial_fd = serial_open("/dev/ttyUSB0", 115200, 'N');
         if (g_serial_fd >= 0) {
             g_output_types |= LOG_OUTPUT_SERIAL;
         }
@@ -65,7 +53,7 @@ void log_output_add(uint32_t type) {
     pthread_mutex_lock(&g_output_mutex);
     
     if (type == LOG_OUTPUT_SERIAL) {
-        g_serial_fd = serial_open("/dev/ttyUSB0", 115200);
+        g_serial_fd = serial_open("/dev/ttyUSB0", 115200, 'N');
         if (g_serial_fd >= 0) {
             g_output_types |= type;
         }
@@ -92,62 +80,74 @@ void log_output_format_entry(const log_entry_t* entry, char* output, size_t outp
     if (!entry || !output || output_size < LOG_BUFFER_SIZE) {
         return;
     }
+    log_sink_format(entry, output, output_size);
+}
 
-    // Format timestamp once
-    format_timestamp(entry->timestamp);
-    
-    // Get filename (optimized)
-    const char* filename = get_filename(entry->file);
-    
-    // Format log entry with bounds checking
-    int written = snprintf(output, output_size, 
-        "[%s] [%s/%s] [%s:%d] %s\n",
-        g_time_str,
-        level_strings[entry->level],
-        entry->tag,
-        filename,
-        entry->line,
-        entry->message);
-        
-    if (written < 0 || written >= output_size) {
-        // Truncate message if buffer is too small
-        output[output_size - 1] = '\n';
-        output[output_size - 2] = '.';
-        output[output_size - 3] = '.';
-        output[output_size - 4] = '.';
+// Send the batch as few websocket frames as possible, split on line
+// boundaries. Lines are joined with '\n', the arena is modified in place.
+static void send_websocket_batch(log_arena_t *arena) {
+    char *start = arena->data;
+    char *end = arena->data + arena->len;
+
+    while (start < end) {
+        // Always take at least one line, then add lines while they fit
+        char *chunk_end = memchr(start, '\n', end - start);
+        chunk_end = chunk_end ? chunk_end + 1 : end;
+        while (chunk_end < end) {
+            char *nl = memchr(chunk_end, '\n', end - chunk_end);
+            if (!nl || nl + 1 - start > LOG_WS_FRAME_MAX) {
+                break;
+            }
+            chunk_end = nl + 1;
+        }
+        chunk_end[-1] = '\0';
+        websocket_log_send(start);
+        start = chunk_end;
     }
 }
 
 void log_output_process(void) {
-    log_entry_t entry;
-    
-    while (log_buffer_get(&entry)) {
-        // Format log entry using static buffer
-        log_output_format_entry(&entry, g_output_buffer, sizeof(g_output_buffer));
-        
-        // Always output to stdout
-        printf("%s", g_output_buffer);
-        
-        // Output to additional destinations with mutex protection
-        pthread_mutex_lock(&g_output_mutex);
-        
-        if ((g_output_types & LOG_OUTPUT_SERIAL) && g_serial_fd >= 0) {
-            // serial_write(g_serial_fd, g_output_buffer, strlen(g_output_buffer));
-        }
-        
-        if (g_output_types & LOG_OUTPUT_WEBSOCKET) {
-            // WebSocket output will be handled by the web server
-            // This is just a placeholder for future implementation
-            // Send log message to web thread for websocket broadcast
-            g_output_buffer[strlen(g_output_buffer) - 1] = '\0';
-            websocket_log_send(g_output_buffer);
-        }
-        
-        pthread_mutex_unlock(&g_output_mutex);
+    // Sleep until a producer publishes into the empty ring
+    if (!log_buffer_wait(-1)) {
+        return;
     }
-    
-    // Sleep for 20ms to prevent busy-waiting
-    usleep(20 * 1000);  // 20ms = 20,000 microseconds
+
+    // Format a batch into one contiguous arena
+    int count = log_sink_fill(&g_arena);
+    if (count == 0) {
+        return;
+    }
+
+    // One write per sink and one websocket message for the whole batch
+    pthread_mutex_lock(&g_output_mutex);
+
+    log_sink_write(STDOUT_FILENO, g_arena.data, g_arena.len);
+
+    if ((g_output_types & LOG_OUTPUT_SERIAL) && g_serial_fd >= 0) {
+        log_sink_write(g_serial_fd, g_arena.data, g_arena.len);
+    }
+
+    if (g_output_types & LOG_OUTPUT_WEBSOCKET) {
+        send_websocket_batch(&g_arena);
+    }
+
+    g_stats.flushes++;
+    g_stats.entries += count;
+    if ((uint32_t)count > g_stats.max_batch) {
+        g_stats.max_batch = count;
+    }
+
+    pthread_mutex_unlock(&g_output_mutex);
+}
+
+void log_output_get_stats(log_output_stats_t *stats) {
+    if (!stats) return;
+
+    pthread_mutex_lock(&g_output_mutex);
+    *stats = g_stats;
+    pthread_mutex_unlock(&g_output_mutex);
+    stats->dropped = log_buffer_dropped();
+    stats->pending = log_buffer_count();
 }
 
 static void *log_thread_func(void* arg) {
@@ -158,33 +158,54 @@ static void *log_thread_func(void* arg) {
 }
 
 int get_log_method(void) {
-    char json_str[1024] = {0};
-    int log_method = 0;  // Default log method
-    
-    // Read JSON string from database
-    int read_len = db_read("system_config", json_str, sizeof(json_str));
-    if (read_len <= 0) {
-        DBG_ERROR("Failed to read system config from database");
-        return log_method;  // Return default method
-    }
+    const config_t *cfg = config_acquire();
+    int log_method = cfg ? cfg->log_method : 0;
+    config_release();
+    return log_method;
+}
+
+// Apply the "logLevels" object of a system config JSON string,
+// e.g. {"logLevels":{"RTU_MASTER":3,"SERIAL":1}}. Tags not listed are reset.
+void apply_log_levels_json(const char *json_str) {
+    if (!json_str) return;
 
     cJSON *root = cJSON_Parse(json_str);
     if (!root) {
-        DBG_ERROR("Failed to parse system config JSON");
-        return log_method;  // Return default method
+        DBG_ERROR("Failed to parse log levels");
+        return;
     }
 
-    // Get logMethod value
-    cJSON *log_method_obj = cJSON_GetObjectItem(root, "logMethod");
-    if (log_method_obj && cJSON_IsNumber(log_method_obj)) {
-        log_method = log_method_obj->valueint;
-        DBG_INFO("Log method loaded: %d", log_method);
-    } else {
-        DBG_WARN("Log method not found in config, using default: %d", log_method);
+    log_tag_reset_levels();
+
+    cJSON *levels = cJSON_GetObjectItem(root, "logLevels");
+    if (levels && cJSON_IsObject(levels)) {
+        cJSON *item;
+        cJSON_ArrayForEach(item, levels) {
+            if (!cJSON_IsNumber(item) || item->valueint < LOG_ERROR || item->valueint > LOG_DEBUG) {
+                DBG_WARN("Invalid log level for tag %s", item->string);
+                continue;
+            }
+            if (log_tag_set_level(item->string, item->valueint) == 0) {
+                DBG_WARN("Unknown log tag: %s", item->string);
+            } else {
+                DBG_INFO("Log level for %s set to %d", item->string, item->valueint);
+            }
+        }
     }
 
     cJSON_Delete(root);
-    return log_method;
+}
+
+// Apply the per-tag log levels stored in the system config
+void apply_log_levels(void) {
+    char *json_str = config_dup(CONFIG_SYSTEM);
+    if (!json_str) {
+        DBG_ERROR("Failed to read system config");
+        return;
+    }
+
+    apply_log_levels_json(json_str);
+    free(json_str);
 }
 
 void log_output_start(void) {
@@ -11,6 +11,15 @@
 #define LOG_OUTPUT_SERIAL   0x02
 #define LOG_OUTPUT_WEBSOCKET 0x04
 
+// Log thread flush counters
+typedef struct {
+    uint32_t flushes;       // Batches written
+    uint32_t entries;       // Entries written, entries / flushes = batch size
+    uint32_t max_batch;     // Largest batch seen
+    uint32_t dropped;       // Entries lost because the ring was full
+    int pending;            // Entries waiting in the ring
+} log_output_stats_t;
+
 // Initialize log output system
 void log_output_init(uint32_t output_types);
 
@@ -26,10 +35,19 @@ void log_output_process(void);
 // Format log entry into string
 void log_output_format_entry(const log_entry_t* entry, char* output, size_t output_size);
 
+// Copy the flush counters
+void log_output_get_stats(log_output_stats_t *stats);
+
 // Start log output thread
 void log_output_start(void);
 
 // Get log method
 int get_log_method(void);
 
+// Apply the per-tag log levels from the system config
+void apply_log_levels(void);
+
+// Apply the "logLevels" object of a system config JSON string
+void apply_log_levels_json(const char *json_str);
+
 #endif // LOG_OUTPUT_H 
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "log_sink.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+
+// Log level strings - using array for O(1) lookup
+static const char* const level_strings[] = {
+    [LOG_ERROR] = "E",
+    [LOG_WARN]  = "W",
+    [LOG_INFO]  = "I",
+    [LOG_DEBUG] = "D"
+};
+
+// Only used from the log thread: consecutive entries mostly share a second,
+// so localtime() and strftime() run once per second instead of per line
+static char g_time_str[20];
+static time_t g_time_cached = (time_t)-1;
+
+static const char *format_timestamp(time_t timestamp) {
+    if (timestamp != g_time_cached) {
+        struct tm tm_info;
+        localtime_r(&timestamp, &tm_info);
+        strftime(g_time_str, sizeof(g_time_str), "%Y-%m-%d %H:%M:%S", &tm_info);
+        g_time_cached = timestamp;
+    }
+    return g_time_str;
+}
+
+static const char* get_filename(const char* filepath) {
+    const char* filename = strrchr(filepath, '/');
+    return filename ? filename + 1 : filepath;
+}
+
+size_t log_sink_format(const log_entry_t *entry, char *output, size_t output_size) {
+    if (!entry || !output || output_size < 8) {
+        return 0;
+    }
+
+    int written = snprintf(output, output_size,
+        "[%s] [%s/%s] [%s:%d] %s\n",
+        format_timestamp(entry->timestamp),
+        level_strings[entry->level],
+        entry->tag,
+        get_filename(entry->file),
+        entry->line,
+        entry->message);
+
+    if (written < 0) {
+        output[0] = '\0';
+        return 0;
+    }
+    if ((size_t)written >= output_size) {
+        // Truncated, end the line with an ellipsis
+        memcpy(output + output_size - 5, "...\n", 5);
+        return output_size - 1;
+    }
+    return written;
+}
+
+int log_sink_fill(log_arena_t *arena) {
+    log_entry_t entry;
+
+    arena->len = 0;
+    arena->count = 0;
+    while (arena->count < LOG_SINK_BATCH &&
+           sizeof(arena->data) - arena->len >= LOG_SINK_LINE_SIZE &&
+           log_buffer_get(&entry)) {
+        arena->len += log_sink_format(&entry, arena->data + arena->len, LOG_SINK_LINE_SIZE);
+        arena->count++;
+    }
+    return arena->count;
+}
+
+int log_sink_write(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN) {
+                // Serial ports are opened non-blocking, wait for room
+                struct pollfd pfd = { .fd = fd, .events = POLLOUT };
+                if (poll(&pfd, 1, 1000) > 0) continue;
+            }
+            return -1;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
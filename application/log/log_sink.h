@@ -0,0 +1,30 @@
+#ifndef LOG_SINK_H
+#define LOG_SINK_H
+
+#include <stddef.h>
+#include "log_buffer.h"
+
+// Entries drained from the ring per flush
+#define LOG_SINK_BATCH 64
+
+// Longest formatted line: timestamp, level, tag, file:line and the message
+#define LOG_SINK_LINE_SIZE 512
+
+// Contiguous text of one batch, every line terminated by '\n'
+typedef struct {
+    char data[LOG_SINK_BATCH * LOG_SINK_LINE_SIZE];
+    size_t len;
+    int count;
+} log_arena_t;
+
+// Format one entry as a text line ending in '\n', returns its length
+size_t log_sink_format(const log_entry_t *entry, char *output, size_t output_size);
+
+// Drain up to LOG_SINK_BATCH entries from the ring into the arena (single
+// consumer only), returns the number of entries
+int log_sink_fill(log_arena_t *arena);
+
+// Write the whole buffer to fd, retrying partial writes, returns 0 on success
+int log_sink_write(int fd, const char *buf, size_t len);
+
+#endif // LOG_SINK_H
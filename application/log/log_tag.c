@@ -0,0 +1,52 @@
+#include "log_tag.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// Only written by constructors before main(), read-only afterwards
+static log_tag_t *g_tags;
+
+void log_tag_register(log_tag_t *tag) {
+    tag->next = g_tags;
+    g_tags = tag;
+}
+
+int log_tag_set_level(const char *name, log_level_t level) {
+    int updated = 0;
+
+    if (!name) return 0;
+
+    for (log_tag_t *tag = g_tags; tag; tag = tag->next) {
+        if (strcmp(tag->name, name) == 0) {
+            atomic_store_explicit(&tag->level, level, memory_order_relaxed);
+            updated++;
+        }
+    }
+    return updated;
+}
+
+static int compare_names(const void *a, const void *b) {
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+int log_tag_names(const char **names, int max) {
+    int count = 0;
+
+    for (log_tag_t *tag = g_tags; tag && count < max; tag = tag->next) {
+        bool seen = false;
+        for (int i = 0; i < count && !seen; i++) {
+            seen = strcmp(names[i], tag->name) == 0;
+        }
+        if (!seen) {
+            names[count++] = tag->name;
+        }
+    }
+    qsort(names, count, sizeof(names[0]), compare_names);
+    return count;
+}
+
+void log_tag_reset_levels(void) {
+    for (log_tag_t *tag = g_tags; tag; tag = tag->next) {
+        atomic_store_explicit(&tag->level, tag->default_level, memory_order_relaxed);
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef LOG_TAG_H
+#define LOG_TAG_H
+
+#include <stdatomic.h>
+#include "log_types.h"
+
+// Runtime level of one DBG_TAG. Every source file including dbg.h owns one
+// of these and registers it before main() runs.
+typedef struct log_tag {
+    const char *name;
+    atomic_int level;
+    int default_level;      // DBG_LVL of the file, restored when unset
+    struct log_tag *next;
+} log_tag_t;
+
+// Add a tag to the registry (called from constructors, before any thread starts)
+void log_tag_register(log_tag_t *tag);
+
+// Set the runtime level of every source file using this tag, returns the
+// number of files updated
+int log_tag_set_level(const char *name, log_level_t level);
+
+// Restore every tag to its compiled-in DBG_LVL
+void log_tag_reset_levels(void);
+
+// Fill names with the distinct registered tags in sorted order, at most
+// max of them. Returns the number stored.
+int log_tag_names(const char **names, int max);
+
+#endif // LOG_TAG_H
@@ -6,10 +6,11 @@
 #include "web_server/net.h"
 #include "modbus/rtu_master.h"
 #include "database/db.h"
+#include "database/config.h"
+#include "database/historian.h"
 #include "log/log_buffer.h"
 #include "log/log_output.h"
 #include "system/system.h"
-#include "web_server/websocket.h"
 
 #define DBG_TAG "MAIN"
 #define DBG_LVL LOG_INFO
@@ -29,8 +30,15 @@ int main(int argc, char *argv[]) {
         return -1;
     }
 
+    // Load the configuration once, everything reads it from memory after
+    if (config_init() != 0) {
+        DBG_ERROR("Failed to load configuration");
+        return -1;
+    }
+
     // Initialize logging system
     log_buffer_init();
+    apply_log_levels();
 
     // Setup signal handling
     signal(SIGTERM, signal_handler);
@@ -40,6 +48,11 @@ int main(int argc, char *argv[]) {
     // Start log processing thread
     log_output_start();
 
+    // Start the value history before the poll threads feed it
+    if (historian_init() != 0) {
+        DBG_WARN("Value history disabled");
+    }
+
     // Apply network config
     apply_network_config();
 
@@ -47,12 +60,9 @@ int main(int argc, char *argv[]) {
         log_output_init(LOG_OUTPUT_WEBSOCKET);
     }
 
-    // Initialize web server
+    // Initialize web server, which also serves the websocket log
     web_init();
 
-    // Initialize websocket log server
-    websocket_log_start();
-
     // Initialize UDP server
     start_udp_server();
 
@@ -66,6 +76,9 @@ int main(int argc, char *argv[]) {
         sleep(1);
     }
 
+    // Commit the history still held in RAM before the process goes away
+    historian_flush();
+
     DBG_INFO("Application stopped");
     return 0;
 }
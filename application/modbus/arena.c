@@ -0,0 +1,158 @@
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stddef.h>
+
+#define DBG_TAG "ARENA"
+#define DBG_LVL LOG_INFO
+#include "dbg.h"
+
+#define ARENA_MIN_BLOCK 4096
+#define ARENA_ALIGN alignof(max_align_t)
+
+struct arena_block {
+    arena_block_t *next;
+    size_t size;
+    size_t used;
+    alignas(max_align_t) unsigned char data[];
+};
+
+void arena_init(arena_t *arena, size_t block_size) {
+    arena->head = NULL;
+    arena->block_size = block_size < ARENA_MIN_BLOCK ? ARENA_MIN_BLOCK : block_size;
+}
+
+void arena_free(arena_t *arena) {
+    arena_block_t *block = arena->head;
+    while (block) {
+        arena_block_t *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head = NULL;
+}
+
+void *arena_alloc(arena_t *arena, size_t size) {
+    size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    if (size == 0) {
+        size = ARENA_ALIGN;
+    }
+
+    arena_block_t *block = arena->head;
+    if (!block || block->size - block->used < size) {
+        // The estimate was short: chain another block, at least as large
+        size_t block_size = arena->block_size;
+        if (block_size < size) {
+            block_size = size;
+        }
+        block = calloc(1, sizeof(arena_block_t) + block_size);
+        if (!block) {
+            DBG_ERROR("Failed to allocate %lu byte arena block", (unsigned long)block_size);
+            return NULL;
+        }
+        block->size = block_size;
+        block->next = arena->head;
+        arena->head = block;
+    }
+
+    void *ptr = block->data + block->used;
+    block->used += size;
+    return ptr;
+}
+
+char *arena_strdup(arena_t *arena, const char *s) {
+    size_t len = strlen(s) + 1;
+    char *copy = arena_alloc(arena, len);
+    if (copy) {
+        memcpy(copy, s, len);
+    }
+    return copy;
+}
+
+// FNV-1a
+static uint32_t hash_string(const char *s) {
+    uint32_t hash = 2166136261u;
+    for (; *s; s++) {
+        hash ^= (unsigned char)*s;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+int string_pool_init(string_pool_t *pool, arena_t *arena, size_t expected) {
+    size_t capacity = 16;
+    while (capacity < expected * 2) {
+        capacity *= 2;
+    }
+
+    pool->arena = arena;
+    pool->count = 0;
+    pool->capacity = capacity;
+    pool->slots = calloc(capacity, sizeof(const char *));
+    if (!pool->slots) {
+        DBG_ERROR("Failed to allocate string pool");
+        pool->capacity = 0;
+        return -1;
+    }
+    return 0;
+}
+
+// Double the table to keep it at most half full
+static int grow_pool(string_pool_t *pool) {
+    size_t capacity = pool->capacity * 2;
+    const char **slots = calloc(capacity, sizeof(const char *));
+    if (!slots) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < pool->capacity; i++) {
+        const char *s = pool->slots[i];
+        if (!s) {
+            continue;
+        }
+        size_t j = hash_string(s) & (capacity - 1);
+        while (slots[j]) {
+            j = (j + 1) & (capacity - 1);
+        }
+        slots[j] = s;
+    }
+
+    free(pool->slots);
+    pool->slots = slots;
+    pool->capacity = capacity;
+    return 0;
+}
+
+const char *string_pool_intern(string_pool_t *pool, const char *s) {
+    if (!s || !pool->slots) {
+        return NULL;
+    }
+    if ((pool->count + 1) * 2 > pool->capacity && grow_pool(pool) != 0) {
+        DBG_ERROR("Failed to grow string pool");
+        return NULL;
+    }
+
+    size_t i = hash_string(s) & (pool->capacity - 1);
+    while (pool->slots[i]) {
+        if (strcmp(pool->slots[i], s) == 0) {
+            return pool->slots[i];
+        }
+        i = (i + 1) & (pool->capacity - 1);
+    }
+
+    char *copy = arena_strdup(pool->arena, s);
+    if (copy) {
+        pool->slots[i] = copy;
+        pool->count++;
+    }
+    return copy;
+}
+
+void string_pool_free(string_pool_t *pool) {
+    free(pool->slots);
+    pool->slots = NULL;
+    pool->capacity = 0;
+    pool->count = 0;
+}
@@ -0,0 +1,39 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// Bump allocator for data that lives and dies together, such as a compiled
+// device configuration. Allocations are carved out of large blocks and
+// released all at once by arena_free(); nothing is freed on its own.
+typedef struct arena_block arena_block_t;
+
+typedef struct {
+    arena_block_t *head;    // Block allocations are taken from, older ones follow
+    size_t block_size;      // Size of the next block, grown for larger requests
+} arena_t;
+
+// block_size is the expected total, so a sized arena needs one block
+void arena_init(arena_t *arena, size_t block_size);
+void arena_free(arena_t *arena);
+
+// Zeroed memory aligned for any type, NULL when out of memory
+void *arena_alloc(arena_t *arena, size_t size);
+char *arena_strdup(arena_t *arena, const char *s);
+
+// Interns strings into an arena: equal strings share one copy, so a name
+// repeated over hundreds of nodes is stored once
+typedef struct {
+    arena_t *arena;
+    const char **slots;     // Open addressing table, NULL for empty
+    size_t capacity;        // Power of two
+    size_t count;
+} string_pool_t;
+
+int string_pool_init(string_pool_t *pool, arena_t *arena, size_t expected);
+// The arena copy of s, NULL when out of memory
+const char *string_pool_intern(string_pool_t *pool, const char *s);
+// Free the table, the strings stay in the arena
+void string_pool_free(string_pool_t *pool);
+
+#endif // ARENA_H
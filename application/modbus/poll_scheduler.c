@@ -0,0 +1,119 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include "poll_scheduler.h"
+
+#define DBG_TAG "SCHEDULER"
+#define DBG_LVL LOG_INFO
+#include "dbg.h"
+
+static void swap_tasks(poll_task_t *a, poll_task_t *b) {
+    poll_task_t tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+static void sift_up(poll_scheduler_t *sched, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (sched->tasks[parent].due_ms <= sched->tasks[i].due_ms) {
+            break;
+        }
+        swap_tasks(&sched->tasks[parent], &sched->tasks[i]);
+        i = parent;
+    }
+}
+
+static void sift_down(poll_scheduler_t *sched, int i) {
+    while (1) {
+        int left = 2 * i + 1;
+        int right = left + 1;
+        int smallest = i;
+
+        if (left < sched->count && sched->tasks[left].due_ms < sched->tasks[smallest].due_ms) {
+            smallest = left;
+        }
+        if (right < sched->count && sched->tasks[right].due_ms < sched->tasks[smallest].due_ms) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            break;
+        }
+        swap_tasks(&sched->tasks[smallest], &sched->tasks[i]);
+        i = smallest;
+    }
+}
+
+int poll_scheduler_init(poll_scheduler_t *sched, int capacity) {
+    if (!sched) return -1;
+
+    memset(sched, 0, sizeof(*sched));
+    if (capacity <= 0) {
+        return 0;
+    }
+
+    sched->tasks = calloc(capacity, sizeof(poll_task_t));
+    if (!sched->tasks) {
+        DBG_ERROR("Failed to allocate memory for poll scheduler");
+        return -1;
+    }
+    sched->capacity = capacity;
+    return 0;
+}
+
+void poll_scheduler_free(poll_scheduler_t *sched) {
+    if (!sched) return;
+    free(sched->tasks);
+    memset(sched, 0, sizeof(*sched));
+}
+
+int poll_scheduler_add(poll_scheduler_t *sched, device_t *device, uint64_t due_ms) {
+    if (!sched || !device) return -1;
+
+    if (sched->count == sched->capacity) {
+        int capacity = sched->capacity ? sched->capacity * 2 : 8;
+        poll_task_t *tasks = realloc(sched->tasks, capacity * sizeof(poll_task_t));
+        if (!tasks) {
+            DBG_ERROR("Failed to grow poll scheduler");
+            return -1;
+        }
+        sched->tasks = tasks;
+        sched->capacity = capacity;
+    }
+
+    sched->tasks[sched->count].due_ms = due_ms;
+    sched->tasks[sched->count].device = device;
+    sched->count++;
+    sift_up(sched, sched->count - 1);
+    return 0;
+}
+
+// Get the task with the earliest due time without removing it
+poll_task_t *poll_scheduler_peek(poll_scheduler_t *sched) {
+    if (!sched || sched->count == 0) return NULL;
+    return &sched->tasks[0];
+}
+
+// Move the earliest task to a new due time
+void poll_scheduler_reschedule(poll_scheduler_t *sched, uint64_t due_ms) {
+    if (!sched || sched->count == 0) return;
+    sched->tasks[0].due_ms = due_ms;
+    sift_down(sched, 0);
+}
+
+uint64_t poll_scheduler_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+void poll_scheduler_sleep_until(uint64_t due_ms) {
+    struct timespec ts = {
+        .tv_sec = due_ms / 1000,
+        .tv_nsec = (due_ms % 1000) * 1000000
+    };
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+}
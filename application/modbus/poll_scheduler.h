@@ -0,0 +1,29 @@
+#ifndef POLL_SCHEDULER_H
+#define POLL_SCHEDULER_H
+
+#include <stdint.h>
+#include "rtu_master.h"
+
+// A device scan that is due at due_ms (CLOCK_MONOTONIC milliseconds)
+typedef struct {
+    uint64_t due_ms;
+    device_t *device;
+} poll_task_t;
+
+// Min-heap of poll tasks ordered by due time
+typedef struct poll_scheduler {
+    poll_task_t *tasks;
+    int count;
+    int capacity;
+} poll_scheduler_t;
+
+// Function declarations
+int poll_scheduler_init(poll_scheduler_t *sched, int capacity);
+void poll_scheduler_free(poll_scheduler_t *sched);
+int poll_scheduler_add(poll_scheduler_t *sched, device_t *device, uint64_t due_ms);
+poll_task_t *poll_scheduler_peek(poll_scheduler_t *sched);
+void poll_scheduler_reschedule(poll_scheduler_t *sched, uint64_t due_ms);
+uint64_t poll_scheduler_now_ms(void);
+void poll_scheduler_sleep_until(uint64_t due_ms);
+
+#endif
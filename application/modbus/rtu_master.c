@@ -1,13 +1,18 @@
 #include <fcntl.h>
+#include <errno.h>
 #include <termios.h>
 #include <unistd.h>
 #include <pthread.h>
 #include <time.h>
+#include <math.h>
 #include "rtu_master.h"
 #include "agile_modbus.h"
 #include "serial.h"
+#include "poll_scheduler.h"
+#include "tag_table.h"
+#include "historian.h"
 #include "cJSON.h"
-#include "db.h"
+#include "config.h"
 #include "../web_server/net.h"
 #include "../web_server/websocket.h"
 #include "../log/log_output.h"
@@ -16,69 +21,45 @@
 #define DBG_LVL LOG_INFO
 #include "dbg.h"
 
-#define DEFAULT_PORT "/dev/ttymxc1"
-#define DEFAULT_BAUD 115200
+// Poll engine owning one serial line and the devices attached to it
+typedef struct {
+    char port[64];
+    int baud;
+    char parity;
+    bool reopen;            // A reload changed baud or parity
+    serial_port_t serial;
+    uint8_t send_buf[MODBUS_MAX_ADU_LENGTH];
+    uint8_t recv_buf[MODBUS_MAX_ADU_LENGTH];
+    agile_modbus_rtu_t ctx_rtu;
+    poll_scheduler_t sched;
+    update_batch_t batch;
+} rtu_engine_t;
 
 // Function declarations
-static void free_node(node_t *node);
-static void free_device(device_t *device);
-static void free_node_group(node_group_t *group);
-static void free_device_groups(device_t *device);
 static int convert_node_value(node_t *node, uint16_t *raw_data);
-static node_t* parse_nodes(cJSON *nodes_array);
+static int parse_nodes(cJSON *nodes_array, node_t *nodes, string_pool_t *pool);
+static void parse_forbidden_ranges(device_t *device, cJSON *ranges_array, arena_t *arena);
 static int get_register_count(data_type_t data_type);
-static void create_node_groups(device_t *device);
-static int poll_single_node(agile_modbus_t *ctx, int fd, device_t *device, node_t *node);
-static int poll_group_node(agile_modbus_t *ctx, int fd, device_t *device, node_group_t *group);
-static char* build_node_json(const char *node_name, node_t *node);
+static int create_node_groups(device_t *device, node_group_t *groups, arena_t *arena);
+static int poll_single_node(agile_modbus_t *ctx, serial_port_t *sp, device_t *device, node_t *node);
+static int poll_group_node(agile_modbus_t *ctx, serial_port_t *sp, device_t *device, node_group_t *group);
 
 static uint8_t method_ws_log = 0; 
 
-// Free memory for a node and its members
-static void free_node(node_t *node) {
-    if (!node) return;
-    free(node->name);
-    free(node);
-}
-
-// Free memory for a device and its nodes
-static void free_device(device_t *device) {
-    if (!device) return;
-    
-    // Free all nodes
-    node_t *current = device->nodes;
-    while (current) {
-        node_t *next = current->next;
-        free_node(current);
-        current = next;
-    }
-    
-    // Free groups if they exist
-    free_device_groups(device);
-    
-    free(device->name);
-    free(device);
-}
-
-// Free memory for a node group and its data buffer
-static void free_node_group(node_group_t *group) {
-    if (!group) return;
-    free(group->data_buffer);
-    free(group);
-}
-
-// Free all node groups in a device
-static void free_device_groups(device_t *device) {
-    if (!device) return;
-    
-    node_group_t *current = device->groups;
-    while (current) {
-        node_group_t *next = current->next;
-        free_node_group(current);
-        current = next;
-    }
-    device->groups = NULL;
-}
+// Running device configuration. Engines hold the model only while they
+// scan a device; a reload waits for every engine to leave its scan, moves
+// the state of unchanged devices and nodes over to the new configuration
+// and swaps it in. The replaced configuration is freed on the next reload,
+// as tag table readers may still hold its names until then.
+static pthread_mutex_t s_reload_lock = PTHREAD_MUTEX_INITIALIZER;  // One reload at a time
+static pthread_mutex_t s_model_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_model_cond = PTHREAD_COND_INITIALIZER;
+static int s_scanning;              // Engines inside a device scan
+static bool s_reloading;            // A reload waits for or holds the model
+static unsigned s_generation;       // Bumped by every reload, wakes sleeping engines
+static rtu_engine_t *s_engines[MODBUS_MAX_PORTS];
+static int s_engine_count;
+static device_config_t *s_config;
 
 // Convert raw data based on data type with bounds checking
 static int convert_node_value(node_t *node, uint16_t *raw_data) {
@@ -151,29 +132,30 @@ static int convert_node_value(node_t *node, uint16_t *raw_data) {
     return RTU_MASTER_OK;
 }
 
-// Parse node array from JSON
-static node_t* parse_nodes(cJSON *nodes_array) {
-    node_t *head = NULL;
-    node_t *current = NULL;
-    
+// Parse node array from JSON into nodes, returns the number of nodes or
+// -1 when a name could not be stored
+static int parse_nodes(cJSON *nodes_array, node_t *nodes, string_pool_t *pool) {
     int node_count = cJSON_GetArraySize(nodes_array);
     for (int i = 0; i < node_count; i++) {
         cJSON *node_obj = cJSON_GetArrayItem(nodes_array, i);
-        
-        node_t *new_node = (node_t*)calloc(1, sizeof(node_t));
-        if (!new_node) {
-            DBG_ERROR("Memory allocation failed for node");
-            return head;
-        }
+        node_t *new_node = &nodes[i];
 
         cJSON *name = cJSON_GetObjectItem(node_obj, "n");
         cJSON *addr = cJSON_GetObjectItem(node_obj, "a");
         cJSON *func = cJSON_GetObjectItem(node_obj, "f");
         cJSON *data_type = cJSON_GetObjectItem(node_obj, "dt");
         cJSON *timeout = cJSON_GetObjectItem(node_obj, "t");
+        cJSON *on_change = cJSON_GetObjectItem(node_obj, "oc");
+        cJSON *deadband = cJSON_GetObjectItem(node_obj, "db");
 
+        // Config order until register_nodes() numbers the nodes, the tie
+        // break of compare_nodes()
+        new_node->id = i;
         if (name && name->valuestring) {
-            new_node->name = strdup(name->valuestring);
+            new_node->name = string_pool_intern(pool, name->valuestring);
+            if (!new_node->name) {
+                return -1;
+            }
         }
         if (addr) {
             new_node->address = addr->valueint;
@@ -189,17 +171,41 @@ static node_t* parse_nodes(cJSON *nodes_array) {
         } else {
             new_node->timeout = MODBUS_RTU_TIMEOUT; // Default timeout of 1 second
         }
-
-        if (!head) {
-            head = new_node;
-            current = head;
-        } else {
-            current->next = new_node;
-            current = new_node;
+        new_node->report_on_change = cJSON_IsTrue(on_change);
+        if (deadband && cJSON_IsNumber(deadband) && deadband->valuedouble > 0) {
+            new_node->deadband = deadband->valuedouble;
         }
     }
 
-    return head;
+    return node_count;
+}
+
+// Parse forbidden address ranges, e.g. [{"f":3,"s":100,"e":119}]
+static void parse_forbidden_ranges(device_t *device, cJSON *ranges_array, arena_t *arena) {
+    int count = cJSON_GetArraySize(ranges_array);
+    if (count <= 0) return;
+
+    device->forbidden = arena_alloc(arena, count * sizeof(addr_range_t));
+    if (!device->forbidden) {
+        DBG_ERROR("Memory allocation failed for forbidden ranges");
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        cJSON *range_obj = cJSON_GetArrayItem(ranges_array, i);
+        cJSON *func = cJSON_GetObjectItem(range_obj, "f");
+        cJSON *start = cJSON_GetObjectItem(range_obj, "s");
+        cJSON *end = cJSON_GetObjectItem(range_obj, "e");
+
+        if (!start) {
+            continue;
+        }
+
+        addr_range_t *range = &device->forbidden[device->forbidden_count++];
+        range->function = func ? func->valueint : 0;
+        range->start = start->valueint;
+        range->end = end ? end->valueint : start->valueint;
+    }
 }
 
 // Calculate number of registers needed based on data type
@@ -225,92 +231,135 @@ static int get_register_count(data_type_t data_type) {
     }
 }
 
-// Create node groups for a device based on function codes
-static void create_node_groups(device_t *device) {
-    if (!device || !device->nodes) return;
-
-    // First, sort nodes by function code and address
-    node_t *sorted = NULL;
-    node_t *current = device->nodes;
-    
-    while (current) {
-        node_t *next = current->next;
-        node_t *prev = NULL;
-        node_t *iter = sorted;
-        
-        // Find position to insert based on function code and address
-        while (iter && (iter->function < current->function || 
-               (iter->function == current->function && iter->address < current->address))) {
-            prev = iter;
-            iter = iter->next;
+// Check whether [start, end) touches a range the slave rejects
+static bool is_range_forbidden(device_t *device, uint8_t function, uint16_t start, uint16_t end) {
+    for (int i = 0; i < device->forbidden_count; i++) {
+        addr_range_t *range = &device->forbidden[i];
+        if (range->function != 0 && range->function != function) {
+            continue;
         }
-        
-        // Insert node in sorted position
-        if (prev) {
-            prev->next = current;
-        } else {
-            sorted = current;
+        if (start <= range->end && end > range->start) {
+            return true;
         }
-        current->next = iter;
-        current = next;
     }
+    return false;
+}
+
+// Wire time of one extra request/response round trip: 8 byte request,
+// 5 bytes of response framing, slave turnaround and two t3.5 silences
+static uint32_t get_transaction_cost_us(device_t *device) {
+    uint32_t char_us = serial_char_time_us(device->baud, device->parity);
+    return (8 + 5) * char_us + device->turnaround * 1000 +
+           2 * serial_t35_us(device->baud, device->parity);
+}
+
+// Wire time of reading count unused registers (or bits) to bridge a gap
+static uint32_t get_gap_cost_us(device_t *device, uint8_t function, uint16_t count) {
+    uint32_t char_us = serial_char_time_us(device->baud, device->parity);
+    if (function == 1 || function == 2) {
+        return (count * char_us + 7) / 8;
+    }
+    return 2 * count * char_us;
+}
+
+// Order nodes by function code and address. Ties keep their config order,
+// as the list insertion sort this replaced did, so node ids neither depend
+// on qsort nor change on upgrade.
+static int compare_nodes(const void *a, const void *b) {
+    const node_t *x = a;
+    const node_t *y = b;
+
+    if (x->function != y->function) {
+        return x->function < y->function ? -1 : 1;
+    }
+    if (x->address != y->address) {
+        return x->address < y->address ? -1 : 1;
+    }
+    if (x->id != y->id) {
+        return x->id < y->id ? -1 : 1;
+    }
+    return 0;
+}
+
+// Create node groups for a device based on function codes. A node joins the
+// current group when the registers in between are cheaper to read than a new
+// round trip, the span stays within one request and no forbidden range is crossed.
+// Fills groups, room for one per node, and returns how many it made, -1
+// when out of memory.
+static int create_node_groups(device_t *device, node_group_t *groups, arena_t *arena) {
+    if (!device || device->node_count == 0) return 0;
+
+    // Sort the nodes in place, each group then covers a run of them
+    qsort(device->nodes, device->node_count, sizeof(node_t), compare_nodes);
     
-    device->nodes = sorted;
-    
-    // Create groups for consecutive addresses with same function code
-    node_group_t *groups = NULL;
+    uint32_t transaction_cost = get_transaction_cost_us(device);
+
+    // Create groups, bridging gaps when that beats another transaction
     node_group_t *current_group = NULL;
-    current = device->nodes;
+    int group_count = 0;
     
-    while (current) {
-        if (!current_group || 
-            current_group->function != current->function ||
-            (current->address - current_group->start_address + get_register_count(current->data_type)) > MODBUS_MAX_REGISTERS) {
-            
-            // Create new group
-            node_group_t *new_group = calloc(1, sizeof(node_group_t));
-            if (!new_group) {
-                DBG_ERROR("Failed to allocate memory for node group");
-                return;
-            }
-            
-            new_group->function = current->function;
-            new_group->start_address = current->address;
-            new_group->nodes = current;
-            
-            // Add to groups list
-            if (!groups) {
-                groups = new_group;
-            } else {
-                current_group->next = new_group;
+    for (int i = 0; i < device->node_count; i++) {
+        node_t *current = &device->nodes[i];
+        bool new_group = !current_group || current_group->function != current->function;
+
+        if (!new_group) {
+            uint16_t group_end = current_group->start_address + current_group->register_count;
+            uint16_t node_end = current->address + get_register_count(current->data_type);
+            int max_count = (current->function == 1 || current->function == 2) ?
+                            MODBUS_MAX_BITS : MODBUS_MAX_REGISTERS;
+
+            if (node_end - current_group->start_address > max_count) {
+                new_group = true;
+            } else if (current->address > group_end) {
+                uint16_t gap = current->address - group_end;
+                if (get_gap_cost_us(device, current->function, gap) >= transaction_cost ||
+                    is_range_forbidden(device, current->function, group_end, node_end)) {
+                    new_group = true;
+                }
+            } else if (node_end > group_end &&
+                       is_range_forbidden(device, current->function, group_end, node_end)) {
+                new_group = true;
             }
-            current_group = new_group;
+        }
+
+        if (new_group) {
+            current_group = &groups[group_count++];
+            current_group->function = current->function;
+            current_group->start_address = current->address;
+            current_group->nodes = current;
+            current_group->timeout = current->timeout;
         }
         
         // Calculate offset in group's data buffer
         current->offset = current->address - current_group->start_address;
+        current_group->node_count++;
+        if (current->timeout > current_group->timeout) {
+            current_group->timeout = current->timeout;
+        }
         
         // Update group's register count
         uint16_t end_address = current->address + get_register_count(current->data_type);
         if (end_address - current_group->start_address > current_group->register_count) {
             current_group->register_count = end_address - current_group->start_address;
         }
-        
-        current = current->next;
     }
     
     // Allocate data buffers for each group
-    current_group = groups;
-    while (current_group) {
-        current_group->data_buffer = calloc(current_group->register_count, sizeof(uint16_t));
-        if (!current_group->data_buffer) {
+    for (int i = 0; i < group_count; i++) {
+        node_group_t *group = &groups[i];
+        group->data_buffer = arena_alloc(arena, group->register_count * sizeof(uint16_t));
+        if (!group->data_buffer) {
             DBG_ERROR("Failed to allocate data buffer for node group");
-            return;
+            return -1;
         }
-        current_group = current_group->next;
+        DBG_INFO("Group: %s (func: %d, start: %d, count: %d, nodes: %d)",
+                 device->name, group->function, group->start_address,
+                 group->register_count, group->node_count);
     }
     
     device->groups = groups;
+    device->group_count = group_count;
+    return group_count;
 }
 
 // Convert byte array to hex string and send via websocket
@@ -343,9 +392,55 @@ static void send_hex_string(const uint8_t *data, int len) {
     free(hex_str);
 }
 
+// Response timeout for a request to device: the learned timeout, clamped
+// to [min_timeout, max_timeout]. Until the first answer, max_timeout.
+static uint32_t get_response_timeout(const device_t *device, uint32_t max_timeout) {
+    if (max_timeout == 0) {
+        max_timeout = MODBUS_RTU_TIMEOUT;
+    }
+    if (device->rto_ms == 0 || device->min_timeout >= max_timeout) {
+        return max_timeout;
+    }
+    if (device->rto_ms < device->min_timeout) {
+        return device->min_timeout;
+    }
+    return device->rto_ms < max_timeout ? device->rto_ms : max_timeout;
+}
+
+// Learn the response latency of a device the way TCP learns its RTO
+// (RFC 6298): SRTT and RTTVAR from each answer, RTO = SRTT + 4 * RTTVAR.
+// A miss doubles the timeout up to max_timeout until the next answer.
+static void update_response_timeout(device_t *device, const serial_port_t *sp,
+                                    bool answered, uint32_t max_timeout) {
+    if (!answered) {
+        if (device->rto_ms) {
+            uint32_t bound = max_timeout ? max_timeout : MODBUS_RTU_TIMEOUT;
+            device->rto_ms = device->rto_ms * 2 < bound ? device->rto_ms * 2 : bound;
+        }
+        return;
+    }
+    if (sp->rx_first_us == 0 || sp->rx_first_us < sp->tx_end_us) {
+        return;
+    }
+
+    uint32_t rtt_us = sp->rx_first_us - sp->tx_end_us;
+    if (device->rtt_samples == 0) {
+        device->srtt_us = rtt_us;
+        device->rttvar_us = rtt_us / 2;
+    } else {
+        uint32_t delta = device->srtt_us > rtt_us ? device->srtt_us - rtt_us : rtt_us - device->srtt_us;
+        device->rttvar_us = (3 * device->rttvar_us + delta) / 4;
+        device->srtt_us = (7 * device->srtt_us + rtt_us) / 8;
+    }
+    device->rtt_samples++;
+
+    // Round up to whole milliseconds, the granularity of the receive timer here
+    device->rto_ms = (device->srtt_us + 4 * device->rttvar_us + 999) / 1000;
+}
+
 // Poll a single node with improved error handling
-static int poll_single_node(agile_modbus_t *ctx, int fd, device_t *device, node_t *node) {
-    if (!ctx || fd < 0 || !device || !node) return RTU_MASTER_INVALID;
+static int poll_single_node(agile_modbus_t *ctx, serial_port_t *sp, device_t *device, node_t *node) {
+    if (!ctx || !sp || sp->fd < 0 || !device || !node) return RTU_MASTER_INVALID;
 
     uint16_t data[4] = {0};  // Buffer for all data types
     int rc;
@@ -375,20 +470,21 @@ static int poll_single_node(agile_modbus_t *ctx, int fd, device_t *device, node_
         return RTU_MASTER_ERROR;
     }
 
-    // Send request
-    serial_flush(fd);
-    int send_len = serial_write(fd, ctx->send_buf, rc);
+    // Send request, the receive window opens when it has left the wire
+    int send_len = serial_port_send(sp, ctx->send_buf, rc);
     if (send_len != rc) {
         DBG_ERROR("Failed to send request for node %s", node->name);
         return RTU_MASTER_ERROR;
     }
 
-    // Read response with node-specific timeout
-    int read_len = serial_receive(fd, ctx->read_buf, ctx->read_bufsz, node->timeout);
-    if (read_len < 0) {
-        DBG_ERROR("Failed to read response for node %s (timeout: %dms)", 
-                 node->name, node->timeout);
-        return RTU_MASTER_TIMEOUT;
+    // Read response, waiting as long as this slave is known to need
+    uint32_t timeout = get_response_timeout(device, node->timeout);
+    int read_len = serial_port_receive(sp, ctx->read_buf, ctx->read_bufsz, timeout);
+    update_response_timeout(device, sp, read_len > 0, node->timeout);
+    if (read_len <= 0) {
+        DBG_ERROR("Failed to read response for node %s (timeout: %ums)", 
+                 node->name, timeout);
+        return read_len == 0 ? RTU_MASTER_TIMEOUT : RTU_MASTER_ERROR;
     }
 
     if (read_len > 0) {
@@ -414,54 +510,20 @@ static int poll_single_node(agile_modbus_t *ctx, int fd, device_t *device, node_
                 break;
         }
 
+        // agile_modbus reports an exception answer as -(128 + code)
+        if (rc <= -128) {
+            node->stats.last_exception = -rc - 128;
+            DBG_WARN("Node %s: exception %d", node->name, node->stats.last_exception);
+            return RTU_MASTER_EXCEPTION;
+        }
         if (rc < 0) {
             DBG_ERROR("Failed to deserialize response for node %s", node->name);
+            sp->rx_dirty = true;  // Drain the rest of a garbled frame before the next request
             return RTU_MASTER_ERROR;
         }
 
-        // Convert and store the value
+        // Convert and store the value, poll_device() decides whether to publish it
         if (convert_node_value(node, data) == RTU_MASTER_OK) {
-            // Log the converted value with type-specific formatting
-            switch (node->data_type) {
-                case DATA_TYPE_BOOLEAN:
-                    DBG_INFO("%s.%s = %d", device->name, node->name, node->value.bool_val);
-                    break;
-                case DATA_TYPE_INT8:
-                    DBG_INFO("%s.%s = %d", device->name, node->name, node->value.int8_val);
-                    break;
-                case DATA_TYPE_UINT8:
-                    DBG_INFO("%s.%s = %u", device->name, node->name, node->value.uint8_val);
-                    break;
-                case DATA_TYPE_INT16:
-                    DBG_INFO("%s.%s = %d", device->name, node->name, node->value.int16_val);
-                    break;
-                case DATA_TYPE_UINT16:
-                    DBG_INFO("%s.%s = %u", device->name, node->name, node->value.uint16_val);
-                    break;
-                case DATA_TYPE_INT32_ABCD:
-                case DATA_TYPE_INT32_CDAB:
-                    DBG_INFO("%s.%s = %ld", device->name, node->name, node->value.int32_val);
-                    break;
-                case DATA_TYPE_UINT32_ABCD:
-                case DATA_TYPE_UINT32_CDAB:
-                    DBG_INFO("%s.%s = %lu", device->name, node->name, node->value.uint32_val);
-                    break;
-                case DATA_TYPE_FLOAT_ABCD:
-                case DATA_TYPE_FLOAT_CDAB:
-                    DBG_INFO("%s.%s = %.6f", device->name, node->name, node->value.float_val);
-                    break;
-                case DATA_TYPE_DOUBLE:
-                    DBG_INFO("%s.%s = %.12lf", device->name, node->name, node->value.double_val);
-                    break;
-            }
-
-            // Send websocket update
-            char *json_msg = build_node_json(node->name, node);
-            if (json_msg) {
-                send_websocket_message(json_msg);
-                free(json_msg);
-            }
-
             return RTU_MASTER_OK;
         }
     }
@@ -470,8 +532,8 @@ static int poll_single_node(agile_modbus_t *ctx, int fd, device_t *device, node_
 }
 
 // Poll a group of nodes with the same function code
-static int poll_group_node(agile_modbus_t *ctx, int fd, device_t *device, node_group_t *group) {
-    if (!ctx || fd < 0 || !device || !group) return RTU_MASTER_INVALID;
+static int poll_group_node(agile_modbus_t *ctx, serial_port_t *sp, device_t *device, node_group_t *group) {
+    if (!ctx || !sp || sp->fd < 0 || !device || !group) return RTU_MASTER_INVALID;
 
     int rc;
     
@@ -504,22 +566,22 @@ static int poll_group_node(agile_modbus_t *ctx, int fd, device_t *device, node_g
         return RTU_MASTER_ERROR;
     }
 
-    // Send request
-    serial_flush(fd);
-    int send_len = serial_write(fd, ctx->send_buf, rc);
+    // Send request, the receive window opens when it has left the wire
+    int send_len = serial_port_send(sp, ctx->send_buf, rc);
     if (send_len != rc) {
         DBG_ERROR("Failed to send request for group (function: %d, start: %d)",
                  group->function, group->start_address);
         return RTU_MASTER_ERROR;
     }
 
-    // Read response
-    int read_len = serial_receive(fd, ctx->read_buf, ctx->read_bufsz, 
-                             MODBUS_RTU_TIMEOUT);
-    if (read_len < 0) {
-        DBG_ERROR("Failed to read response for group (function: %d, start: %d)", 
-                 group->function, group->start_address);
-        return RTU_MASTER_TIMEOUT;
+    // Read response, bounded by the longest timeout of the group's nodes
+    uint32_t timeout = get_response_timeout(device, group->timeout);
+    int read_len = serial_port_receive(sp, ctx->read_buf, ctx->read_bufsz, timeout);
+    update_response_timeout(device, sp, read_len > 0, group->timeout);
+    if (read_len <= 0) {
+        DBG_ERROR("Failed to read response for group (function: %d, start: %d, timeout: %ums)", 
+                 group->function, group->start_address, timeout);
+        return read_len == 0 ? RTU_MASTER_TIMEOUT : RTU_MASTER_ERROR;
     }
 
     if (read_len > 0) {
@@ -545,15 +607,23 @@ static int poll_group_node(agile_modbus_t *ctx, int fd, device_t *device, node_g
                 break;
         }
 
+        // agile_modbus reports an exception answer as -(128 + code)
+        if (rc <= -128) {
+            group->stats.last_exception = -rc - 128;
+            DBG_WARN("Group (function: %d, start: %d): exception %d",
+                     group->function, group->start_address, group->stats.last_exception);
+            return RTU_MASTER_EXCEPTION;
+        }
         if (rc < 0) {
             DBG_ERROR("Failed to deserialize response for group (function: %d, start: %d)",
                      group->function, group->start_address);
+            sp->rx_dirty = true;  // Drain the rest of a garbled frame before the next request
             return RTU_MASTER_ERROR;
         }
 
         // Update values for all nodes in the group
-        node_t *node = group->nodes;
-        while (node && node->function == group->function) {
+        for (int i = 0; i < group->node_count; i++) {
+            node_t *node = &group->nodes[i];
             // For coils and discrete inputs, each bit is returned as a byte
             uint16_t *data_ptr;
             if (node->function == 1 || node->function == 2) {
@@ -570,58 +640,6 @@ static int poll_group_node(agile_modbus_t *ctx, int fd, device_t *device, node_g
                 DBG_ERROR("Failed to convert value for node %s in group", node->name);
                 return convert_result;
             }
-            
-            // Log the converted value
-            switch (node->data_type) {
-                case DATA_TYPE_BOOLEAN:
-                    DBG_INFO("Device: %s, Node: %s, Value: %d", 
-                            device->name, node->name, node->value.bool_val);
-                    break;
-                case DATA_TYPE_INT8:
-                    DBG_INFO("Device: %s, Node: %s, Value: %d", 
-                            device->name, node->name, node->value.int8_val);
-                    break;
-                case DATA_TYPE_UINT8:
-                    DBG_INFO("Device: %s, Node: %s, Value: %d", 
-                            device->name, node->name, node->value.uint8_val);
-                    break;
-                case DATA_TYPE_INT16:
-                    DBG_INFO("Device: %s, Node: %s, Value: %d", 
-                            device->name, node->name, node->value.int16_val);
-                    break;
-                case DATA_TYPE_UINT16:
-                    DBG_INFO("Device: %s, Node: %s, Value: %d", 
-                            device->name, node->name, node->value.uint16_val);
-                    break;
-                case DATA_TYPE_INT32_ABCD:
-                case DATA_TYPE_INT32_CDAB:
-                    DBG_INFO("Device: %s, Node: %s, Value: %ld", 
-                            device->name, node->name, node->value.int32_val);
-                    break;
-                case DATA_TYPE_UINT32_ABCD:
-                case DATA_TYPE_UINT32_CDAB:
-                    DBG_INFO("Device: %s, Node: %s, Value: %lu", 
-                            device->name, node->name, node->value.uint32_val);
-                    break;
-                case DATA_TYPE_FLOAT_ABCD:
-                case DATA_TYPE_FLOAT_CDAB:
-                    DBG_INFO("Device: %s, Node: %s, Value: %.6f", 
-                            device->name, node->name, node->value.float_val);
-                    break;
-                case DATA_TYPE_DOUBLE:
-                    DBG_INFO("Device: %s, Node: %s, Value: %.12lf", 
-                            device->name, node->name, node->value.double_val);
-                    break;
-            }
-
-            // Send websocket update
-            char *json_msg = build_node_json(node->name, node);
-            if (json_msg) {
-                send_websocket_message(json_msg);
-                free(json_msg);
-            }
-            
-            node = node->next;
         }
         return RTU_MASTER_OK;
     }
@@ -629,113 +647,324 @@ static int poll_group_node(agile_modbus_t *ctx, int fd, device_t *device, node_g
     return RTU_MASTER_ERROR;
 }
 
-// Build JSON message from node data
-static char* build_node_json(const char *node_name, node_t *node) {
-    if (!node_name || !node) {
-        DBG_ERROR("Invalid parameters for building JSON");
-        return NULL;
-    }
-
-    cJSON *root = cJSON_CreateObject();
-    if (!root) {
-        DBG_ERROR("Failed to create JSON object");
-        return NULL;
-    }
-
-    // Add type field
-    cJSON_AddStringToObject(root, "type", "update");
-    
-    // Add node name
-    cJSON_AddStringToObject(root, "n", node_name);
+static uint64_t monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
 
-    // Add value based on data type
-    switch (node->data_type) {
-        case DATA_TYPE_BOOLEAN:
-            cJSON_AddBoolToObject(root, "v", node->value.bool_val);
+// Account one poll of a node or group, rt_us is the time from request to
+// response and only counts when the slave answered
+static void record_poll(poll_stats_t *stats, int result, uint32_t rt_us, uint64_t now_ms) {
+    switch (result) {
+        case RTU_MASTER_OK:
+            stats->quality = NODE_QUALITY_GOOD;
+            stats->last_good_ms = now_ms;
+            stats->consecutive_failures = 0;
+            stats->good++;
             break;
-        case DATA_TYPE_INT8:
-            cJSON_AddNumberToObject(root, "v", node->value.int8_val);
+        case RTU_MASTER_TIMEOUT:
+            stats->quality = NODE_QUALITY_TIMEOUT;
+            stats->consecutive_failures++;
+            stats->timeouts++;
             break;
-        case DATA_TYPE_UINT8:
-            cJSON_AddNumberToObject(root, "v", node->value.uint8_val);
+        case RTU_MASTER_EXCEPTION:
+            stats->quality = NODE_QUALITY_EXCEPTION;
+            stats->consecutive_failures++;
+            stats->exceptions++;
             break;
-        case DATA_TYPE_INT16:
-            cJSON_AddNumberToObject(root, "v", node->value.int16_val);
+        default:
+            stats->quality = NODE_QUALITY_ERROR;
+            stats->consecutive_failures++;
+            stats->errors++;
             break;
-        case DATA_TYPE_UINT16:
-            cJSON_AddNumberToObject(root, "v", node->value.uint16_val);
+    }
+
+    if (result == RTU_MASTER_OK || result == RTU_MASTER_EXCEPTION) {
+        if (stats->responses == 0 || rt_us < stats->rt_min_us) {
+            stats->rt_min_us = rt_us;
+        }
+        if (rt_us > stats->rt_max_us) {
+            stats->rt_max_us = rt_us;
+        }
+        stats->rt_total_us += rt_us;
+        stats->responses++;
+    }
+}
+
+static void put_le(uint8_t *out, uint64_t value, int width) {
+    for (int i = 0; i < width; i++) {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+// Start an empty {"type":"updates","vs":[ message
+static void batch_begin_text(update_batch_t *batch) {
+    json_writer_init(&batch->writer, batch->buf, sizeof(batch->buf));
+    json_writer_begin_object(&batch->writer);
+    json_writer_key(&batch->writer, "type");
+    json_writer_string(&batch->writer, "updates");
+    json_writer_key(&batch->writer, "vs");
+    json_writer_begin_array(&batch->writer);
+    batch->count = 0;
+}
+
+// Start empty messages for the clients connected right now
+static void batch_reset(update_batch_t *batch) {
+    batch->text = websocket_client_count(false) > 0;
+    batch->binary = websocket_client_count(true) > 0;
+
+    batch_begin_text(batch);
+
+    batch->bin[0] = UPDATE_FRAME_VALUES;
+    batch->bin_len = UPDATE_FRAME_HEADER;
+    batch->bin_count = 0;
+}
+
+static void batch_flush_text(update_batch_t *batch) {
+    if (batch->count == 0) {
+        return;
+    }
+
+    json_writer_end_array(&batch->writer);
+    json_writer_end_object(&batch->writer);
+    if (json_writer_finish(&batch->writer) > 0) {
+        send_websocket_message(batch->buf);
+    }
+    batch_begin_text(batch);
+}
+
+static void batch_flush_binary(update_batch_t *batch) {
+    if (batch->bin_count == 0) {
+        return;
+    }
+
+    put_le(batch->bin + 1, batch->bin_count, 2);
+    send_websocket_binary(batch->bin, batch->bin_len);
+    batch->bin_len = UPDATE_FRAME_HEADER;
+    batch->bin_count = 0;
+}
+
+// Hand the messages to the web thread, one frame per protocol
+static void batch_flush(update_batch_t *batch) {
+    batch_flush_text(batch);
+    batch_flush_binary(batch);
+}
+
+// Append {"n":name,"v":value}, flushing first when the buffer is full
+static void batch_add_text(update_batch_t *batch, const char *name, const char *value, int value_len) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        json_writer_t saved = batch->writer;
+
+        json_writer_begin_object(&batch->writer);
+        json_writer_key(&batch->writer, "n");
+        json_writer_string(&batch->writer, name);
+        json_writer_key(&batch->writer, "v");
+        json_writer_raw(&batch->writer, value, value_len);
+        json_writer_end_object(&batch->writer);
+
+        // Keep room for the closing "]}" and the terminator
+        if (!batch->writer.overflow && batch->writer.len + 3 <= sizeof(batch->buf)) {
+            batch->count++;
+            return;
+        }
+
+        // Roll back the partial entry and retry in an empty message
+        batch->writer = saved;
+        if (batch->count == 0) {
             break;
+        }
+        batch_flush_text(batch);
+    }
+    DBG_WARN("Node %s too long for update message", name);
+}
+
+// Append the node id and raw value, flushing first when the frame is full
+static void batch_add_binary(update_batch_t *batch, const node_t *node) {
+    int width = tag_value_width(node->data_type);
+    if (width == 0) {
+        return;
+    }
+
+    if (batch->bin_len + 2 + width > sizeof(batch->bin)) {
+        batch_flush_binary(batch);
+    }
+    put_le(batch->bin + batch->bin_len, node->id, 2);
+    put_le(batch->bin + batch->bin_len + 2, tag_value_bits(node->data_type, &node->value), width);
+    batch->bin_len += 2 + width;
+    batch->bin_count++;
+}
+
+static void batch_add_value(update_batch_t *batch, const node_t *node, const char *value, int value_len) {
+    if (batch->text) {
+        batch_add_text(batch, node->name, value, value_len);
+    }
+    if (batch->binary) {
+        batch_add_binary(batch, node);
+    }
+}
+
+// Numeric view of a node value for deadband checks
+static double node_value_as_double(const node_t *node, const node_value_t *value) {
+    switch (node->data_type) {
+        case DATA_TYPE_BOOLEAN: return value->bool_val;
+        case DATA_TYPE_INT8: return value->int8_val;
+        case DATA_TYPE_UINT8: return value->uint8_val;
+        case DATA_TYPE_INT16: return value->int16_val;
+        case DATA_TYPE_UINT16: return value->uint16_val;
         case DATA_TYPE_INT32_ABCD:
-        case DATA_TYPE_INT32_CDAB:
-            cJSON_AddNumberToObject(root, "v", node->value.int32_val);
-            break;
+        case DATA_TYPE_INT32_CDAB: return value->int32_val;
         case DATA_TYPE_UINT32_ABCD:
-        case DATA_TYPE_UINT32_CDAB:
-            cJSON_AddNumberToObject(root, "v", node->value.uint32_val);
-            break;
+        case DATA_TYPE_UINT32_CDAB: return value->uint32_val;
         case DATA_TYPE_FLOAT_ABCD:
-        case DATA_TYPE_FLOAT_CDAB:
-            cJSON_AddNumberToObject(root, "v", node->value.float_val);
-            break;
-        case DATA_TYPE_DOUBLE:
-            cJSON_AddNumberToObject(root, "v", node->value.double_val);
-            break;
-        default:
-            DBG_ERROR("Unsupported data type: %d", node->data_type);
-            cJSON_Delete(root);
-            return NULL;
+        case DATA_TYPE_FLOAT_CDAB: return value->float_val;
+        case DATA_TYPE_DOUBLE: return value->double_val;
+        default: return 0;
     }
+}
 
-    // Convert to string
-    char *json_str = cJSON_PrintUnformatted(root);
-    cJSON_Delete(root);
+// True when a value moved from prev to value past the deadband of the node
+static bool node_value_moved(const node_t *node, double prev, double value) {
+    double diff = value - prev;
+    if (diff < 0) {
+        diff = -diff;
+    }
+    // Written so that a NaN on either side counts as a change
+    return node->deadband > 0 ? !(diff < node->deadband) : diff != 0 || diff != diff;
+}
 
-    if (!json_str) {
-        DBG_ERROR("Failed to convert JSON to string");
-        return NULL;
+// True when the value moved past the deadband since it was last published
+static bool node_value_changed(const node_t *node) {
+    return node_value_moved(node, node_value_as_double(node, &node->last_reported),
+                            node_value_as_double(node, &node->value));
+}
+
+// Log and queue a freshly polled value unless report-on-change suppresses it
+static void publish_node(update_batch_t *batch, device_t *device, node_t *node, bool full_refresh) {
+    if (node->report_on_change && node->reported && !full_refresh && !node_value_changed(node)) {
+        DBG_DEBUG("%s.%s unchanged", device->name, node->name);
+        return;
+    }
+
+    char value[JSON_NUMBER_SIZE];
+    int value_len = tag_value_format(node->data_type, &node->value, value);
+    if (value_len < 0) {
+        DBG_ERROR("Unsupported data type: %d", node->data_type);
+        return;
     }
+    DBG_INFO("%s.%s = %s", device->name, node->name, value);
 
-    return json_str;
+    node->last_reported = node->value;
+    node->reported = true;
+    batch_add_value(batch, node, value, value_len);
 }
 
-// Get device configuration from database and parse JSON
-device_t* get_device_config(void) {
-    device_t *head = NULL;
-    device_t *current = NULL;
-    char json_str[8*4096] = {0}; // Adjust size as needed
+// Hand the outcome of a poll to the historian when the quality changed,
+// the value moved past the deadband or the heartbeat is due. Failed polls
+// carry the last good value.
+static void historize_node(node_t *node, uint64_t now_ms) {
+    node_quality_t quality = node->stats.quality;
+    double value = node->stats.last_good_ms ? node_value_as_double(node, &node->value) : NAN;
 
-    // Read JSON string from database
-    int read_len = db_read("device_config", json_str, sizeof(json_str));
-    if (read_len <= 0) {
-        DBG_ERROR("Failed to read device config from database");
-        return NULL;
+    if (node->history_ms != 0 && quality == node->history_quality &&
+        now_ms - node->history_ms < HISTORY_HEARTBEAT_MS &&
+        (quality != NODE_QUALITY_GOOD || !node_value_moved(node, node->history_value, value))) {
+        return;
+    }
+    if (historian_record(node->history_key, now_ms, value, quality)) {
+        node->history_ms = now_ms;
+        node->history_value = value;
+        node->history_quality = quality;
+    }
+}
+
+// Compile a device_config JSON string into one arena
+device_config_t *compile_device_config(const char *json_str, const char **error) {
+    const char *unused;
+    if (!error) {
+        error = &unused;
     }
 
     cJSON *root = cJSON_Parse(json_str);
     if (!root) {
-        DBG_ERROR("Failed to parse device config JSON");
+        *error = "Malformed JSON";
+        return NULL;
+    }
+    if (!cJSON_IsArray(root)) {
+        *error = "Expected an array of devices";
+        cJSON_Delete(root);
         return NULL;
     }
 
+    // Count first so every array is allocated once at its final size
     int device_count = cJSON_GetArraySize(root);
+    int total_nodes = 0;
+    int total_ranges = 0;
     for (int i = 0; i < device_count; i++) {
         cJSON *device_obj = cJSON_GetArrayItem(root, i);
-        
-        device_t *new_device = (device_t*)calloc(1, sizeof(device_t));
-        if (!new_device) {
-            DBG_ERROR("Memory allocation failed for device");
+        cJSON *nodes = cJSON_GetObjectItem(device_obj, "ns");
+        if (!cJSON_IsObject(device_obj) || (nodes && !cJSON_IsArray(nodes))) {
+            *error = "Expected a device object with an array of nodes";
             cJSON_Delete(root);
-            return head;
+            return NULL;
         }
+        total_nodes += cJSON_GetArraySize(nodes);
+        total_ranges += cJSON_GetArraySize(cJSON_GetObjectItem(device_obj, "fb"));
+    }
+    // Node ids are u16
+    if (total_nodes > UINT16_MAX) {
+        *error = "Too many nodes";
+        cJSON_Delete(root);
+        return NULL;
+    }
+
+    // Names and group buffers come on top, about 32 bytes per node
+    arena_t arena;
+    arena_init(&arena, sizeof(device_config_t) +
+                       device_count * sizeof(device_t) +
+                       total_nodes * (sizeof(node_t) + sizeof(node_group_t) + 32) +
+                       total_ranges * sizeof(addr_range_t));
+
+    string_pool_t pool;
+    device_config_t *config = arena_alloc(&arena, sizeof(device_config_t));
+    device_t *devices = arena_alloc(&arena, device_count * sizeof(device_t));
+    node_t *nodes = arena_alloc(&arena, total_nodes * sizeof(node_t));
+    // A group holds at least one node
+    node_group_t *groups = arena_alloc(&arena, total_nodes * sizeof(node_group_t));
+    if (!config || !devices || !nodes || !groups ||
+        string_pool_init(&pool, &arena, total_nodes + device_count) != 0) {
+        DBG_ERROR("Memory allocation failed for %d devices, %d nodes", device_count, total_nodes);
+        *error = "Out of memory";
+        arena_free(&arena);
+        cJSON_Delete(root);
+        return NULL;
+    }
+    config->devices = devices;
+    config->nodes = nodes;
+    config->groups = groups;
+
+    for (int i = 0; i < device_count; i++) {
+        cJSON *device_obj = cJSON_GetArrayItem(root, i);
+        device_t *new_device = &config->devices[config->device_count++];
 
         cJSON *name = cJSON_GetObjectItem(device_obj, "n");
         cJSON *dev_addr = cJSON_GetObjectItem(device_obj, "da");
         cJSON *polling_interval = cJSON_GetObjectItem(device_obj, "pi");
         cJSON *group_mode = cJSON_GetObjectItem(device_obj, "g");
+        cJSON *port = cJSON_GetObjectItem(device_obj, "sp");
+        cJSON *baud = cJSON_GetObjectItem(device_obj, "br");
+        cJSON *parity = cJSON_GetObjectItem(device_obj, "py");
+        cJSON *turnaround = cJSON_GetObjectItem(device_obj, "ta");
+        cJSON *forbidden = cJSON_GetObjectItem(device_obj, "fb");
+        cJSON *refresh = cJSON_GetObjectItem(device_obj, "ri");
+        cJSON *min_timeout = cJSON_GetObjectItem(device_obj, "tm");
         cJSON *nodes = cJSON_GetObjectItem(device_obj, "ns");
 
         if (name && name->valuestring) {
-            new_device->name = strdup(name->valuestring);
+            new_device->name = string_pool_intern(&pool, name->valuestring);
+            if (!new_device->name) {
+                goto fail;
+            }
         }
         if (dev_addr) {
             new_device->device_addr = dev_addr->valueint;
@@ -750,63 +979,125 @@ device_t* get_device_config(void) {
         } else {
             new_device->group_mode = false;  // Default to basic polling mode
         }
+        if (port && port->valuestring && port->valuestring[0] != '\0') {
+            new_device->port = string_pool_intern(&pool, port->valuestring);
+        } else {
+            new_device->port = string_pool_intern(&pool, MODBUS_DEFAULT_PORT);
+        }
+        // same_device() and get_engine() compare ports unchecked
+        if (!new_device->port) {
+            goto fail;
+        }
+        if (baud && cJSON_IsNumber(baud)) {
+            new_device->baud = baud->valueint;
+        } else {
+            new_device->baud = MODBUS_DEFAULT_BAUD;
+        }
+        if (parity && parity->valuestring && parity->valuestring[0] != '\0') {
+            new_device->parity = parity->valuestring[0];
+        } else {
+            new_device->parity = MODBUS_DEFAULT_PARITY;
+        }
+        if (turnaround && cJSON_IsNumber(turnaround)) {
+            new_device->turnaround = turnaround->valueint;
+        } else {
+            new_device->turnaround = MODBUS_DEFAULT_TURNAROUND;
+        }
+        if (forbidden) {
+            parse_forbidden_ranges(new_device, forbidden, &arena);
+        }
+        if (refresh && cJSON_IsNumber(refresh) && refresh->valueint > 0) {
+            new_device->refresh_interval = refresh->valueint;
+        }
+        if (min_timeout && cJSON_IsNumber(min_timeout) && min_timeout->valueint > 0) {
+            new_device->min_timeout = min_timeout->valueint;
+        } else {
+            new_device->min_timeout = MODBUS_MIN_TIMEOUT;
+        }
+        new_device->nodes = &config->nodes[config->node_count];
         if (nodes) {
-            new_device->nodes = parse_nodes(nodes);
-            // Create node groups if group mode is enabled
-            if (new_device->group_mode) {
-                create_node_groups(new_device);
+            int count = parse_nodes(nodes, new_device->nodes, &pool);
+            if (count < 0) {
+                goto fail;
             }
+            new_device->node_count = count;
+            config->node_count += count;
         }
-
-        if (!head) {
-            head = new_device;
-            current = head;
-        } else {
-            current->next = new_device;
-            current = new_device;
+        // Create node groups if group mode is enabled
+        if (new_device->group_mode) {
+            int count = create_node_groups(new_device, &config->groups[config->group_count], &arena);
+            if (count < 0) {
+                goto fail;
+            }
+            config->group_count += count;
         }
     }
 
+    string_pool_free(&pool);
     cJSON_Delete(root);
-    
+    config->arena = arena;
+    return config;
+
+fail:
+    // Out of memory, the allocator said where
+    DBG_ERROR("Failed to compile device configuration");
+    *error = "Out of memory";
+    string_pool_free(&pool);
+    arena_free(&arena);
+    cJSON_Delete(root);
+    return NULL;
+}
+
+// Get device configuration from database and compile it
+device_config_t *get_device_config(void) {
+    const char *error = NULL;
+    char *json_str = config_dup(CONFIG_DEVICE);
+    if (!json_str) {
+        DBG_ERROR("Failed to read device config");
+        return NULL;
+    }
+
+    device_config_t *config = compile_device_config(json_str, &error);
+    free(json_str);
+    if (!config) {
+        DBG_ERROR("Invalid device config: %s", error);
+        return NULL;
+    }
+
     // Log the parsed configuration
-    device_t *device = head;
-    while (device) {
-        DBG_INFO("Device: %s (addr: %d, interval: %dms, group mode: %d)", 
-                 device->name, device->device_addr, 
-                 device->polling_interval, device->group_mode);
+    for (int i = 0; i < config->device_count; i++) {
+        device_t *device = &config->devices[i];
+        DBG_INFO("Device: %s (port: %s %d %c, addr: %d, interval: %dms, group mode: %d)", 
+                 device->name, device->port, device->baud, device->parity,
+                 device->device_addr, device->polling_interval, device->group_mode);
         
-        node_t *node = device->nodes;
-        while (node) {
+        for (int j = 0; j < device->node_count; j++) {
+            node_t *node = &device->nodes[j];
             DBG_INFO("  Node: %s (addr: %d, func: %d, type: %d, timeout: %dms)",
                      node->name, node->address, node->function,
                      node->data_type, node->timeout);
-            node = node->next;
         }
-        device = device->next;
     }
     
-    return head;
+    return config;
 }
 
-// Free entire device configuration linked list
-void free_device_config(device_t *config) {
-    device_t *current = config;
-    while (current) {
-        device_t *next = current->next;
-        free_device(current);
-        current = next;
-    }
+// Free the whole compiled configuration, which lives in its own arena
+void free_device_config(device_config_t *config) {
+    if (!config) return;
+
+    arena_t arena = config->arena;
+    arena_free(&arena);
 }
 
 // Initialize Modbus RTU master with improved error handling
-int rtu_master_init(const char *port, int baud) {
-    if (!port) {
+int rtu_master_init(serial_port_t *sp, const char *port, int baud, char parity) {
+    if (!sp || !port) {
         DBG_ERROR("Invalid port parameter");
         return RTU_MASTER_INVALID;
     }
 
-    int fd = serial_open(port, baud);
+    int fd = serial_port_open(sp, port, baud, parity);
     if (fd < 0) {
         DBG_ERROR("Failed to open serial port %s at %d baud", port, baud);
         return RTU_MASTER_ERROR;
@@ -816,110 +1107,676 @@ int rtu_master_init(const char *port, int baud) {
     return fd;
 }
 
-void rtu_master_poll(agile_modbus_t *ctx, int fd, device_t *config) {
-    if (!config || fd < 0 || !ctx) {
-        DBG_ERROR("Invalid parameters for polling");
+// Count answers and timeouts of a device. Returns true when the device
+// just went offline and the rest of its scan should be skipped.
+static bool track_health(device_t *device, int result) {
+    if (result != RTU_MASTER_TIMEOUT) {
+        // Any answer, even an exception or a garbled frame, means the slave is there
+        device->consecutive_timeouts = 0;
+        return false;
+    }
+
+    if (++device->consecutive_timeouts < DEVICE_OFFLINE_TIMEOUTS || device->offline) {
+        return false;
+    }
+
+    device->offline = true;
+    device->backoff_ms = device->polling_interval * 2;
+    if (device->backoff_ms == 0 || device->backoff_ms > DEVICE_BACKOFF_MAX_MS) {
+        device->backoff_ms = DEVICE_BACKOFF_MAX_MS;
+    }
+    DBG_WARN("Device %s offline after %u timeouts, probing every %u ms",
+             device->name, device->consecutive_timeouts, device->backoff_ms);
+    return true;
+}
+
+// Probe an offline device with a read of its first node. Returns true when
+// it answered and a normal scan should follow, otherwise backs off further.
+static bool probe_device(agile_modbus_t *ctx, serial_port_t *sp, device_t *device) {
+    if (device->node_count == 0) {
+        return false;
+    }
+
+    int result = poll_single_node(ctx, sp, device, &device->nodes[0]);
+    if (result == RTU_MASTER_TIMEOUT) {
+        device->backoff_ms *= 2;
+        if (device->backoff_ms > DEVICE_BACKOFF_MAX_MS) {
+            device->backoff_ms = DEVICE_BACKOFF_MAX_MS;
+        }
+        DBG_DEBUG("Device %s still offline, next probe in %u ms", device->name, device->backoff_ms);
+        return false;
+    }
+
+    device->offline = false;
+    device->consecutive_timeouts = 0;
+    DBG_INFO("Device %s back online", device->name);
+    return true;
+}
+
+// Poll every group or node of one device back to back, the new values go
+// out as one websocket message per scan
+static void poll_device(agile_modbus_t *ctx, serial_port_t *sp, device_t *device, update_batch_t *batch) {
+    DBG_INFO("Polling device: %s (interval: %dms, mode: %s)", 
+             device->name, 
+             device->polling_interval,
+             device->group_mode ? "group" : "basic");
+    
+    agile_modbus_set_slave(ctx, device->device_addr);
+
+    // A dead slave costs one cheap request per back-off period, not a
+    // full timeout for each of its nodes on every scan
+    if (device->offline && !probe_device(ctx, sp, device)) {
         return;
     }
 
-    device_t *current_device = config;
-    while (current_device) {
-        DBG_INFO("Polling device: %s (interval: %dms, mode: %s)", 
-                 current_device->name, 
-                 current_device->polling_interval,
-                 current_device->group_mode ? "group" : "basic");
-        
-        agile_modbus_set_slave(ctx, current_device->device_addr);
-        
-        if (current_device->group_mode) {
-            // Poll each group
-            node_group_t *current_group = current_device->groups;
-            while (current_group) {
-                int result = poll_group_node(ctx, fd, current_device, current_group);
-                if (result != RTU_MASTER_OK) {
-                    DBG_ERROR("Failed to poll group %d (error: %d)", 
-                             current_group->function, result);
-                }
-                // Sleep after each group poll
-                usleep(current_device->polling_interval * 1000);
-                current_group = current_group->next;
+    batch_reset(batch);
+
+    // Periodically publish every value, even unchanged ones, so clients resync
+    uint64_t now = poll_scheduler_now_ms();
+    bool full_refresh = device->refresh_interval &&
+                        now - device->last_refresh_ms >= device->refresh_interval;
+    if (full_refresh) {
+        device->last_refresh_ms = now;
+    }
+    
+    if (device->group_mode) {
+        // Poll each group
+        for (int g = 0; g < device->group_count; g++) {
+            node_group_t *current_group = &device->groups[g];
+            uint64_t start_us = monotonic_us();
+            int result = poll_group_node(ctx, sp, device, current_group);
+            uint32_t rt_us = monotonic_us() - start_us;
+            uint64_t now_ms = tag_clock_ms();
+
+            record_poll(&current_group->stats, result, rt_us, now_ms);
+            if (result != RTU_MASTER_OK) {
+                DBG_ERROR("Failed to poll group %d (error: %d)", 
+                         current_group->function, result);
             }
-        } else {
-            // Basic polling mode - poll each node individually
-            node_t *current_node = current_device->nodes;
-            while (current_node) {
-                int result = poll_single_node(ctx, fd, current_device, current_node);
-                if (result != RTU_MASTER_OK) {
-                    DBG_ERROR("Failed to poll node %s (error: %d)", 
-                             current_node->name, result);
+
+            // Every node of the group shares the outcome of its read
+            for (int i = 0; i < current_group->node_count; i++) {
+                node_t *node = &current_group->nodes[i];
+                node->stats.last_exception = current_group->stats.last_exception;
+                record_poll(&node->stats, result, rt_us, now_ms);
+                tag_table_update(node);
+                historize_node(node, now_ms);
+                if (result == RTU_MASTER_OK) {
+                    publish_node(batch, device, node, full_refresh);
                 }
-                // Sleep after each node poll
-                usleep(current_device->polling_interval * 1000);
-                current_node = current_node->next;
+            }
+            if (track_health(device, result)) {
+                break;
+            }
+        }
+    } else {
+        // Basic polling mode - poll each node individually
+        for (int i = 0; i < device->node_count; i++) {
+            node_t *current_node = &device->nodes[i];
+            uint64_t start_us = monotonic_us();
+            int result = poll_single_node(ctx, sp, device, current_node);
+            uint32_t rt_us = monotonic_us() - start_us;
+            uint64_t now_ms = tag_clock_ms();
+
+            record_poll(&current_node->stats, result, rt_us, now_ms);
+            tag_table_update(current_node);
+            historize_node(current_node, now_ms);
+            if (result != RTU_MASTER_OK) {
+                DBG_ERROR("Failed to poll node %s (error: %d)", 
+                         current_node->name, result);
+            } else {
+                publish_node(batch, device, current_node, full_refresh);
+            }
+            if (track_health(device, result)) {
+                break;
             }
         }
-        
-        current_device = current_device->next;
     }
+
+    batch_flush(batch);
 }
 
-static void *rtu_master_thread(void *arg) {
-    int fd;
-    uint8_t master_send_buf[MODBUS_MAX_ADU_LENGTH];
-    uint8_t master_recv_buf[MODBUS_MAX_ADU_LENGTH];
+// Enter a device scan, waiting while a reload holds the model. Returns
+// the generation of the configuration the scan runs on.
+static unsigned begin_scan(void) {
+    pthread_mutex_lock(&s_model_lock);
+    while (s_reloading) {
+        pthread_cond_wait(&s_model_cond, &s_model_lock);
+    }
+    s_scanning++;
+    unsigned generation = s_generation;
+    pthread_mutex_unlock(&s_model_lock);
+    return generation;
+}
 
-    agile_modbus_rtu_t ctx_rtu;
-    agile_modbus_t *ctx = &ctx_rtu._ctx;
+static void end_scan(void) {
+    pthread_mutex_lock(&s_model_lock);
+    if (--s_scanning == 0 && s_reloading) {
+        pthread_cond_broadcast(&s_model_cond);
+    }
+    pthread_mutex_unlock(&s_model_lock);
+}
 
-    agile_modbus_rtu_init(&ctx_rtu, master_send_buf, sizeof(master_send_buf),
-                         master_recv_buf, sizeof(master_recv_buf));
-    
-    device_t *config = get_device_config();
-    if (!config) {
-        DBG_ERROR("Invalid configuration for RTU master thread");
-        goto exit;
+// Wait for every engine to finish its current scan and keep them out
+static void begin_reload(void) {
+    pthread_mutex_lock(&s_model_lock);
+    s_reloading = true;
+    while (s_scanning > 0) {
+        pthread_cond_wait(&s_model_cond, &s_model_lock);
     }
+    pthread_mutex_unlock(&s_model_lock);
+}
 
-    // Initialize serial port
-    fd = rtu_master_init(DEFAULT_PORT, DEFAULT_BAUD);
-    if (fd < 0) {
-        DBG_ERROR("Failed to initialize RTU master");
-        goto exit;
+static void end_reload(void) {
+    pthread_mutex_lock(&s_model_lock);
+    s_reloading = false;
+    s_generation++;
+    pthread_cond_broadcast(&s_model_cond);
+    pthread_mutex_unlock(&s_model_lock);
+}
+
+// Sleep until due_ms (monotonic), or until a reload replaced the schedule
+// of the given generation
+static void wait_until(uint64_t due_ms, unsigned generation) {
+    uint64_t now = poll_scheduler_now_ms();
+    if (due_ms <= now) {
+        return;
     }
 
-    DBG_INFO("RTU master polling thread started");
+    // The condition variable times out on the realtime clock
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    uint64_t ns = ts.tv_nsec + (due_ms - now) * 1000000ULL;
+    ts.tv_sec += ns / 1000000000ULL;
+    ts.tv_nsec = ns % 1000000000ULL;
 
-    method_ws_log = get_log_method();
+    pthread_mutex_lock(&s_model_lock);
+    while (generation == s_generation) {
+        if (pthread_cond_timedwait(&s_model_cond, &s_model_lock, &ts) == ETIMEDOUT) {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&s_model_lock);
+}
+
+// Run the device scan that is due, or sleep until one is or a reload
+// changed the schedule
+void rtu_master_poll(agile_modbus_t *ctx, serial_port_t *sp, poll_scheduler_t *sched, update_batch_t *batch) {
+    if (!sched || !sp || sp->fd < 0 || !ctx || !batch) {
+        DBG_ERROR("Invalid parameters for polling");
+        return;
+    }
+
+    unsigned generation = begin_scan();
+    poll_task_t *task = poll_scheduler_peek(sched);
+    uint64_t now = poll_scheduler_now_ms();
+    if (!task || task->due_ms > now) {
+        uint64_t due = task ? task->due_ms : now + MODBUS_POLLING_INTERVAL;
+        end_scan();
+        wait_until(due, generation);
+        return;
+    }
+
+    device_t *device = task->device;
+    poll_device(ctx, sp, device, batch);
+    tag_table_update_device(device);
+
+    // polling_interval is the sample period: the next scan is due one period
+    // after the previous due time, not after the scan finished. An offline
+    // device is only probed, once per back-off period.
+    uint32_t interval = device->offline ? device->backoff_ms : device->polling_interval;
+    now = poll_scheduler_now_ms();
+    uint64_t next = task->due_ms + interval;
+    if (next <= now) {
+        // Scan overran its period, skip the missed slots instead of bursting
+        uint64_t period = interval ? interval : 1;
+        next += ((now - next) / period + 1) * period;
+    }
+    poll_scheduler_reschedule(sched, next);
+    end_scan();
+}
+
+// Open the line of an engine, reopening it when a reload changed its
+// settings and closing it when no device is left on it. False while the
+// line is closed.
+static bool open_line(rtu_engine_t *engine, unsigned *generation) {
+    *generation = begin_scan();
+    bool reopen = engine->reopen;
+    int baud = engine->baud;
+    char parity = engine->parity;
+    int device_count = engine->sched.count;
+    engine->reopen = false;
+    end_scan();
+
+    if ((reopen || device_count == 0) && engine->serial.fd >= 0) {
+        serial_port_close(&engine->serial);
+    }
+    if (engine->serial.fd >= 0) {
+        return true;
+    }
+    if (device_count == 0) {
+        return false;
+    }
+    return rtu_master_init(&engine->serial, engine->port, baud, parity) >= 0;
+}
+
+static void *rtu_master_thread(void *arg) {
+    rtu_engine_t *engine = (rtu_engine_t *)arg;
+    agile_modbus_t *ctx = &engine->ctx_rtu._ctx;
+
+    agile_modbus_rtu_init(&engine->ctx_rtu, engine->send_buf, sizeof(engine->send_buf),
+                         engine->recv_buf, sizeof(engine->recv_buf));
+
+    DBG_INFO("RTU master polling thread started on %s", engine->port);
 
     // Run continuously
     while (1) {
-        // Poll all devices (each device handles its own polling interval)
-        rtu_master_poll(ctx, fd, config);
+        unsigned generation;
+        if (!open_line(engine, &generation)) {
+            // Retry a line that failed to open, a reload wakes us earlier
+            wait_until(poll_scheduler_now_ms() + MODBUS_REOPEN_INTERVAL, generation);
+            continue;
+        }
+
+        // Poll whichever device on this line is due next
+        rtu_master_poll(ctx, &engine->serial, &engine->sched, &engine->batch);
     }
 
-    exit:
-    if(config) {
-        free_device_config(config);
+    serial_port_close(&engine->serial);
+    return NULL;
+}
+
+// Index of the engine for a serial line, creating it on first use. The
+// first device of a reload on an existing line sets its settings again.
+static int get_engine(device_t *device, bool *claimed) {
+    for (int i = 0; i < s_engine_count; i++) {
+        rtu_engine_t *engine = s_engines[i];
+        if (strcmp(engine->port, device->port) != 0) {
+            continue;
+        }
+        if (!claimed[i]) {
+            claimed[i] = true;
+            if (engine->baud != device->baud || engine->parity != device->parity) {
+                engine->baud = device->baud;
+                engine->parity = device->parity;
+                engine->reopen = true;
+            }
+        } else if (engine->baud != device->baud || engine->parity != device->parity) {
+            DBG_WARN("Device %s: %s already configured as %d %c, ignoring %d %c",
+                     device->name, device->port, engine->baud, engine->parity,
+                     device->baud, device->parity);
+        }
+        return i;
+    }
+
+    if (s_engine_count >= MODBUS_MAX_PORTS) {
+        DBG_ERROR("Too many serial ports, device %s on %s not polled", device->name, device->port);
+        return -1;
+    }
+
+    rtu_engine_t *engine = calloc(1, sizeof(rtu_engine_t));
+    if (!engine) {
+        DBG_ERROR("Failed to allocate memory for RTU engine");
+        return -1;
+    }
+    strncpy(engine->port, device->port, sizeof(engine->port) - 1);
+    engine->baud = device->baud;
+    engine->parity = device->parity;
+    engine->serial.fd = -1;
+    engine->serial.epfd = -1;
+    engine->serial.tfd = -1;
+
+    claimed[s_engine_count] = true;
+    s_engines[s_engine_count] = engine;
+    return s_engine_count++;
+}
+
+static int compare_history_keys(const void *a, const void *b) {
+    const node_t *x = *(const node_t *const *)a;
+    const node_t *y = *(const node_t *const *)b;
+
+    if (x->history_key != y->history_key) {
+        return x->history_key < y->history_key ? -1 : 1;
     }
+    return 0;
+}
+
+// Nodes sharing a history key would read each other's history
+static void check_history_keys(device_config_t *config) {
+    if (config->node_count < 2) return;
+
+    node_t **sorted = malloc(config->node_count * sizeof(node_t *));
+    if (!sorted) return;
+
+    for (int i = 0; i < config->node_count; i++) {
+        sorted[i] = &config->nodes[i];
+    }
+    qsort(sorted, config->node_count, sizeof(node_t *), compare_history_keys);
+    for (int i = 1; i < config->node_count; i++) {
+        if (sorted[i]->history_key == sorted[i - 1]->history_key) {
+            DBG_WARN("Nodes %s and %s share history key %08x, rename one of them",
+                     sorted[i - 1]->name ? sorted[i - 1]->name : "?",
+                     sorted[i]->name ? sorted[i]->name : "?", sorted[i]->history_key);
+        }
+    }
+    free(sorted);
+}
 
-    if(fd >= 0) {
-        serial_close(fd);
+// Number the devices and nodes by their index, key their history and build
+// the tag table for them, published by the caller once the values are seeded
+static int register_nodes(device_config_t *config) {
+    if (config->node_count > UINT16_MAX) {
+        DBG_ERROR("Too many nodes: %d", config->node_count);
+        return -1;
+    }
+    if (tag_table_init(config->node_count, config->device_count) != 0) {
+        return -1;
     }
 
+    for (int i = 0; i < config->device_count; i++) {
+        device_t *device = &config->devices[i];
+        device->id = i;
+        tag_table_define_device(device);
+        for (int j = 0; j < device->node_count; j++) {
+            node_t *node = &device->nodes[j];
+            node->id = node - config->nodes;
+            node->history_key = historian_key(device->name, node->name);
+            tag_table_define(device, node);
+        }
+    }
+    check_history_keys(config);
+    return 0;
+}
+
+static bool same_device(const device_t *a, const device_t *b) {
+    return a->name && b->name && strcmp(a->name, b->name) == 0 &&
+           strcmp(a->port, b->port) == 0 && a->device_addr == b->device_addr;
+}
+
+static bool same_node(const node_t *a, const node_t *b) {
+    return a->name && b->name && strcmp(a->name, b->name) == 0 && a->address == b->address &&
+           a->function == b->function && a->data_type == b->data_type;
+}
+
+// The running device a new one replaces: same name, line and slave
+// address. Most edits leave devices where they were, so the same index is
+// tried first.
+static device_t *find_running_device(int index, const device_t *device) {
+    if (!s_config) {
+        return NULL;
+    }
+    if (index < s_config->device_count && same_device(&s_config->devices[index], device)) {
+        return &s_config->devices[index];
+    }
+    for (int i = 0; i < s_config->device_count; i++) {
+        if (same_device(&s_config->devices[i], device)) {
+            return &s_config->devices[i];
+        }
+    }
     return NULL;
 }
 
-void start_rtu_master(void) {
+// The node of prev a new node replaces: same name reading the same data,
+// looked for at the same index first
+static node_t *find_running_node(const device_t *prev, int index, const node_t *node) {
+    if (index < prev->node_count && same_node(&prev->nodes[index], node)) {
+        return &prev->nodes[index];
+    }
+    for (int i = 0; i < prev->node_count; i++) {
+        if (same_node(&prev->nodes[i], node)) {
+            return &prev->nodes[i];
+        }
+    }
+    return NULL;
+}
+
+// Carry what a running device learned over to the one replacing it.
+// Returns the number of nodes that kept their value and statistics.
+static int adopt_device(device_t *device, const device_t *prev) {
+    int kept = 0;
+
+    device->last_refresh_ms = prev->last_refresh_ms;
+    device->consecutive_timeouts = prev->consecutive_timeouts;
+    device->offline = prev->offline;
+    device->backoff_ms = prev->backoff_ms;
+
+    // Latencies only carry over at the same line settings
+    if (prev->baud == device->baud && prev->parity == device->parity) {
+        device->srtt_us = prev->srtt_us;
+        device->rttvar_us = prev->rttvar_us;
+        device->rto_ms = prev->rto_ms;
+        device->rtt_samples = prev->rtt_samples;
+    }
+
+    for (int i = 0; i < device->node_count; i++) {
+        node_t *node = &device->nodes[i];
+        node_t *old = find_running_node(prev, i, node);
+        if (!old) {
+            continue;
+        }
+        node->value = old->value;
+        node->stats = old->stats;
+        node->reported = old->reported;
+        node->last_reported = old->last_reported;
+        node->history_ms = old->history_ms;
+        node->history_value = old->history_value;
+        node->history_quality = old->history_quality;
+        kept++;
+    }
+
+    for (int i = 0; i < device->group_count; i++) {
+        node_group_t *group = &device->groups[i];
+        for (int j = 0; j < prev->group_count; j++) {
+            const node_group_t *old = &prev->groups[j];
+            if (old->function == group->function && old->start_address == group->start_address &&
+                old->register_count == group->register_count) {
+                group->stats = old->stats;
+                break;
+            }
+        }
+    }
+    return kept;
+}
+
+// When the running device is due next, 0 if it is not scheduled
+static uint64_t find_due_time(const device_t *prev) {
+    for (int i = 0; i < s_engine_count; i++) {
+        poll_scheduler_t *sched = &s_engines[i]->sched;
+        for (int j = 0; j < sched->count; j++) {
+            if (sched->tasks[j].device == prev) {
+                return sched->tasks[j].due_ms;
+            }
+        }
+    }
+    return 0;
+}
+
+// Make config the running configuration, with every engine out of its
+// scan. Unchanged devices and nodes keep their state and their place in
+// the schedule, new ones are due at once. Returns the number of nodes
+// kept, -1 on error with the running configuration left in place.
+static int apply_config(device_config_t *config) {
+    poll_scheduler_t scheds[MODBUS_MAX_PORTS] = {0};
+    bool claimed[MODBUS_MAX_PORTS] = {false};
+    uint64_t now = poll_scheduler_now_ms();
+    int kept = 0;
+
+    if (register_nodes(config) != 0) {
+        return -1;
+    }
+
+    for (int d = 0; d < config->device_count; d++) {
+        device_t *device = &config->devices[d];
+        device_t *prev = find_running_device(d, device);
+        uint64_t due = now;
+        if (prev) {
+            kept += adopt_device(device, prev);
+            uint64_t prev_due = find_due_time(prev);
+            if (prev_due != 0 && prev_due < now + device->polling_interval) {
+                due = prev_due;
+            }
+        }
+
+        // Seed the new table so readers see no gap for kept nodes
+        tag_table_update_device(device);
+        for (int i = 0; i < device->node_count; i++) {
+            tag_table_update(&device->nodes[i]);
+        }
+
+        int i = get_engine(device, claimed);
+        if (i < 0) {
+            continue;
+        }
+        if (poll_scheduler_add(&scheds[i], device, due) != 0) {
+            DBG_ERROR("Failed to schedule device %s", device->name);
+        }
+    }
+    tag_table_publish();
+
+    // A line no device is left on is closed by its engine
+    for (int i = 0; i < s_engine_count; i++) {
+        poll_scheduler_free(&s_engines[i]->sched);
+        s_engines[i]->sched = scheds[i];
+    }
+
+    // tag_table_publish() waited out the readers of the replaced names
+    device_config_t *prev = s_config;
+    s_config = config;
+    free_device_config(prev);
+    method_ws_log = get_log_method();
+    return kept;
+}
+
+// One independent poll thread per serial line
+static void start_engines(int first) {
+    for (int i = first; i < s_engine_count; i++) {
+        pthread_t thread;
+        pthread_attr_t attr;
+        
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        
+        int ret = pthread_create(&thread, &attr, rtu_master_thread, s_engines[i]);
+        if (ret != 0) {
+            DBG_ERROR("Failed to create RTU master thread for %s: %s",
+                      s_engines[i]->port, strerror(ret));
+        }
+        
+        pthread_attr_destroy(&attr);
+    }
+}
+
+// Announce id -> name/type to binary websocket clients:
+// {"type":"schema","nodes":[{"id":0,"n":"node0101","t":10},...]}
+static void publish_node_schema(device_config_t *config) {
+    size_t size = 64;
+
+    for (int i = 0; i < config->node_count; i++) {
+        size += strlen(config->nodes[i].name) + 48;
+    }
+
+    // Names needing \u escapes can outgrow the estimate, retry once larger
+    for (int attempt = 0; attempt < 2; attempt++, size *= 6) {
+        char *buf = malloc(size);
+        if (!buf) {
+            DBG_ERROR("Failed to allocate memory for node schema");
+            return;
+        }
+
+        json_writer_t w;
+        json_writer_init(&w, buf, size);
+        json_writer_begin_object(&w);
+        json_writer_key(&w, "type");
+        json_writer_string(&w, "schema");
+        json_writer_key(&w, "nodes");
+        json_writer_begin_array(&w);
+        for (int i = 0; i < config->node_count; i++) {
+            const node_t *node = &config->nodes[i];
+            json_writer_begin_object(&w);
+            json_writer_key(&w, "id");
+            json_writer_uint(&w, node->id);
+            json_writer_key(&w, "n");
+            json_writer_string(&w, node->name);
+            json_writer_key(&w, "t");
+            json_writer_int(&w, node->data_type);
+            json_writer_end_object(&w);
+        }
+        json_writer_end_array(&w);
+        json_writer_end_object(&w);
+
+        if (json_writer_finish(&w) >= 0) {
+            websocket_set_schema(buf);
+            free(buf);
+            return;
+        }
+        free(buf);
+    }
+    DBG_ERROR("Failed to build node schema");
+}
+
+// Load device_config and make it the running configuration. Parsing
+// happens while the engines keep polling; they only pause for the swap.
+// It is read under s_reload_lock, so of two reloads racing the one
+// applied last has read the latest stored configuration.
+static int load_device_config(void) {
+    pthread_mutex_lock(&s_reload_lock);
+    device_config_t *config = get_device_config();
+    if (!config) {
+        pthread_mutex_unlock(&s_reload_lock);
+        DBG_ERROR("Invalid device configuration, keeping the running one");
+        return -1;
+    }
+
+    int first = s_engine_count;
+    uint64_t start = poll_scheduler_now_ms();
+    begin_reload();
+    int kept = apply_config(config);
+    if (kept >= 0) {
+        // Wakeups are delivered in order: queued while the engines are
+        // paused, the schema reaches binary clients before any update
+        // frame numbered by it
+        publish_node_schema(config);
+    }
+    end_reload();
+    uint64_t paused = poll_scheduler_now_ms() - start;
+
+    if (kept < 0) {
+        pthread_mutex_unlock(&s_reload_lock);
+        DBG_ERROR("Failed to apply device configuration");
+        free_device_config(config);
+        return -1;
+    }
+    start_engines(first);
+    pthread_mutex_unlock(&s_reload_lock);
+
+    DBG_INFO("Device configuration applied, polling paused %llu ms, %d nodes kept",
+             (unsigned long long)paused, kept);
+    return 0;
+}
+
+static void *reload_thread(void *arg) {
+    (void)arg;
+    load_device_config();
+    return NULL;
+}
+
+void rtu_master_reload(void) {
     pthread_t thread;
     pthread_attr_t attr;
-    
+
     pthread_attr_init(&attr);
     pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
-    
-    int ret = pthread_create(&thread, &attr, rtu_master_thread, NULL);
+
+    int ret = pthread_create(&thread, &attr, reload_thread, NULL);
     if (ret != 0) {
-        DBG_ERROR("Failed to create RTU master thread: %s", strerror(ret));
+        DBG_ERROR("Failed to create device config reload thread: %s", strerror(ret));
     }
-    
+
     pthread_attr_destroy(&attr);
 }
+
+void start_rtu_master(void) {
+    if (load_device_config() != 0) {
+        DBG_ERROR("Invalid configuration for RTU master");
+    }
+}
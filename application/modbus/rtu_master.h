@@ -6,17 +6,50 @@
 #include <stdlib.h>
 #include <string.h>
 #include "agile_modbus.h"
+#include "serial.h"
+#include "json_writer.h"
+#include "arena.h"
 
 #define MODBUS_MAX_ADU_LENGTH 256
 #define MODBUS_RTU_TIMEOUT 1000
+#define MODBUS_MIN_TIMEOUT 20  // Floor of the learned response timeout in milliseconds
 #define MODBUS_POLLING_INTERVAL 1000
+#define MODBUS_REOPEN_INTERVAL 10000  // Retry period of a serial line that failed to open
 #define MODBUS_MAX_REGISTERS 125
+#define MODBUS_MAX_BITS 2000
+#define MODBUS_DEFAULT_TURNAROUND 10  // Slave response delay in milliseconds
+#define MODBUS_MAX_PORTS 4
+#define MODBUS_DEFAULT_PORT "/dev/ttymxc1"
+#define MODBUS_DEFAULT_BAUD 115200
+#define MODBUS_DEFAULT_PARITY 'N'
+#define MODBUS_UPDATE_BATCH_SIZE 4096  // Must fit one mg_wakeup() message
+
+// Binary update frame (WS_BINARY_PROTOCOL), little endian:
+//   u8 UPDATE_FRAME_VALUES, u16 count, then count times
+//   u16 node id + the value, 1, 2, 4 or 8 bytes wide by the node type
+//   given in the schema. Floats and doubles are sent as IEEE 754 bits.
+#define UPDATE_FRAME_VALUES 1
+#define UPDATE_FRAME_HEADER 3
 
 // Error codes
 #define RTU_MASTER_OK          0
 #define RTU_MASTER_ERROR      -1
 #define RTU_MASTER_TIMEOUT    -2
 #define RTU_MASTER_INVALID    -3
+#define RTU_MASTER_EXCEPTION  -4  // Slave answered with a Modbus exception
+
+// A good value older than this many polling intervals is reported stale
+#define NODE_STALE_PERIODS 3
+
+// Historize an unchanged good value again after this long (ms), so
+// flat signals still have a sample in every history bucket of that size
+#define HISTORY_HEARTBEAT_MS 60000
+
+// Circuit breaker: after this many requests in a row without an answer a
+// device is taken offline and only probed, with a period doubling from
+// two polling intervals up to DEVICE_BACKOFF_MAX_MS
+#define DEVICE_OFFLINE_TIMEOUTS 3
+#define DEVICE_BACKOFF_MAX_MS 60000
 
 // Data type enumeration
 typedef enum {
@@ -47,16 +80,51 @@ typedef union {
     double double_val;
 } node_value_t;
 
+// Quality of the value of a node
+typedef enum {
+    NODE_QUALITY_NONE = 0,      // Not read since start
+    NODE_QUALITY_GOOD,          // Value from the last poll
+    NODE_QUALITY_STALE,         // Last poll was good, but too long ago
+    NODE_QUALITY_TIMEOUT,       // Last poll got no answer
+    NODE_QUALITY_EXCEPTION,     // Last poll got a Modbus exception
+    NODE_QUALITY_ERROR,         // Last poll failed on CRC, framing or I/O
+} node_quality_t;
+
+// Outcome of the polls of a node or group
+typedef struct {
+    node_quality_t quality;         // Of the last poll, never STALE
+    uint64_t last_good_ms;          // Wall clock time of the last good poll, 0 if none
+    uint32_t consecutive_failures;
+    uint32_t good;
+    uint32_t timeouts;
+    uint32_t exceptions;
+    uint32_t errors;
+    uint8_t last_exception;         // Exception code of the last exception answer
+    uint32_t responses;             // Answers timed below, good or exception
+    uint32_t rt_min_us;             // Request sent to response received
+    uint32_t rt_max_us;
+    uint64_t rt_total_us;
+} poll_stats_t;
+
 // Structure for a single node
 typedef struct node {
-    char *name;
+    const char *name;             // Interned in the config arena
     uint16_t address;
     uint8_t function;
     data_type_t data_type;
     uint32_t timeout;  // Timeout in milliseconds for serial read
     node_value_t value;  // Store the converted value
-    struct node *next;
     uint16_t offset;  // Offset in the merged data array
+    bool report_on_change;        // Publish only when the value moves past the deadband
+    double deadband;              // Minimum change worth publishing, 0 for any change
+    bool reported;                // last_reported holds a published value
+    node_value_t last_reported;   // Value last sent to clients
+    uint16_t id;                  // Index in device_config_t.nodes and the tag table, announced in the websocket node schema
+    poll_stats_t stats;
+    uint32_t history_key;         // historian_key() of device and node name, unlike id stable across edits
+    uint64_t history_ms;          // Wall clock time of the last historized sample, 0 if none
+    double history_value;         // and its value and quality
+    node_quality_t history_quality;
 } node_t;
 
 // Structure for merged nodes with same function code
@@ -64,27 +132,90 @@ typedef struct node_group {
     uint8_t function;           // Function code for this group
     uint16_t start_address;     // Starting address of the merged range
     uint16_t register_count;    // Total number of registers to read
-    node_t *nodes;             // Linked list of nodes in this group
+    uint16_t node_count;        // Number of nodes in this group
+    node_t *nodes;             // First of its node_count consecutive nodes
     uint16_t *data_buffer;     // Buffer to store raw data for all nodes
-    struct node_group *next;   // Next group in the list
+    uint32_t timeout;           // Longest "t" of its nodes, bounds the response timeout
+    poll_stats_t stats;        // Polls of the whole group, also recorded on each node
 } node_group_t;
 
-// Device structure to store device configuration with linked list of nodes
+// Address range a slave rejects, never bridged by a group read
+typedef struct {
+    uint8_t function;           // Function code, 0 for all
+    uint16_t start;             // First forbidden address
+    uint16_t end;               // Last forbidden address (inclusive)
+} addr_range_t;
+
+// Device structure to store device configuration and its slice of nodes
 typedef struct device {
-    char *name;
+    const char *name;
+    const char *port;           // Serial line the device is attached to
+    int baud;                   // Baud rate of that line
+    char parity;                // 'N', 'E' or 'O'
     uint8_t device_addr;
     uint32_t polling_interval;  // Polling interval in milliseconds
+    uint32_t refresh_interval;  // Publish every value this often (ms) so clients resync, 0 = never
+    uint64_t last_refresh_ms;   // Monotonic time of the last full refresh
+    uint32_t consecutive_timeouts; // Requests in a row the slave did not answer
+    bool offline;               // Circuit open: one probe per backoff_ms instead of scans
+    uint32_t backoff_ms;        // Current probe period while offline
+    uint32_t min_timeout;       // Floor of the learned response timeout (ms)
+    uint32_t srtt_us;           // Smoothed response latency, 0 until the first sample
+    uint32_t rttvar_us;         // Smoothed latency deviation
+    uint32_t rto_ms;            // Learned response timeout, 0 until the first sample
+    uint32_t rtt_samples;
+    uint16_t id;                // Index in device_config_t.devices and the tag table
     bool group_mode;           // True for group polling, false for basic polling
-    node_t *nodes;             // Original list of nodes
-    node_group_t *groups;      // List of merged node groups (used when group_mode is true)
-    struct device *next;
+    uint32_t turnaround;       // Slave response delay in milliseconds, used to cost group reads
+    addr_range_t *forbidden;   // Ranges the group optimizer must not read across
+    int forbidden_count;
+    node_t *nodes;             // First of its node_count consecutive nodes, sorted by
+    int node_count;            // function and address in group mode
+    node_group_t *groups;      // Merged node groups (used when group_mode is true)
+    int group_count;
 } device_t;
 
+// Compiled device_config: devices, groups and nodes each in one array,
+// indexed by id, with every name interned. All of it, group read buffers
+// included, lives in one arena and is released with a single free.
+typedef struct {
+    device_t *devices;
+    int device_count;
+    node_group_t *groups;
+    int group_count;
+    node_t *nodes;
+    int node_count;
+    arena_t arena;
+} device_config_t;
+
+// Websocket value updates collected during one device scan
+typedef struct {
+    char buf[MODBUS_UPDATE_BATCH_SIZE];
+    json_writer_t writer;
+    int count;
+    uint8_t bin[MODBUS_UPDATE_BATCH_SIZE];  // Binary frame for WS_BINARY_PROTOCOL clients
+    size_t bin_len;
+    int bin_count;
+    bool text;                  // Text clients were connected when the scan began
+    bool binary;                // Binary clients were connected when the scan began
+} update_batch_t;
+
+struct poll_scheduler;
+
 // Function declarations
-int rtu_master_init(const char *port, int baud);
-void rtu_master_poll(agile_modbus_t *ctx,int fd, device_t *config);
-device_t *get_device_config(void);
-void free_device_config(device_t *config);
+int rtu_master_init(serial_port_t *sp, const char *port, int baud, char parity);
+void rtu_master_poll(agile_modbus_t *ctx, serial_port_t *sp, struct poll_scheduler *sched, update_batch_t *batch);
+device_config_t *get_device_config(void);
+// Compile a device_config JSON string. NULL if it is not a valid
+// configuration, with *error saying why.
+device_config_t *compile_device_config(const char *json_str, const char **error);
+void free_device_config(device_config_t *config);
 void start_rtu_master(void);
 
+// Apply the stored device_config to the running engines without a
+// restart. Returns at once; the engines pause between two device scans
+// while the new configuration is swapped in, and unchanged devices and
+// nodes keep their statistics, last values and schedule.
+void rtu_master_reload(void);
+
 #endif
@@ -6,12 +6,16 @@
 #include <unistd.h>
 #include <sys/select.h>
 #include <sys/time.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <poll.h>
+#include <time.h>
 #include <errno.h>
 #define DBG_TAG "SERIAL"
 #define DBG_LVL LOG_INFO
 #include "dbg.h"
 
-int serial_open(const char *port, int baud) {
+int serial_open(const char *port, int baud, char parity) {
     struct termios tty;
     int fd;
 
@@ -32,6 +36,9 @@ int serial_open(const char *port, int baud) {
     // Set baud rate
     speed_t speed;
     switch (baud) {
+        case 1200:   speed = B1200;   break;
+        case 2400:   speed = B2400;   break;
+        case 4800:   speed = B4800;   break;
         case 9600:   speed = B9600;   break;
         case 19200:  speed = B19200;  break;
         case 38400:  speed = B38400;  break;
@@ -45,8 +52,19 @@ int serial_open(const char *port, int baud) {
     cfsetispeed(&tty, speed);
     cfsetospeed(&tty, speed);
 
-    // 8N1 (8 bits, no parity, 1 stop bit)
-    tty.c_cflag &= ~PARENB;  // No parity
+    // 8 data bits, 1 stop bit, parity as requested (N, E or O)
+    switch (parity) {
+        case 'E': case 'e':
+            tty.c_cflag |= PARENB;   // Even parity
+            tty.c_cflag &= ~PARODD;
+            break;
+        case 'O': case 'o':
+            tty.c_cflag |= PARENB | PARODD;  // Odd parity
+            break;
+        default:
+            tty.c_cflag &= ~PARENB;  // No parity
+            break;
+    }
     tty.c_cflag &= ~CSTOPB;  // 1 stop bit
     tty.c_cflag &= ~CSIZE;   // Clear size bits
     tty.c_cflag |= CS8;      // 8 bits
@@ -73,7 +91,7 @@ int serial_open(const char *port, int baud) {
         return -1;
     }
 
-    DBG_INFO("Serial port %s opened successfully", port);
+    DBG_INFO("Serial port %s opened successfully (%d %c)", port, baud, parity);
     return fd;
 }
 
@@ -185,6 +203,259 @@ void serial_flush(int fd) {
     }
 }
 
+// Time on the wire for one character: start bit, 8 data bits, optional parity, stop bit
+uint32_t serial_char_time_us(int baud, char parity) {
+    if (baud <= 0) {
+        return 0;
+    }
+    int bits = (parity == 'E' || parity == 'e' || parity == 'O' || parity == 'o') ? 11 : 10;
+    return (uint32_t)((bits * 1000000ULL + baud - 1) / baud);
+}
+
+// Inter-frame silence (t3.5); fixed at 1750us above 19200 baud per the RTU spec
+uint32_t serial_t35_us(int baud, char parity) {
+    if (baud > 19200) {
+        return 1750;
+    }
+    return serial_char_time_us(baud, parity) * 7 / 2;
+}
+
+// Open a serial line together with its epoll set and timerfd
+int serial_port_open(serial_port_t *sp, const char *port, int baud, char parity) {
+    if (!sp) return -1;
+
+    memset(sp, 0, sizeof(*sp));
+    sp->epfd = -1;
+    sp->tfd = -1;
+
+    sp->fd = serial_open(port, baud, parity);
+    if (sp->fd < 0) {
+        return -1;
+    }
+
+    sp->epfd = epoll_create1(EPOLL_CLOEXEC);
+    sp->tfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (sp->epfd < 0 || sp->tfd < 0) {
+        DBG_ERROR("Failed to create epoll/timer for %s: %s", port, strerror(errno));
+        serial_port_close(sp);
+        return -1;
+    }
+
+    struct epoll_event ev = { .events = EPOLLIN };
+    ev.data.fd = sp->fd;
+    if (epoll_ctl(sp->epfd, EPOLL_CTL_ADD, sp->fd, &ev) < 0) {
+        DBG_ERROR("Failed to watch %s: %s", port, strerror(errno));
+        serial_port_close(sp);
+        return -1;
+    }
+    ev.data.fd = sp->tfd;
+    if (epoll_ctl(sp->epfd, EPOLL_CTL_ADD, sp->tfd, &ev) < 0) {
+        DBG_ERROR("Failed to watch timer for %s: %s", port, strerror(errno));
+        serial_port_close(sp);
+        return -1;
+    }
+
+    sp->baud = baud;
+    sp->parity = parity;
+    sp->char_us = serial_char_time_us(baud, parity);
+    sp->t35_us = serial_t35_us(baud, parity);
+
+    DBG_INFO("Serial port %s: char %uus, t3.5 %uus", port, sp->char_us, sp->t35_us);
+    return sp->fd;
+}
+
+static uint64_t monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Arm the timerfd to fire once after us microseconds (0 disarms it)
+static void arm_timer(serial_port_t *sp, uint32_t us) {
+    struct itimerspec its = {0};
+    its.it_value.tv_sec = us / 1000000;
+    its.it_value.tv_nsec = (us % 1000000) * 1000;
+    timerfd_settime(sp->tfd, 0, &its, NULL);
+}
+
+// Length of an RTU response frame from its header, 0 while not yet known,
+// -1 for function codes whose length cannot be derived
+static int rtu_frame_length(const uint8_t *buf, int len) {
+    if (len < 2) {
+        return 0;
+    }
+
+    uint8_t function = buf[1];
+    if (function & 0x80) {
+        return 5;  // Exception: addr, func, code, crc
+    }
+
+    switch (function) {
+        case 1: case 2: case 3: case 4:
+            return len < 3 ? 0 : 5 + buf[2];  // addr, func, byte count, data, crc
+        case 5: case 6: case 15: case 16:
+            return 8;  // Echo of address/value or address/quantity
+        default:
+            return -1;
+    }
+}
+
+// Queue a request frame without waiting for the UART to drain. Input is only
+// discarded when the previous exchange left the line dirty, and the t3.5
+// silence before the frame is kept from the time the line went quiet.
+int serial_port_send(serial_port_t *sp, const uint8_t *buf, int len) {
+    if (!sp || sp->fd < 0 || !buf || len <= 0) {
+        DBG_ERROR("Invalid serial port");
+        return -1;
+    }
+
+    if (sp->rx_dirty) {
+        serial_port_discard(sp);
+    }
+
+    uint64_t now = monotonic_us();
+    if (now < sp->idle_us + sp->t35_us) {
+        uint64_t wait = sp->idle_us + sp->t35_us - now;
+        struct timespec ts = { .tv_sec = wait / 1000000, .tv_nsec = (wait % 1000000) * 1000 };
+        nanosleep(&ts, NULL);
+        now = monotonic_us();
+    }
+
+    int sent = 0;
+    while (sent < len) {
+        int r = write(sp->fd, buf + sent, len - sent);
+        if (r < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN) {
+                // Output queue full, wait until the UART can take more
+                struct pollfd pfd = { .fd = sp->fd, .events = POLLOUT };
+                poll(&pfd, 1, 1000);
+                continue;
+            }
+            DBG_ERROR("Write error: %s", strerror(errno));
+            return -1;
+        }
+        sent += r;
+    }
+
+    // The response window opens once the frame has left the wire
+    sp->tx_end_us = now + (uint64_t)len * sp->char_us;
+    return sent;
+}
+
+// Drop whatever is pending in the receive queue
+void serial_port_discard(serial_port_t *sp) {
+    if (!sp || sp->fd < 0) return;
+
+    if (tcflush(sp->fd, TCIFLUSH) < 0) {
+        DBG_ERROR("Failed to flush serial input");
+    }
+    sp->rx_dirty = false;
+}
+
+// Receive one RTU frame. Returns as soon as the length implied by the header
+// has arrived, otherwise after t3.5 of line silence. Returns the number of
+// bytes read, 0 on timeout and -1 on error.
+int serial_port_receive(serial_port_t *sp, uint8_t *buf, int bufsz, int timeout_ms) {
+    if (!sp || sp->fd < 0 || !buf || bufsz <= 0) {
+        DBG_ERROR("Invalid serial port");
+        return -1;
+    }
+
+    struct epoll_event events[2];
+    int len = 0;
+    int rc = 0;
+
+    // Wait up to timeout_ms for the first byte, counted from the end of the request
+    uint64_t now = monotonic_us();
+    sp->rx_first_us = 0;
+    uint32_t tx_left = sp->tx_end_us > now ? (uint32_t)(sp->tx_end_us - now) : 0;
+    arm_timer(sp, tx_left + (timeout_ms > 0 ? timeout_ms * 1000 : 1));
+
+    while (1) {
+        int n = epoll_wait(sp->epfd, events, 2, -1);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            DBG_ERROR("epoll_wait error: %s", strerror(errno));
+            rc = -1;
+            break;
+        }
+
+        bool expired = false;
+        bool readable = false;
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.fd == sp->tfd) {
+                uint64_t expirations;
+                if (read(sp->tfd, &expirations, sizeof(expirations)) > 0) {
+                    expired = true;
+                }
+            } else if (events[i].data.fd == sp->fd) {
+                readable = true;
+            }
+        }
+
+        if (readable) {
+            if (len == 0) {
+                sp->rx_first_us = monotonic_us();
+            }
+            while (len < bufsz) {
+                int r = read(sp->fd, buf + len, bufsz - len);
+                if (r <= 0) {
+                    break;
+                }
+                len += r;
+            }
+
+            int expected = rtu_frame_length(buf, len);
+            if ((expected > 0 && len >= expected) || len >= bufsz) {
+                rc = len;
+                break;
+            }
+
+            // Wait for the rest of a frame of known length, otherwise for t3.5 of silence.
+            // Gaps are not checked against t1.5: the UART FIFO and the tty layer
+            // hand bytes over in bursts, so gaps seen here say nothing about the
+            // wire. A frame cut short is caught by its length and CRC instead.
+            if (expected > 0) {
+                arm_timer(sp, (expected - len) * sp->char_us + sp->t35_us);
+            } else {
+                arm_timer(sp, sp->t35_us);
+            }
+            continue;
+        }
+
+        if (expired) {
+            // A timeout may be followed by a late reply, a cut frame by its tail
+            int expected = rtu_frame_length(buf, len);
+            if (len == 0 || (expected >= 0 && len < expected)) {
+                sp->rx_dirty = true;
+            }
+            rc = len;
+            break;
+        }
+    }
+
+    arm_timer(sp, 0);
+    sp->idle_us = monotonic_us();
+    return rc;
+}
+
+void serial_port_close(serial_port_t *sp) {
+    if (!sp) return;
+
+    if (sp->tfd >= 0) {
+        close(sp->tfd);
+        sp->tfd = -1;
+    }
+    if (sp->epfd >= 0) {
+        close(sp->epfd);
+        sp->epfd = -1;
+    }
+    serial_close(sp->fd);
+    sp->fd = -1;
+}
 
 // Close serial port
 void serial_close(int fd) {
@@ -2,12 +2,35 @@
 #define SERIAL_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
-int serial_open(const char *port, int baud);
+// Serial line with the epoll set and timer used for frame-accurate receive
+typedef struct {
+    int fd;
+    int epfd;           // epoll set watching fd and tfd
+    int tfd;            // timerfd for response timeout and inter-frame silence
+    int baud;
+    char parity;
+    uint32_t char_us;   // Time of one character on the wire
+    uint32_t t35_us;    // Minimum silence between frames
+    uint64_t tx_end_us; // When the last request leaves the wire
+    uint64_t idle_us;   // When the line last went quiet
+    uint64_t rx_first_us; // When the first byte of the last response arrived, 0 if none
+    bool rx_dirty;      // Stale input may be pending after a timeout or framing error
+} serial_port_t;
+
+int serial_open(const char *port, int baud, char parity);
 int serial_read(int fd, uint8_t *buf, int len, int timeout_ms);
 int serial_receive(int fd, uint8_t *buf, int bufsz, int timeout);
 int serial_write(int fd, const uint8_t *buf, int len);
 void serial_close(int fd);
 void serial_flush(int fd);
+uint32_t serial_char_time_us(int baud, char parity);
+uint32_t serial_t35_us(int baud, char parity);
+int serial_port_open(serial_port_t *sp, const char *port, int baud, char parity);
+int serial_port_send(serial_port_t *sp, const uint8_t *buf, int len);
+int serial_port_receive(serial_port_t *sp, uint8_t *buf, int bufsz, int timeout_ms);
+void serial_port_discard(serial_port_t *sp);
+void serial_port_close(serial_port_t *sp);
 
 #endif
@@ -0,0 +1,297 @@
+#include "tag_table.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DBG_TAG "TAG_TABLE"
+#define DBG_LVL LOG_INFO
+#include "dbg.h"
+
+typedef struct {
+    atomic_uint seq;        // Odd while a write is in progress
+    tag_value_t v;
+} tag_entry_t;
+
+typedef struct {
+    atomic_uint seq;
+    device_status_t v;
+} device_entry_t;
+
+// One generation of the table. A device config reload builds a new one
+// and swaps the pointer. Readers count themselves in s_readers around
+// their use, as with config_acquire(), and the replaced generation is
+// freed once the count has dropped to zero after the swap. The count and
+// the pointer are both accessed seq_cst: a reader whose count the writer
+// missed must load the new pointer.
+typedef struct {
+    tag_entry_t *entries;
+    size_t count;
+    device_entry_t *devices;
+    size_t device_count;
+} table_t;
+
+static _Atomic(table_t *) s_table;
+static table_t *s_next;         // Built by tag_table_init(), not yet published
+static atomic_int s_readers;
+
+// The table writers fill: the one being built during a (re)load, otherwise
+// the published one
+static table_t *write_table(void) {
+    return s_next ? s_next : atomic_load_explicit(&s_table, memory_order_relaxed);
+}
+
+uint64_t tag_clock_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static void begin_write(atomic_uint *seq) {
+    unsigned value = atomic_load_explicit(seq, memory_order_relaxed);
+    atomic_store_explicit(seq, value + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+static void end_write(atomic_uint *seq) {
+    unsigned value = atomic_load_explicit(seq, memory_order_relaxed);
+    atomic_store_explicit(seq, value + 1, memory_order_release);
+}
+
+// Copy size bytes of data guarded by seq, retrying while a write overlaps
+static void read_consistent(atomic_uint *seq, void *out, const void *data, size_t size) {
+    unsigned before, after = 0;
+    do {
+        before = atomic_load_explicit(seq, memory_order_acquire);
+        if (before & 1) {
+            continue;  // Writer in progress, it only takes a few stores
+        }
+        memcpy(out, data, size);
+        atomic_thread_fence(memory_order_acquire);
+        after = atomic_load_explicit(seq, memory_order_relaxed);
+    } while ((before & 1) || before != after);
+}
+
+static void free_table(table_t *table) {
+    if (!table) return;
+    free(table->entries);
+    free(table->devices);
+    free(table);
+}
+
+int tag_table_init(size_t node_count, size_t device_count) {
+    table_t *table = calloc(1, sizeof(table_t));
+    tag_entry_t *entries = calloc(node_count ? node_count : 1, sizeof(tag_entry_t));
+    device_entry_t *devices = calloc(device_count ? device_count : 1, sizeof(device_entry_t));
+    if (!table || !entries || !devices) {
+        DBG_ERROR("Failed to allocate tag table for %lu nodes", (unsigned long)node_count);
+        free(table);
+        free(entries);
+        free(devices);
+        return -1;
+    }
+    table->entries = entries;
+    table->count = node_count;
+    table->devices = devices;
+    table->device_count = device_count;
+
+    free_table(s_next);
+    s_next = table;
+    return 0;
+}
+
+void tag_table_publish(void) {
+    if (!s_next) return;
+
+    table_t *prev = atomic_exchange(&s_table, s_next);
+    s_next = NULL;
+
+    while (atomic_load(&s_readers) != 0) {
+        usleep(100);
+    }
+    free_table(prev);
+}
+
+void tag_table_acquire(void) {
+    atomic_fetch_add(&s_readers, 1);
+}
+
+void tag_table_release(void) {
+    atomic_fetch_sub(&s_readers, 1);
+}
+
+void tag_table_define(const device_t *device, const node_t *node) {
+    table_t *table = write_table();
+    if (!table || node->id >= table->count) return;
+
+    tag_value_t *v = &table->entries[node->id].v;
+    v->name = node->name;
+    v->device = device->name;
+    v->data_type = node->data_type;
+    v->stale_ms = device->polling_interval * NODE_STALE_PERIODS;
+}
+
+void tag_table_define_device(const device_t *device) {
+    table_t *table = write_table();
+    if (!table || device->id >= table->device_count) return;
+
+    table->devices[device->id].v.name = device->name;
+    table->devices[device->id].v.min_timeout = device->min_timeout;
+}
+
+void tag_table_update(const node_t *node) {
+    table_t *table = write_table();
+    if (!table || node->id >= table->count) return;
+
+    tag_entry_t *entry = &table->entries[node->id];
+    begin_write(&entry->seq);
+    if (node->stats.quality == NODE_QUALITY_GOOD) {
+        entry->v.value = node->value;
+    }
+    entry->v.stats = node->stats;
+    end_write(&entry->seq);
+}
+
+void tag_table_update_device(const device_t *device) {
+    table_t *table = write_table();
+    if (!table || device->id >= table->device_count) return;
+
+    device_entry_t *entry = &table->devices[device->id];
+    begin_write(&entry->seq);
+    entry->v.offline = device->offline;
+    entry->v.consecutive_timeouts = device->consecutive_timeouts;
+    entry->v.backoff_ms = device->backoff_ms;
+    entry->v.srtt_us = device->srtt_us;
+    entry->v.rttvar_us = device->rttvar_us;
+    entry->v.rto_ms = device->rto_ms;
+    entry->v.rtt_samples = device->rtt_samples;
+    end_write(&entry->seq);
+}
+
+size_t tag_table_count(void) {
+    table_t *table = atomic_load(&s_table);
+    return table ? table->count : 0;
+}
+
+bool tag_table_read(uint16_t id, tag_value_t *out) {
+    table_t *table = atomic_load(&s_table);
+    if (!table || id >= table->count) return false;
+
+    read_consistent(&table->entries[id].seq, out, &table->entries[id].v, sizeof(*out));
+    return true;
+}
+
+size_t tag_table_device_count(void) {
+    table_t *table = atomic_load(&s_table);
+    return table ? table->device_count : 0;
+}
+
+bool tag_table_read_device(uint16_t id, device_status_t *out) {
+    table_t *table = atomic_load(&s_table);
+    if (!table || id >= table->device_count) return false;
+
+    read_consistent(&table->devices[id].seq, out, &table->devices[id].v, sizeof(*out));
+    return true;
+}
+
+node_quality_t tag_quality(const tag_value_t *tag, uint64_t now_ms) {
+    if (tag->stats.quality == NODE_QUALITY_GOOD && tag->stale_ms &&
+        now_ms - tag->stats.last_good_ms > tag->stale_ms) {
+        return NODE_QUALITY_STALE;
+    }
+    return tag->stats.quality;
+}
+
+const char *node_quality_name(node_quality_t quality) {
+    switch (quality) {
+        case NODE_QUALITY_GOOD: return "good";
+        case NODE_QUALITY_STALE: return "stale";
+        case NODE_QUALITY_TIMEOUT: return "timeout";
+        case NODE_QUALITY_EXCEPTION: return "exception";
+        case NODE_QUALITY_ERROR: return "error";
+        default: return "none";
+    }
+}
+
+// Format a value as JSON, out must hold JSON_NUMBER_SIZE bytes.
+// Returns the length or -1 for an unknown type.
+int tag_value_format(data_type_t data_type, const node_value_t *value, char *out) {
+    switch (data_type) {
+        case DATA_TYPE_BOOLEAN:
+            return snprintf(out, JSON_NUMBER_SIZE, "%s", value->bool_val ? "true" : "false");
+        case DATA_TYPE_INT8:
+            return json_writer_format_int(out, value->int8_val);
+        case DATA_TYPE_UINT8:
+            return json_writer_format_uint(out, value->uint8_val);
+        case DATA_TYPE_INT16:
+            return json_writer_format_int(out, value->int16_val);
+        case DATA_TYPE_UINT16:
+            return json_writer_format_uint(out, value->uint16_val);
+        case DATA_TYPE_INT32_ABCD:
+        case DATA_TYPE_INT32_CDAB:
+            return json_writer_format_int(out, value->int32_val);
+        case DATA_TYPE_UINT32_ABCD:
+        case DATA_TYPE_UINT32_CDAB:
+            return json_writer_format_uint(out, value->uint32_val);
+        case DATA_TYPE_FLOAT_ABCD:
+        case DATA_TYPE_FLOAT_CDAB:
+            return json_writer_format_float(out, value->float_val);
+        case DATA_TYPE_DOUBLE:
+            return json_writer_format_double(out, value->double_val);
+        default:
+            return -1;
+    }
+}
+
+// Bytes a value of this type takes in a binary update frame
+int tag_value_width(data_type_t data_type) {
+    switch (data_type) {
+        case DATA_TYPE_BOOLEAN:
+        case DATA_TYPE_INT8:
+        case DATA_TYPE_UINT8:
+            return 1;
+        case DATA_TYPE_INT16:
+        case DATA_TYPE_UINT16:
+            return 2;
+        case DATA_TYPE_INT32_ABCD:
+        case DATA_TYPE_INT32_CDAB:
+        case DATA_TYPE_UINT32_ABCD:
+        case DATA_TYPE_UINT32_CDAB:
+        case DATA_TYPE_FLOAT_ABCD:
+        case DATA_TYPE_FLOAT_CDAB:
+            return 4;
+        case DATA_TYPE_DOUBLE:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+// Raw bits of a value, as stored in a binary update frame
+uint64_t tag_value_bits(data_type_t data_type, const node_value_t *value) {
+    uint32_t bits32;
+    uint64_t bits64;
+
+    switch (data_type) {
+        case DATA_TYPE_BOOLEAN: return value->bool_val ? 1 : 0;
+        case DATA_TYPE_INT8: return (uint8_t)value->int8_val;
+        case DATA_TYPE_UINT8: return value->uint8_val;
+        case DATA_TYPE_INT16: return (uint16_t)value->int16_val;
+        case DATA_TYPE_UINT16: return value->uint16_val;
+        case DATA_TYPE_INT32_ABCD:
+        case DATA_TYPE_INT32_CDAB: return (uint32_t)value->int32_val;
+        case DATA_TYPE_UINT32_ABCD:
+        case DATA_TYPE_UINT32_CDAB: return value->uint32_val;
+        case DATA_TYPE_FLOAT_ABCD:
+        case DATA_TYPE_FLOAT_CDAB:
+            memcpy(&bits32, &value->float_val, sizeof(bits32));
+            return bits32;
+        case DATA_TYPE_DOUBLE:
+            memcpy(&bits64, &value->double_val, sizeof(bits64));
+            return bits64;
+        default:
+            return 0;
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef TAG_TABLE_H
+#define TAG_TABLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "rtu_master.h"
+
+// Process-wide table of the current value of every configured node,
+// indexed by node id, and of the health of every device, indexed by
+// device id. Each entry is written by the poll thread that owns it and
+// read by anyone without blocking, through a seqlock. A device config
+// reload builds a new table while the poll threads are paused and
+// publishes it whole; readers see either the old or the new one, and the
+// old one is freed once no reader holds it.
+
+// Consistent copy of one entry
+typedef struct {
+    const char *name;
+    const char *device;
+    data_type_t data_type;
+    node_value_t value;     // Last good value, valid once stats.last_good_ms is set
+    poll_stats_t stats;
+    uint32_t stale_ms;      // A good value older than this is stale, 0 = never
+} tag_value_t;
+
+// Consistent copy of the health of one device
+typedef struct {
+    const char *name;
+    bool offline;
+    uint32_t consecutive_timeouts;
+    uint32_t backoff_ms;
+    uint32_t min_timeout;
+    uint32_t srtt_us;
+    uint32_t rttvar_us;
+    uint32_t rto_ms;
+    uint32_t rtt_samples;
+} device_status_t;
+
+// Build a table of this size, define every id and seed the values, then
+// publish it, with no poll thread running in between. Publishing waits
+// until no reader holds the replaced table and frees it; the names it
+// points to must stay valid until then, and may be freed once it returns.
+int tag_table_init(size_t node_count, size_t device_count);
+void tag_table_define(const device_t *device, const node_t *node);
+void tag_table_define_device(const device_t *device);
+void tag_table_publish(void);
+
+// Writers: only the poll thread owning the node or device, after every poll
+void tag_table_update(const node_t *node);
+void tag_table_update_device(const device_t *device);
+
+// Readers: any thread, never blocks. Calls and the names they return are
+// only valid between tag_table_acquire() and tag_table_release(), held
+// for a few microseconds to milliseconds, never across I/O: a reload
+// waits for it with the poll threads paused.
+void tag_table_acquire(void);
+void tag_table_release(void);
+size_t tag_table_count(void);
+bool tag_table_read(uint16_t id, tag_value_t *out);
+size_t tag_table_device_count(void);
+bool tag_table_read_device(uint16_t id, device_status_t *out);
+
+// Wall clock in milliseconds, the time base of stats.last_good_ms
+uint64_t tag_clock_ms(void);
+
+// Quality of the entry at now_ms, turning old good values stale
+node_quality_t tag_quality(const tag_value_t *tag, uint64_t now_ms);
+const char *node_quality_name(node_quality_t quality);
+
+// Value encoding shared by live updates and snapshots
+int tag_value_format(data_type_t data_type, const node_value_t *value, char *out);
+int tag_value_width(data_type_t data_type);
+uint64_t tag_value_bits(data_type_t data_type, const node_value_t *value);
+
+#endif // TAG_TABLE_H
@@ -0,0 +1,329 @@
+#include "json_writer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Two digits per step for integer formatting
+static const char s_digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Fractional digits tried by the fixed-point fast path
+#define FAST_MAX_DECIMALS 6
+static const double s_pow10[FAST_MAX_DECIMALS + 1] = { 1, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6 };
+
+// Largest magnitude handled by the fast path, integers stay exact below 2^53
+#define FAST_MAX_SCALED 9007199254740992.0
+
+static void put(json_writer_t *w, const char *s, size_t n) {
+    if (w->overflow) return;
+
+    // Keep one byte for the terminator
+    if (w->len + n >= w->size) {
+        w->overflow = true;
+        return;
+    }
+    memcpy(w->buf + w->len, s, n);
+    w->len += n;
+}
+
+static void put_char(json_writer_t *w, char ch) {
+    put(w, &ch, 1);
+}
+
+// Emit the separator owed by the previous sibling
+static void before_value(json_writer_t *w) {
+    if (w->after_key) {
+        w->after_key = false;
+        return;
+    }
+    if (w->depth > 0) {
+        uint32_t bit = 1u << (w->depth - 1);
+        if (w->has_items & bit) {
+            put_char(w, ',');
+        }
+        w->has_items |= bit;
+    }
+}
+
+static void begin(json_writer_t *w, char open) {
+    before_value(w);
+    if (w->depth >= JSON_WRITER_MAX_DEPTH) {
+        w->overflow = true;
+        return;
+    }
+    put_char(w, open);
+    w->depth++;
+    w->has_items &= ~(1u << (w->depth - 1));
+}
+
+static void end(json_writer_t *w, char close) {
+    if (w->depth == 0) {
+        w->overflow = true;
+        return;
+    }
+    put_char(w, close);
+    w->depth--;
+}
+
+static void put_escaped(json_writer_t *w, const char *s) {
+    const char *run = s;
+
+    put_char(w, '"');
+    for (; *s; s++) {
+        unsigned char ch = (unsigned char)*s;
+        if (ch >= 0x20 && ch != '"' && ch != '\\') {
+            continue;
+        }
+
+        // Copy the plain run, then the escape
+        put(w, run, s - run);
+        run = s + 1;
+        switch (ch) {
+            case '"': put(w, "\\\"", 2); break;
+            case '\\': put(w, "\\\\", 2); break;
+            case '\n': put(w, "\\n", 2); break;
+            case '\r': put(w, "\\r", 2); break;
+            case '\t': put(w, "\\t", 2); break;
+            default: {
+                char esc[7];
+                snprintf(esc, sizeof(esc), "\\u%04x", ch);
+                put(w, esc, 6);
+                break;
+            }
+        }
+    }
+    put(w, run, s - run);
+    put_char(w, '"');
+}
+
+void json_writer_init(json_writer_t *w, char *buf, size_t size) {
+    memset(w, 0, sizeof(*w));
+    w->buf = buf;
+    w->size = size;
+    if (!buf || size == 0) {
+        w->overflow = true;
+    }
+}
+
+void json_writer_begin_object(json_writer_t *w) {
+    begin(w, '{');
+}
+
+void json_writer_end_object(json_writer_t *w) {
+    end(w, '}');
+}
+
+void json_writer_begin_array(json_writer_t *w) {
+    begin(w, '[');
+}
+
+void json_writer_end_array(json_writer_t *w) {
+    end(w, ']');
+}
+
+void json_writer_key(json_writer_t *w, const char *key) {
+    before_value(w);
+    put_escaped(w, key ? key : "");
+    put_char(w, ':');
+    w->after_key = true;
+}
+
+void json_writer_string(json_writer_t *w, const char *value) {
+    if (!value) {
+        json_writer_null(w);
+        return;
+    }
+    before_value(w);
+    put_escaped(w, value);
+}
+
+void json_writer_int(json_writer_t *w, int64_t value) {
+    char num[JSON_NUMBER_SIZE];
+    before_value(w);
+    put(w, num, json_writer_format_int(num, value));
+}
+
+void json_writer_uint(json_writer_t *w, uint64_t value) {
+    char num[JSON_NUMBER_SIZE];
+    before_value(w);
+    put(w, num, json_writer_format_uint(num, value));
+}
+
+void json_writer_double(json_writer_t *w, double value) {
+    char num[JSON_NUMBER_SIZE];
+    before_value(w);
+    put(w, num, json_writer_format_double(num, value));
+}
+
+void json_writer_float(json_writer_t *w, float value) {
+    char num[JSON_NUMBER_SIZE];
+    before_value(w);
+    put(w, num, json_writer_format_float(num, value));
+}
+
+void json_writer_bool(json_writer_t *w, bool value) {
+    before_value(w);
+    if (value) {
+        put(w, "true", 4);
+    } else {
+        put(w, "false", 5);
+    }
+}
+
+void json_writer_null(json_writer_t *w) {
+    before_value(w);
+    put(w, "null", 4);
+}
+
+void json_writer_raw(json_writer_t *w, const char *value, size_t len) {
+    before_value(w);
+    put(w, value, len);
+}
+
+int json_writer_finish(json_writer_t *w) {
+    if (w->overflow) {
+        if (w->buf && w->size > 0) {
+            w->buf[0] = '\0';
+        }
+        return -1;
+    }
+    w->buf[w->len] = '\0';
+    return (int)w->len;
+}
+
+int json_writer_format_uint(char *out, uint64_t value) {
+    char tmp[24];
+    char *p = tmp + sizeof(tmp);
+
+    while (value >= 100) {
+        unsigned idx = (unsigned)(value % 100) * 2;
+        value /= 100;
+        *--p = s_digit_pairs[idx + 1];
+        *--p = s_digit_pairs[idx];
+    }
+    if (value >= 10) {
+        unsigned idx = (unsigned)value * 2;
+        *--p = s_digit_pairs[idx + 1];
+        *--p = s_digit_pairs[idx];
+    } else {
+        *--p = '0' + (char)value;
+    }
+
+    int len = tmp + sizeof(tmp) - p;
+    memcpy(out, p, len);
+    out[len] = '\0';
+    return len;
+}
+
+int json_writer_format_int(char *out, int64_t value) {
+    if (value < 0) {
+        out[0] = '-';
+        // Negate in unsigned arithmetic so INT64_MIN does not overflow
+        return 1 + json_writer_format_uint(out + 1, 0 - (uint64_t)value);
+    }
+    return json_writer_format_uint(out, (uint64_t)value);
+}
+
+// Write scaled / 10^decimals in fixed notation
+static int format_fixed(char *out, bool negative, uint64_t scaled, int decimals) {
+    char digits[24];
+    int len = json_writer_format_uint(digits, scaled);
+    int pos = 0;
+
+    if (negative) {
+        out[pos++] = '-';
+    }
+    if (decimals == 0) {
+        memcpy(out + pos, digits, len + 1);
+        return pos + len;
+    }
+    if (len <= decimals) {
+        // 0.0ddd
+        out[pos++] = '0';
+        out[pos++] = '.';
+        memset(out + pos, '0', decimals - len);
+        pos += decimals - len;
+        memcpy(out + pos, digits, len);
+        pos += len;
+    } else {
+        memcpy(out + pos, digits, len - decimals);
+        pos += len - decimals;
+        out[pos++] = '.';
+        memcpy(out + pos, digits + len - decimals, decimals);
+        pos += decimals;
+    }
+    out[pos] = '\0';
+    return pos;
+}
+
+// Fast path for the common sensor value with a few decimals: find the
+// fewest decimals d such that round(v * 10^d) / 10^d reads back as v.
+// The division is correctly rounded, so that equality is exactly what a
+// parser returns for the printed text. Returns 0 when it does not apply.
+static int format_short_fixed(char *out, double value, bool is_float) {
+    bool negative = value < 0;
+    double magnitude = negative ? -value : value;
+
+    for (int d = 0; d <= FAST_MAX_DECIMALS; d++) {
+        double scaled = magnitude * s_pow10[d];
+        if (scaled >= FAST_MAX_SCALED) {
+            return 0;
+        }
+        uint64_t rounded = (uint64_t)(scaled + 0.5);
+        double parsed = (double)rounded / s_pow10[d];
+        if (is_float ? (float)parsed == (float)magnitude : parsed == magnitude) {
+            if (rounded == 0) {
+                negative = false;
+            }
+            return format_fixed(out, negative, rounded, d);
+        }
+    }
+    return 0;
+}
+
+// General case: the smallest precision that survives a round trip
+static int format_general(char *out, double value, bool is_float) {
+    int first = is_float ? 6 : 15;
+    int last = is_float ? 9 : 17;
+    int len = 0;
+
+    for (int precision = first; precision <= last; precision++) {
+        len = snprintf(out, JSON_NUMBER_SIZE, "%.*g", precision, value);
+        double parsed = strtod(out, NULL);
+        if (is_float ? (float)parsed == (float)value : parsed == value) {
+            break;
+        }
+    }
+    return len;
+}
+
+static int format_real(char *out, double value, bool is_float) {
+    // NaN and infinity have no JSON representation
+    if (value != value || value - value != 0) {
+        memcpy(out, "null", 5);
+        return 4;
+    }
+
+    int len = format_short_fixed(out, value, is_float);
+    if (len > 0) {
+        return len;
+    }
+    return format_general(out, value, is_float);
+}
+
+int json_writer_format_double(char *out, double value) {
+    return format_real(out, value, false);
+}
+
+int json_writer_format_float(char *out, float value) {
+    return format_real(out, value, true);
+}
@@ -0,0 +1,56 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define JSON_WRITER_MAX_DEPTH 16
+
+// Longest number produced by json_writer_format_double(), terminator included
+#define JSON_NUMBER_SIZE 32
+
+// Streaming JSON writer into a caller provided buffer, never allocates.
+// Once the buffer is too small every call is ignored and
+// json_writer_finish() reports the overflow.
+typedef struct {
+    char *buf;
+    size_t size;
+    size_t len;
+    int depth;
+    uint32_t has_items;     // Bit per nesting level: a comma is needed before the next item
+    bool after_key;         // The next value belongs to the key just written
+    bool overflow;
+} json_writer_t;
+
+void json_writer_init(json_writer_t *w, char *buf, size_t size);
+
+void json_writer_begin_object(json_writer_t *w);
+void json_writer_end_object(json_writer_t *w);
+void json_writer_begin_array(json_writer_t *w);
+void json_writer_end_array(json_writer_t *w);
+
+void json_writer_key(json_writer_t *w, const char *key);
+void json_writer_string(json_writer_t *w, const char *value);
+void json_writer_int(json_writer_t *w, int64_t value);
+void json_writer_uint(json_writer_t *w, uint64_t value);
+void json_writer_double(json_writer_t *w, double value);
+void json_writer_float(json_writer_t *w, float value);
+void json_writer_bool(json_writer_t *w, bool value);
+void json_writer_null(json_writer_t *w);
+
+// Insert an already encoded JSON value
+void json_writer_raw(json_writer_t *w, const char *value, size_t len);
+
+// Terminate the output, returns its length or -1 if the buffer overflowed
+int json_writer_finish(json_writer_t *w);
+
+// Number formatting, out must hold JSON_NUMBER_SIZE bytes. Returns the length.
+// Doubles and floats use the shortest text that reads back as the same value;
+// NaN and infinity are written as null.
+int json_writer_format_int(char *out, int64_t value);
+int json_writer_format_uint(char *out, uint64_t value);
+int json_writer_format_double(char *out, double value);
+int json_writer_format_float(char *out, float value);
+
+#endif // JSON_WRITER_H
@@ -12,12 +12,21 @@
 #include <unistd.h>
 #include <linux/route.h>
 #include <resolv.h>
+#include <stdatomic.h>
 #include "db.h"
+#include "config.h"
 #include "../log/log_buffer.h"
 #include "../log/log_output.h"
+#include "../log/log_tag.h"
+#include "websocket.h"
+#include "ws_client.h"
+#include "json_writer.h"
+#include "rtu_master.h"
+#include "tag_table.h"
+#include "historian.h"
 
-#define DEFAULT_HTTP_PORT 8000
 #define DEFAULT_HTTP_URL "http://0.0.0.0"
+#define LOG_TAGS_MAX 64  // Distinct DBG_TAGs listed by /api/logtags/get
 
 #define DBG_TAG "WEB"
 #define DBG_LVL LOG_INFO
@@ -33,110 +42,57 @@ struct thread_data *get_thread_data(void) {
     return t_data;
 }
 
-static struct mg_connection *ws_conn = NULL;
+// Manager shared by the HTTP server and the websocket log server, and
+// the id of the HTTP listener as the wakeup target. 0 while not listening.
+static struct mg_mgr *s_mgr = NULL;
+static atomic_ulong s_listener_id;
 
-static const char *s_json_header =
-    "Content-Type: application/json\r\n"
-    "Cache-Control: no-cache\r\n";
-
-static char* generate_token(const char* username, const char* password) {
-    // Allocate buffer for combined string (username + password + null terminator)
-    size_t len = strlen(username) + strlen(password) + 1;
-    char* combined = (char*)calloc(1, len);
-    if (!combined) {
-        DBG_ERROR("Failed to allocate memory for token generation");
-        return NULL;
-    }
+// Websocket clients by protocol, read by the poll threads to skip
+// encoding updates nobody receives
+static atomic_int s_text_clients;
+static atomic_int s_binary_clients;
 
-    // Combine username and password
-    snprintf(combined, len, "%s%s", username, password);
+// Node schema announced to binary clients, replaced on config load
+static pthread_mutex_t s_schema_mutex = PTHREAD_MUTEX_INITIALIZER;
+static char *s_schema = NULL;
 
-    // Simple hash function
-    unsigned long hash = 5381;
-    int c;
-    char* str = combined;
-    while ((c = *str++)) {
-        hash = ((hash << 5) + hash) + c; // hash * 33 + c
-    }
-
-    // Convert hash to string token
-    char* token = (char*)calloc(1, 17); // 16 chars + null terminator
-    if (!token) {
-        free(combined);
-        DBG_ERROR("Failed to allocate memory for token");
-        return NULL;
-    }
-    snprintf(token, 17, "%016lx", hash);
-
-    free(combined);
-    return token;
-}
-
-static struct user* get_user_from_db(void) {
-    static struct user db_user;
-    static char username[64] = {0};
-    static char password[64] = {0};
-    static char token[64] = {0};
-    
-    // Read username and password from database
-    int username_len = db_read("username", username, sizeof(username));
-    int password_len = db_read("password", password, sizeof(password));
-    if (username_len <= 0 || password_len <= 0) {
-        DBG_ERROR("Failed to read user credentials from database");
-        return NULL;
-    }
-
-    // Generate access token if needed
-    int token_len = db_read("access_token", token, sizeof(token));
-    if (token_len <= 0) {
-        char* new_token = generate_token(username, password);
-        if (!new_token) {
-            DBG_ERROR("Failed to generate access token");
-            return NULL;
-        }
-        strncpy(token, new_token, sizeof(token)-1);
-        free(new_token);
-        
-        // Store token in database
-        if (db_write("access_token", token, strlen(token)+1) != 0) {
-            DBG_ERROR("Failed to store access token in database");
-            return NULL;
-        }
-    }
+// First byte of internal wakeup messages, JSON text never starts with these
+#define WS_WAKEUP_BINARY 0x00
+#define WS_WAKEUP_SCHEMA 0x01
+#define WS_WAKEUP_HISTORY 0x02      // To an HTTP connection, its history reply is ready
+#define WS_CHECK_INTERVAL_MS 1000   // Period of ws_client_check()
 
-    // Set up user struct with database values
-    db_user.name = username;
-    db_user.pass = password; 
-    db_user.access_token = token;
-
-    return &db_user;
-}
+static const char *s_json_header =
+    "Content-Type: application/json\r\n"
+    "Cache-Control: no-cache\r\n";
 
+// Check Basic credentials or the access token against the configured
+// user, from the config cache so requests never touch flash. The result
+// is only valid until the next call.
 static struct user *authenticate(struct mg_http_message *hm) {
-  // In production, make passwords strong and tokens randomly generated
-  // In this example, user list is kept in RAM. In production, it can
-  // be backed by file, database, or some other method.
-  static struct user users[] = {
-      {"admin", "admin", "admin_token"},
-      {"user1", "user1", "user1_token"},
-      {"user2", "user2", "user2_token"},
-      {NULL, NULL, NULL},
-  };
+  static char name[64], token[17];
+  static struct user result = {name, NULL, token};
   char user[64], pass[64];
-  struct user *u, *result = NULL;
+  bool ok = false;
   mg_http_creds(hm, user, sizeof(user), pass, sizeof(pass));
   MG_VERBOSE(("user [%s] pass [%s]", user, pass));
 
-  if (user[0] != '\0' && pass[0] != '\0') {
-    // Both user and password is set, search by user/password
-    for (u = users; result == NULL && u->name != NULL; u++)
-      if (strcmp(user, u->name) == 0 && strcmp(pass, u->pass) == 0) result = u;
-  } else if (user[0] == '\0') {
-    // Only password is set, search by token
-    for (u = users; result == NULL && u->name != NULL; u++)
-      if (strcmp(pass, u->access_token) == 0) result = u;
+  const config_t *cfg = config_acquire();
+  if (cfg && cfg->username[0] != '\0') {
+    if (user[0] != '\0' && pass[0] != '\0') {
+      // Both user and password is set, check user/password
+      ok = strcmp(user, cfg->username) == 0 && strcmp(pass, cfg->password) == 0;
+    } else if (user[0] == '\0') {
+      // Only password is set, check the token
+      ok = strcmp(pass, cfg->access_token) == 0;
+    }
+    if (ok) {
+      snprintf(name, sizeof(name), "%s", cfg->username);
+      snprintf(token, sizeof(token), "%s", cfg->access_token);
+    }
   }
-  return result;
+  config_release();
+  return ok ? &result : NULL;
 }
 
 static void handle_login(struct mg_connection *c, struct user *u) {
@@ -394,26 +350,7 @@ static bool restart_network(void) {
 
 
 static char* read_network_config(void) {
-    char *json_str = NULL;
-    size_t buf_size = 4096;  // Initial buffer size
-    
-    // Allocate initial buffer
-    json_str = calloc(1, buf_size);
-    if (!json_str) {
-        DBG_ERROR("Failed to allocate memory for network config");
-        return NULL;
-    }
-
-    // Read network config from database
-    int read_len = db_read("network_config", json_str, buf_size);
-    if (read_len <= 0) {
-        DBG_ERROR("Failed to read network config from database");
-        free(json_str);
-        return NULL;
-    }
-
-    DBG_INFO("Network config read from database successfully");
-    return json_str;
+    return config_dup(CONFIG_NETWORK);
 }
 
 static bool write_network_config(const char *json_str) {
@@ -566,40 +503,19 @@ static bool write_system_config(const char *json_str) {
     if (!json_str) {
         DBG_ERROR("Invalid JSON string");
         return false;
-    }   
+    }
 
-    // Write system config to database
-    int result = db_write("system_config", (void*)json_str, strlen(json_str) + 1);
-    if (result != 0) {
+    if (config_set(CONFIG_SYSTEM, json_str) != 0) {
         DBG_ERROR("Failed to write system config to database");
         return false;
-    }   
+    }
 
     DBG_INFO("System config written to database successfully");
     return true;
 }
 
 static char* read_system_config(void) {
-    char *json_str = NULL;
-    size_t buf_size = 4096;  // Initial buffer size
-    
-    // Allocate initial buffer
-    json_str = calloc(1, buf_size);
-    if (!json_str) {
-        DBG_ERROR("Failed to allocate memory for system config");
-        return NULL;
-    }
-
-    // Read system config from database
-    int read_len = db_read("system_config", json_str, buf_size);
-    if (read_len <= 0) {
-        DBG_ERROR("Failed to read system config from database");
-        free(json_str);
-        return NULL;
-    }
-
-    DBG_INFO("System config read from database successfully");
-    return json_str;
+    return config_dup(CONFIG_SYSTEM);
 }
 
 static bool write_device_config(const char *json_str) {
@@ -608,9 +524,7 @@ static bool write_device_config(const char *json_str) {
         return false;
     }
 
-    // Write device config to database
-    int result = db_write("device_config", (void*)json_str, strlen(json_str) + 1);
-    if (result != 0) {
+    if (config_set(CONFIG_DEVICE, json_str) != 0) {
         DBG_ERROR("Failed to write device config to database");
         return false;
     }
@@ -620,26 +534,7 @@ static bool write_device_config(const char *json_str) {
 }
 
 static char* read_device_config(void) {
-    char *json_str = NULL;
-    size_t buf_size = 16*4096;  // Initial buffer size
-    
-    // Allocate initial buffer
-    json_str = calloc(1, buf_size);
-    if (!json_str) {
-        DBG_ERROR("Failed to allocate memory for device config");
-        return NULL;
-    }
-
-    // Read device config from database
-    int read_len = db_read("device_config", json_str, buf_size);
-    if (read_len <= 0) {
-        DBG_ERROR("Failed to read device config from database");
-        free(json_str);
-        return NULL;
-    }
-
-    DBG_INFO("Device config read from database successfully");
-    return json_str;
+    return config_dup(CONFIG_DEVICE);
 }
 
 static bool write_card_config(const char *json_str) {
@@ -648,9 +543,7 @@ static bool write_card_config(const char *json_str) {
         return false;
     }
 
-    // Write card config to database
-    int result = db_write("card_config", (void*)json_str, strlen(json_str) + 1);
-    if (result != 0) {
+    if (config_set(CONFIG_CARD, json_str) != 0) {
         DBG_ERROR("Failed to write card config to database");
         return false;
     }
@@ -660,26 +553,7 @@ static bool write_card_config(const char *json_str) {
 }
 
 static char* read_card_config(void) {
-    char *json_str = NULL;
-    size_t buf_size = 8*4096;  // Initial buffer size
-    
-    // Allocate initial buffer
-    json_str = calloc(1, buf_size);
-    if (!json_str) {
-        DBG_ERROR("Failed to allocate memory for card config");
-        return NULL;
-    }
-
-    // Read card config from database
-    int read_len = db_read("card_config", json_str, buf_size);
-    if (read_len <= 0) {
-        DBG_ERROR("Failed to read card config from database");
-        free(json_str);
-        return NULL;
-    }
-
-    DBG_INFO("Card config read from database successfully");
-    return json_str;
+    return config_dup(CONFIG_CARD);
 }
 
 static void handle_devices_get(struct mg_connection *c) {
@@ -704,6 +578,59 @@ static void handle_system_get(struct mg_connection *c) {
     }
 }
 
+// Runtime counters of the gateway services
+static void handle_status_get(struct mg_connection *c) {
+    cJSON *root = cJSON_CreateObject();
+    if (!root) {
+        mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to allocate memory\"}");
+        return;
+    }
+
+    log_output_stats_t log_stats;
+    log_output_get_stats(&log_stats);
+
+    cJSON *log = cJSON_AddObjectToObject(root, "log");
+    cJSON_AddNumberToObject(log, "flushes", log_stats.flushes);
+    cJSON_AddNumberToObject(log, "entries", log_stats.entries);
+    cJSON_AddNumberToObject(log, "avgBatch", log_stats.flushes ? (double)log_stats.entries / log_stats.flushes : 0);
+    cJSON_AddNumberToObject(log, "maxBatch", log_stats.max_batch);
+    cJSON_AddNumberToObject(log, "dropped", log_stats.dropped);
+    cJSON_AddNumberToObject(log, "pending", log_stats.pending);
+
+    ws_client_stats_t ws_stats;
+    ws_client_get_stats(c->mgr, &ws_stats);
+
+    cJSON *ws = cJSON_AddObjectToObject(root, "ws");
+    cJSON_AddNumberToObject(ws, "clients", ws_stats.clients);
+    cJSON_AddNumberToObject(ws, "behind", ws_stats.behind);
+    cJSON_AddNumberToObject(ws, "queuedBytes", ws_stats.queued_bytes);
+    cJSON_AddNumberToObject(ws, "dropped", ws_stats.dropped);
+    cJSON_AddNumberToObject(ws, "droppedBytes", ws_stats.dropped_bytes);
+    cJSON_AddNumberToObject(ws, "evicted", ws_stats.evicted);
+    cJSON_AddNumberToObject(ws, "recovered", ws_stats.recovered);
+
+    history_stats_t history_stats;
+    historian_get_stats(&history_stats);
+
+    cJSON *history = cJSON_AddObjectToObject(root, "history");
+    cJSON_AddNumberToObject(history, "samples", history_stats.samples);
+    cJSON_AddNumberToObject(history, "logs", history_stats.logs);
+    cJSON_AddNumberToObject(history, "bytes", history_stats.bytes);
+    cJSON_AddNumberToObject(history, "ratio", history_stats.bytes ? (double)history_stats.raw_bytes / history_stats.bytes : 0);
+    cJSON_AddNumberToObject(history, "bytesPerHour", history_stats.uptime_ms ? (double)history_stats.bytes * 3600000 / history_stats.uptime_ms : 0);
+    cJSON_AddNumberToObject(history, "failed", history_stats.failed);
+    cJSON_AddNumberToObject(history, "dropped", history_stats.dropped);
+
+    char *json_str = cJSON_PrintUnformatted(root);
+    if (json_str) {
+        mg_http_reply(c, 200, s_json_header, "%s", json_str);
+        free(json_str);
+    } else {
+        mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to create JSON\"}");
+    }
+    cJSON_Delete(root);
+}
+
 static void handle_network_get(struct mg_connection *c) {
     char *json_str = read_network_config();
     if (!json_str) {
@@ -748,7 +675,7 @@ static void handle_network_set(struct mg_connection *c, struct mg_http_message *
     memcpy(json_str, hm->body.buf, hm->body.len);
     json_str[hm->body.len] = '\0';
 
-    int result = db_write("network_config", (void*)json_str, strlen(json_str) + 1);
+    int result = config_set(CONFIG_NETWORK, json_str);
     if (result != 0) {
         DBG_ERROR("Failed to write network config to database");
         mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to write network config to database\"}");
@@ -769,6 +696,10 @@ static void handle_system_set(struct mg_connection *c, struct mg_http_message *h
     json_str[hm->body.len] = '\0';
 
     bool success = write_system_config(json_str);
+    if (success) {
+        // Log levels take effect immediately, no reboot needed
+        apply_log_levels_json(json_str);
+    }
     free(json_str);
     
     if (success) {
@@ -787,10 +718,24 @@ static void handle_devices_set(struct mg_connection *c, struct mg_http_message *
     memcpy(json_str, hm->body.buf, hm->body.len);
     json_str[hm->body.len] = '\0';
 
+    // A configuration that does not compile is never stored: the reload
+    // would keep the running one, but the next start would have none
+    const char *error = NULL;
+    device_config_t *config = compile_device_config(json_str, &error);
+    if (!config) {
+        DBG_ERROR("Rejected device config: %s", error);
+        mg_http_reply(c, 400, s_json_header, "{\"error\":\"Invalid device configuration: %s\"}", error);
+        free(json_str);
+        return;
+    }
+    free_device_config(config);
+
     bool success = write_device_config(json_str);
     free(json_str);
     
     if (success) {
+        // Poll threads pick it up between two scans, no restart needed
+        rtu_master_reload();
         mg_http_reply(c, 200, s_json_header, "{\"status\":\"success\"}");
     } else {
         mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to apply device configuration\"}");
@@ -839,6 +784,8 @@ static void handle_reboot_set(struct mg_connection *c, struct mg_http_message *h
 static void handle_factory_reset_set(struct mg_connection *c, struct mg_http_message *hm) {
     DBG_INFO("Factory reset");
     db_clear();
+    config_reload();
+    rtu_master_reload();
     mg_http_reply(c, 200, s_json_header, "{\"status\":\"success\"}");
 }
 
@@ -848,52 +795,779 @@ static bool get_http_config(char *url, size_t url_size, int *port) {
         return false;
     }
 
-    // Read system config from database
-    char *json_str = read_system_config();
-    if (!json_str) {
-        DBG_ERROR("Failed to read system config");
-        return false;
+    // Always use default HTTP URL
+    strncpy(url, DEFAULT_HTTP_URL, url_size - 1);
+    url[url_size - 1] = '\0';
+
+    const config_t *cfg = config_acquire();
+    *port = cfg ? cfg->http_port : CONFIG_DEFAULT_HTTP_PORT;
+    config_release();
+
+    DBG_INFO("HTTP config: URL=%s, Port=%d", url, *port);
+    return true;
+}
+
+// Queue a message for the web thread, false if the server is not up
+static bool web_wakeup(const void *data, size_t len) {
+    unsigned long id = atomic_load(&s_listener_id);
+    return id && mg_wakeup(s_mgr, id, data, len);
+}
+
+// Function to send message to all connected websocket clients
+void send_websocket_message(const char *message) {
+    if (!message) return;
+    
+    web_wakeup(message, strlen(message));
+}
+
+// Send a binary update frame to the clients using WS_BINARY_PROTOCOL
+void send_websocket_binary(const void *data, size_t len) {
+    uint8_t msg[WS_BINARY_FRAME_MAX + 1];
+
+    if (!data || len == 0 || len > WS_BINARY_FRAME_MAX) return;
+
+    msg[0] = WS_WAKEUP_BINARY;
+    memcpy(msg + 1, data, len);
+    web_wakeup(msg, len + 1);
+}
+
+int websocket_client_count(bool binary) {
+    return atomic_load_explicit(binary ? &s_binary_clients : &s_text_clients,
+                                memory_order_relaxed);
+}
+
+// Replace the node schema and announce it to connected binary clients
+void websocket_set_schema(const char *schema) {
+    char *copy = schema ? strdup(schema) : NULL;
+
+    pthread_mutex_lock(&s_schema_mutex);
+    free(s_schema);
+    s_schema = copy;
+    pthread_mutex_unlock(&s_schema_mutex);
+
+    uint8_t msg = WS_WAKEUP_SCHEMA;
+    web_wakeup(&msg, 1);
+}
+
+// Counted against the send queue like a snapshot: a client too far behind
+// for it is marked behind and gets it again once it caught up
+static void send_schema(struct mg_connection *c) {
+    pthread_mutex_lock(&s_schema_mutex);
+    if (s_schema) {
+        ws_client_send_resync(c, s_schema, strlen(s_schema), WEBSOCKET_OP_TEXT);
     }
+    pthread_mutex_unlock(&s_schema_mutex);
+}
 
-    // Parse JSON configuration
-    cJSON *root = cJSON_Parse(json_str);
-    if (!root) {
-        DBG_ERROR("Failed to parse system config JSON");
+// Run fill(w, arg) on a buffer of about estimate bytes, growing it if the
+// output does not fit. Returns a malloc'ed string or NULL.
+static char *build_json(size_t estimate, void (*fill)(json_writer_t *w, void *arg), void *arg, size_t *len) {
+    size_t size = estimate;
+
+    for (int attempt = 0; attempt < 4; attempt++, size *= 2) {
+        char *buf = malloc(size);
+        if (!buf) {
+            return NULL;
+        }
+
+        json_writer_t w;
+        json_writer_init(&w, buf, size);
+        fill(&w, arg);
+
+        int n = json_writer_finish(&w);
+        if (n >= 0) {
+            *len = n;
+            return buf;
+        }
+        free(buf);
+    }
+    return NULL;
+}
+
+// Current value of every node read so far, from the tag table:
+// {"type":"snapshot","vs":[{"n":"node0101","v":23.5,"t":1700000000000,"q":"good"},...]}
+static void fill_values_json(json_writer_t *w, void *arg) {
+    size_t count = tag_table_count();
+    uint64_t now_ms = tag_clock_ms();
+
+    json_writer_begin_object(w);
+    json_writer_key(w, "type");
+    json_writer_string(w, "snapshot");
+    json_writer_key(w, "vs");
+    json_writer_begin_array(w);
+    for (size_t id = 0; id < count; id++) {
+        tag_value_t tag;
+        char value[JSON_NUMBER_SIZE];
+        if (!tag_table_read(id, &tag) || tag.stats.last_good_ms == 0) {
+            continue;
+        }
+        int value_len = tag_value_format(tag.data_type, &tag.value, value);
+        if (value_len < 0) {
+            continue;
+        }
+        json_writer_begin_object(w);
+        json_writer_key(w, "n");
+        json_writer_string(w, tag.name);
+        json_writer_key(w, "v");
+        json_writer_raw(w, value, value_len);
+        json_writer_key(w, "t");
+        json_writer_uint(w, tag.stats.last_good_ms);
+        json_writer_key(w, "q");
+        json_writer_string(w, node_quality_name(tag_quality(&tag, now_ms)));
+        json_writer_end_object(w);
+    }
+    json_writer_end_array(w);
+    json_writer_end_object(w);
+}
+
+static char *build_values_json(size_t *len) {
+    tag_table_acquire();
+    char *json = build_json(128 + tag_table_count() * 96, fill_values_json, NULL, len);
+    tag_table_release();
+    return json;
+}
+
+// The same snapshot as one binary values frame, see rtu_master.h
+static uint8_t *build_values_frame(size_t *len) {
+    tag_table_acquire();
+    size_t count = tag_table_count();
+    uint8_t *frame = malloc(UPDATE_FRAME_HEADER + count * 10);
+    size_t pos = UPDATE_FRAME_HEADER;
+    uint16_t values = 0;
+
+    if (!frame) {
+        tag_table_release();
+        return NULL;
+    }
+
+    for (size_t id = 0; id < count; id++) {
+        tag_value_t tag;
+        if (!tag_table_read(id, &tag) || tag.stats.last_good_ms == 0) {
+            continue;
+        }
+        int width = tag_value_width(tag.data_type);
+        if (width == 0) {
+            continue;
+        }
+        uint64_t bits = tag_value_bits(tag.data_type, &tag.value);
+        frame[pos++] = (uint8_t)id;
+        frame[pos++] = (uint8_t)(id >> 8);
+        for (int i = 0; i < width; i++) {
+            frame[pos++] = (uint8_t)(bits >> (8 * i));
+        }
+        values++;
+    }
+    tag_table_release();
+
+    frame[0] = UPDATE_FRAME_VALUES;
+    frame[1] = (uint8_t)values;
+    frame[2] = (uint8_t)(values >> 8);
+    *len = pos;
+    return frame;
+}
+
+// Bring a websocket client up to date with the current value of every node,
+// counted against its send queue like any other message
+static void send_snapshot(struct mg_connection *c) {
+    size_t len = 0;
+
+    if (c->send.len > WS_SEND_LOW_WATERMARK) {
+        // Not worth building, ws_client_send_resync() would drop it
+        ws_client_send_resync(c, NULL, 0, WEBSOCKET_OP_TEXT);
+        return;
+    }
+
+    if (c->data[0] == 'B') {
+        uint8_t *frame = build_values_frame(&len);
+        if (frame) {
+            ws_client_send_resync(c, frame, len, WEBSOCKET_OP_BINARY);
+            free(frame);
+        }
+    } else {
+        char *json = build_values_json(&len);
+        if (json) {
+            ws_client_send_resync(c, json, len, WEBSOCKET_OP_TEXT);
+            free(json);
+        }
+    }
+}
+
+// A client that caught up after messages were dropped: replace them, the
+// schema first since the dropped ones may have included a new one
+static void resync_client(struct mg_connection *c) {
+    if (c->data[0] == 'B') {
+        send_schema(c);
+    }
+    if (c->data[0] == 'W' || c->data[0] == 'B') {
+        send_snapshot(c);
+    }
+}
+
+// Clients behind on a quiet bus get no message to settle them on
+static void ws_check_timer(void *arg) {
+    ws_client_check((struct mg_mgr *)arg, resync_client);
+}
+
+static void handle_values_get(struct mg_connection *c) {
+    size_t len = 0;
+    char *json_str = build_values_json(&len);
+
+    if (json_str) {
+        mg_http_reply(c, 200, s_json_header, "%s", json_str);
         free(json_str);
-        return false;
+    } else {
+        mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to create JSON\"}");
     }
+}
 
-    // Get HTTP port from config
-    cJSON *http_port = cJSON_GetObjectItem(root, "hport");
+// Poll statistics of every node, response times in microseconds:
+// {"nodes":[{"d":"dev1","n":"node0101","q":"timeout","lg":1700000000000,"cf":3,
+//   "ok":120,"to":3,"ex":0,"er":0,"xc":0,"rtMin":4100,"rtAvg":5230,"rtMax":9800},...]}
+static void fill_stats_json(json_writer_t *w, void *arg) {
+    size_t count = tag_table_count();
+    uint64_t now_ms = tag_clock_ms();
+
+    json_writer_begin_object(w);
+    json_writer_key(w, "nodes");
+    json_writer_begin_array(w);
+    for (size_t id = 0; id < count; id++) {
+        tag_value_t tag;
+        if (!tag_table_read(id, &tag)) {
+            continue;
+        }
+        const poll_stats_t *st = &tag.stats;
+        json_writer_begin_object(w);
+        json_writer_key(w, "d");
+        json_writer_string(w, tag.device);
+        json_writer_key(w, "n");
+        json_writer_string(w, tag.name);
+        json_writer_key(w, "q");
+        json_writer_string(w, node_quality_name(tag_quality(&tag, now_ms)));
+        json_writer_key(w, "lg");
+        json_writer_uint(w, st->last_good_ms);
+        json_writer_key(w, "cf");
+        json_writer_uint(w, st->consecutive_failures);
+        json_writer_key(w, "ok");
+        json_writer_uint(w, st->good);
+        json_writer_key(w, "to");
+        json_writer_uint(w, st->timeouts);
+        json_writer_key(w, "ex");
+        json_writer_uint(w, st->exceptions);
+        json_writer_key(w, "er");
+        json_writer_uint(w, st->errors);
+        json_writer_key(w, "xc");
+        json_writer_uint(w, st->last_exception);
+        json_writer_key(w, "rtMin");
+        json_writer_uint(w, st->rt_min_us);
+        json_writer_key(w, "rtAvg");
+        json_writer_uint(w, st->responses ? st->rt_total_us / st->responses : 0);
+        json_writer_key(w, "rtMax");
+        json_writer_uint(w, st->rt_max_us);
+        json_writer_end_object(w);
+    }
+    json_writer_end_array(w);
+    json_writer_end_object(w);
+}
 
-    // Always use default HTTP URL
-    strncpy(url, DEFAULT_HTTP_URL, url_size - 1);
-    url[url_size - 1] = '\0';
+static void handle_stats_get(struct mg_connection *c) {
+    size_t len = 0;
+    tag_table_acquire();
+    char *json_str = build_json(128 + tag_table_count() * 256, fill_stats_json, NULL, &len);
+    tag_table_release();
 
-    if (http_port && http_port->type == cJSON_Number) {
-        *port = http_port->valueint;
+    if (json_str) {
+        mg_http_reply(c, 200, s_json_header, "%s", json_str);
+        free(json_str);
     } else {
-        *port = DEFAULT_HTTP_PORT;
+        mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to create JSON\"}");
     }
+}
 
-    cJSON_Delete(root);
-    free(json_str);
+// Every DBG_TAG compiled in, for the per-tag log level settings:
+// {"tags":["ARENA","CONFIG",...]}
+static void fill_log_tags_json(json_writer_t *w, void *arg) {
+    const char *names[LOG_TAGS_MAX];
+    int count = log_tag_names(names, LOG_TAGS_MAX);
+    (void)arg;
+
+    json_writer_begin_object(w);
+    json_writer_key(w, "tags");
+    json_writer_begin_array(w);
+    for (int i = 0; i < count; i++) {
+        json_writer_string(w, names[i]);
+    }
+    json_writer_end_array(w);
+    json_writer_end_object(w);
+}
 
-    DBG_INFO("HTTP config: URL=%s, Port=%d", url, *port);
-    return true;
+static void handle_log_tags_get(struct mg_connection *c) {
+    size_t len = 0;
+    char *json_str = build_json(LOG_TAGS_MAX * 24, fill_log_tags_json, NULL, &len);
+
+    if (json_str) {
+        mg_http_reply(c, 200, s_json_header, "%s", json_str);
+        free(json_str);
+    } else {
+        mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to create JSON\"}");
+    }
 }
 
-// Function to send message to all connected websocket clients
-void send_websocket_message(const char *message) {
-    if (!message || !ws_conn) return;
-    
-    mg_wakeup(ws_conn->mgr, ws_conn->id, message, strlen(message));
+// Health and learned response timing of every device, times in
+// microseconds except rto, the receive timeout in use, in milliseconds:
+// {"devices":[{"n":"dev1","offline":false,"ct":0,"backoff":0,"srtt":5200,
+//   "rttvar":800,"rto":9,"rtoMin":20,"samples":312},...]}
+static void fill_device_status_json(json_writer_t *w, void *arg) {
+    size_t count = tag_table_device_count();
+
+    json_writer_begin_object(w);
+    json_writer_key(w, "devices");
+    json_writer_begin_array(w);
+    for (size_t id = 0; id < count; id++) {
+        device_status_t st;
+        if (!tag_table_read_device(id, &st)) {
+            continue;
+        }
+        json_writer_begin_object(w);
+        json_writer_key(w, "n");
+        json_writer_string(w, st.name);
+        json_writer_key(w, "offline");
+        json_writer_bool(w, st.offline);
+        json_writer_key(w, "ct");
+        json_writer_uint(w, st.consecutive_timeouts);
+        json_writer_key(w, "backoff");
+        json_writer_uint(w, st.offline ? st.backoff_ms : 0);
+        json_writer_key(w, "srtt");
+        json_writer_uint(w, st.srtt_us);
+        json_writer_key(w, "rttvar");
+        json_writer_uint(w, st.rttvar_us);
+        json_writer_key(w, "rto");
+        json_writer_uint(w, st.rto_ms);
+        json_writer_key(w, "rtoMin");
+        json_writer_uint(w, st.min_timeout);
+        json_writer_key(w, "samples");
+        json_writer_uint(w, st.rtt_samples);
+        json_writer_end_object(w);
+    }
+    json_writer_end_array(w);
+    json_writer_end_object(w);
+}
+
+static void handle_device_status_get(struct mg_connection *c) {
+    size_t len = 0;
+    tag_table_acquire();
+    char *json_str = build_json(64 + tag_table_device_count() * 192, fill_device_status_json, NULL, &len);
+    tag_table_release();
+
+    if (json_str) {
+        mg_http_reply(c, 200, s_json_header, "%s", json_str);
+        free(json_str);
+    } else {
+        mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to create JSON\"}");
+    }
+}
+
+// Node given by id or by name, false if there is no such node. Caller
+// holds tag_table_acquire() while it uses tag.
+static bool find_node(const char *key, uint16_t *id, tag_value_t *tag) {
+    size_t count = tag_table_count();
+    char *end;
+    unsigned long n = strtoul(key, &end, 10);
+
+    if (*key && *end == '\0') {
+        *id = (uint16_t)n;
+        return n < count && tag_table_read(*id, tag);
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (tag_table_read(i, tag) && strcmp(tag->name, key) == 0) {
+            *id = (uint16_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+typedef struct {
+    uint16_t id;
+    const char *name;
+    uint64_t from_ms;
+    uint64_t to_ms;
+    uint64_t bucket_ms;
+    const history_bucket_t *buckets;
+    int bucket_count;
+    bool truncated;
+} history_reply_t;
+
+// Downsampled history of one node, buckets without samples left out:
+// {"node":0,"n":"node0101","from":1700000000000,"to":1700003600000,"bucket":12001,
+//  "pts":[{"t":1700000000000,"c":12,"min":21.5,"avg":21.8,"max":22.1,"q":"good"},...]}
+// min, avg and max cover the good samples and are absent when there are none,
+// q is the quality of the last sample of the bucket. "partial":true follows
+// "bucket" when the historian left out the oldest part of the range.
+static void fill_history_json(json_writer_t *w, void *arg) {
+    const history_reply_t *r = (const history_reply_t *)arg;
+
+    json_writer_begin_object(w);
+    json_writer_key(w, "node");
+    json_writer_uint(w, r->id);
+    json_writer_key(w, "n");
+    json_writer_string(w, r->name);
+    json_writer_key(w, "from");
+    json_writer_uint(w, r->from_ms);
+    json_writer_key(w, "to");
+    json_writer_uint(w, r->to_ms);
+    json_writer_key(w, "bucket");
+    json_writer_uint(w, r->bucket_ms);
+    if (r->truncated) {
+        json_writer_key(w, "partial");
+        json_writer_bool(w, true);
+    }
+    json_writer_key(w, "pts");
+    json_writer_begin_array(w);
+    for (int i = 0; i < r->bucket_count; i++) {
+        const history_bucket_t *b = &r->buckets[i];
+        if (b->samples == 0) {
+            continue;
+        }
+        json_writer_begin_object(w);
+        json_writer_key(w, "t");
+        json_writer_uint(w, b->start_ms);
+        json_writer_key(w, "c");
+        json_writer_uint(w, b->good);
+        if (b->good > 0) {
+            json_writer_key(w, "min");
+            json_writer_double(w, b->min);
+            json_writer_key(w, "avg");
+            json_writer_double(w, b->sum / b->good);
+            json_writer_key(w, "max");
+            json_writer_double(w, b->max);
+        }
+        json_writer_key(w, "q");
+        json_writer_string(w, node_quality_name((node_quality_t)b->quality));
+        json_writer_end_object(w);
+    }
+    json_writer_end_array(w);
+    json_writer_end_object(w);
+}
+
+// History queries read flash, up to HISTORY_QUERY_MAX_LOGS logs, so they
+// run one at a time on the history thread instead of the event loop. The
+// finished reply is handed back to the connection with mg_wakeup(); a
+// connection that closes first leaves its job for the thread to free.
+#define HISTORY_JOBS_MAX 8          // Queued or running queries, more get 503
+
+typedef enum {
+    HISTORY_JOB_QUEUED,
+    HISTORY_JOB_RUNNING,
+    HISTORY_JOB_DONE,
+} history_job_state_t;
+
+typedef struct history_job {
+    struct history_job *next;
+    unsigned long conn_id;          // 0 once the connection closed
+    history_job_state_t state;
+    uint32_t key;
+    history_reply_t r;
+    int status;                     // HTTP status of the reply
+    char *reply;                    // JSON body
+} history_job_t;
+
+static pthread_mutex_t s_history_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_history_cond = PTHREAD_COND_INITIALIZER;
+static history_job_t *s_history_jobs;   // In arrival order
+static int s_history_job_count;
+
+static void free_history_job(history_job_t *job) {
+    free((char *)job->r.name);
+    free(job->reply);
+    free(job);
+}
+
+// Unlink a job, caller holds s_history_lock
+static void remove_history_job(history_job_t *job) {
+    for (history_job_t **p = &s_history_jobs; *p; p = &(*p)->next) {
+        if (*p == job) {
+            *p = job->next;
+            s_history_job_count--;
+            return;
+        }
+    }
+}
+
+static void run_history_job(history_job_t *job) {
+    history_reply_t *r = &job->r;
+    history_bucket_t *b = malloc(sizeof(history_bucket_t) * r->bucket_count);
+
+    if (!b) {
+        job->status = 500;
+        job->reply = strdup("{\"error\":\"Failed to allocate memory\"}");
+        return;
+    }
+    r->buckets = b;
+    r->bucket_ms = historian_query(job->key, r->from_ms, r->to_ms, b, r->bucket_count, &r->truncated);
+    if (r->bucket_ms == 0) {
+        job->status = 503;
+        job->reply = strdup("{\"error\":\"History not available\"}");
+    } else {
+        size_t len = 0;
+        job->reply = build_json(256 + r->bucket_count * 192, fill_history_json, r, &len);
+        job->status = job->reply ? 200 : 500;
+        if (!job->reply) {
+            job->reply = strdup("{\"error\":\"Failed to create JSON\"}");
+        }
+    }
+    r->buckets = NULL;
+    free(b);
+}
+
+static void *history_thread(void *arg) {
+    (void)arg;
+
+    while (1) {
+        history_job_t *job;
+
+        pthread_mutex_lock(&s_history_lock);
+        while (1) {
+            for (job = s_history_jobs; job && job->state != HISTORY_JOB_QUEUED; job = job->next) {
+            }
+            if (job) {
+                break;
+            }
+            pthread_cond_wait(&s_history_cond, &s_history_lock);
+        }
+        job->state = HISTORY_JOB_RUNNING;
+        pthread_mutex_unlock(&s_history_lock);
+
+        run_history_job(job);
+
+        pthread_mutex_lock(&s_history_lock);
+        unsigned long conn_id = job->conn_id;
+        job->state = HISTORY_JOB_DONE;
+        if (conn_id == 0) {
+            remove_history_job(job);
+            free_history_job(job);
+        }
+        pthread_mutex_unlock(&s_history_lock);
+
+        if (conn_id != 0) {
+            uint8_t msg = WS_WAKEUP_HISTORY;
+            mg_wakeup(s_mgr, conn_id, &msg, 1);
+        }
+    }
+    return NULL;
+}
+
+// The history reply of this connection is ready: send it
+static void handle_history_done(struct mg_connection *c) {
+    history_job_t *job;
+
+    pthread_mutex_lock(&s_history_lock);
+    for (job = s_history_jobs; job && job->conn_id != c->id; job = job->next) {
+    }
+    if (job && job->state == HISTORY_JOB_DONE) {
+        remove_history_job(job);
+    } else {
+        job = NULL;
+    }
+    pthread_mutex_unlock(&s_history_lock);
+
+    c->data[0] = '\0';
+    if (job) {
+        mg_http_reply(c, job->status, s_json_header, "%s", job->reply ? job->reply : "{}");
+        free_history_job(job);
+    }
+}
+
+// The connection closed: its job is freed now, or by the history thread
+// once the query is done
+static void cancel_history_job(struct mg_connection *c) {
+    pthread_mutex_lock(&s_history_lock);
+    for (history_job_t *job = s_history_jobs; job; job = job->next) {
+        if (job->conn_id == c->id) {
+            if (job->state == HISTORY_JOB_RUNNING) {
+                job->conn_id = 0;
+            } else {
+                remove_history_job(job);
+                free_history_job(job);
+            }
+            break;
+        }
+    }
+    pthread_mutex_unlock(&s_history_lock);
+}
+
+static void start_history_thread(void) {
+    pthread_t thread;
+    pthread_attr_t attr;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    int ret = pthread_create(&thread, &attr, history_thread, NULL);
+    if (ret != 0) {
+        DBG_ERROR("Failed to create history thread: %s", strerror(ret));
+    }
+    pthread_attr_destroy(&attr);
+}
+
+// /api/history/get?node=<id or name>&from=<ms>&to=<ms>&buckets=<count>
+// from and to are wall clock milliseconds, by default the last hour.
+// Answered from the history thread, see handle_history_done().
+static void handle_history_get(struct mg_connection *c, struct mg_http_message *hm) {
+    char node[64], from[24], to[24], buckets[8];
+    tag_value_t tag;
+
+    if (c->data[0] == 'H') {
+        // One query per connection at a time, replies would cross
+        mg_http_reply(c, 503, s_json_header, "{\"error\":\"History query in progress\"}");
+        return;
+    }
+    if (mg_http_get_var(&hm->query, "node", node, sizeof(node)) <= 0) {
+        mg_http_reply(c, 404, s_json_header, "{\"error\":\"Unknown node\"}");
+        return;
+    }
+
+    history_job_t *job = calloc(1, sizeof(history_job_t));
+    if (!job) {
+        mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to allocate memory\"}");
+        return;
+    }
+    history_reply_t *r = &job->r;
+    r->to_ms = mg_http_get_var(&hm->query, "to", to, sizeof(to)) > 0 ?
+               strtoull(to, NULL, 10) : tag_clock_ms();
+    r->from_ms = mg_http_get_var(&hm->query, "from", from, sizeof(from)) > 0 ?
+                 strtoull(from, NULL, 10) : r->to_ms - 3600000;
+    r->bucket_count = mg_http_get_var(&hm->query, "buckets", buckets, sizeof(buckets)) > 0 ?
+                      atoi(buckets) : 300;
+    if (r->bucket_count < 1 || r->bucket_count > HISTORY_MAX_BUCKETS || r->from_ms > r->to_ms) {
+        mg_http_reply(c, 400, s_json_header, "{\"error\":\"Invalid range\"}");
+        free(job);
+        return;
+    }
+
+    // Copy what the reply needs, the tag table may be replaced before the
+    // query runs
+    tag_table_acquire();
+    bool found = find_node(node, &r->id, &tag);
+    if (found) {
+        r->name = strdup(tag.name ? tag.name : "");
+        // The key, unlike the id, still finds samples recorded before the node moved
+        job->key = historian_key(tag.device, tag.name);
+    }
+    tag_table_release();
+    if (!found) {
+        mg_http_reply(c, 404, s_json_header, "{\"error\":\"Unknown node\"}");
+        free(job);
+        return;
+    }
+    if (!r->name) {
+        mg_http_reply(c, 500, s_json_header, "{\"error\":\"Failed to allocate memory\"}");
+        free(job);
+        return;
+    }
+
+    job->conn_id = c->id;
+    job->state = HISTORY_JOB_QUEUED;
+
+    pthread_mutex_lock(&s_history_lock);
+    bool queued = s_history_job_count < HISTORY_JOBS_MAX;
+    if (queued) {
+        history_job_t **p = &s_history_jobs;
+        while (*p) {
+            p = &(*p)->next;
+        }
+        *p = job;
+        s_history_job_count++;
+        pthread_cond_signal(&s_history_cond);
+    }
+    pthread_mutex_unlock(&s_history_lock);
+
+    if (!queued) {
+        mg_http_reply(c, 503, s_json_header, "{\"error\":\"Too many history queries\"}");
+        free_history_job(job);
+        return;
+    }
+    c->data[0] = 'H';
+}
+
+// True if the comma separated Sec-WebSocket-Protocol list offers protocol
+static bool offers_protocol(struct mg_str *list, const char *protocol) {
+    size_t plen = strlen(protocol);
+    size_t i = 0;
+
+    while (list && i < list->len) {
+        while (i < list->len && (list->buf[i] == ' ' || list->buf[i] == ',')) i++;
+        size_t start = i;
+        while (i < list->len && list->buf[i] != ',' && list->buf[i] != ' ') i++;
+        if (i - start == plen && memcmp(list->buf + start, protocol, plen) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Upgrade to a websocket, binary telemetry when the client asks for it
+static void handle_websocket_upgrade(struct mg_connection *c, struct mg_http_message *hm) {
+    struct mg_str *protocols = mg_http_get_header(hm, "Sec-WebSocket-Protocol");
+
+    if (offers_protocol(protocols, WS_BINARY_PROTOCOL)) {
+        mg_ws_upgrade(c, hm, "Sec-WebSocket-Protocol: %s\r\n", WS_BINARY_PROTOCOL);
+        ws_client_init(c, 'B');
+        atomic_fetch_add_explicit(&s_binary_clients, 1, memory_order_relaxed);
+        send_schema(c);
+    } else {
+        mg_ws_upgrade(c, hm, NULL);
+        ws_client_init(c, 'W');
+        atomic_fetch_add_explicit(&s_text_clients, 1, memory_order_relaxed);
+    }
+    send_snapshot(c);
+}
+
+// Deliver a message queued by another thread with send_websocket_*()
+static void handle_wakeup(struct mg_connection *c, struct mg_str *data) {
+    char kind = 'W';
+    const char *buf = data->buf;
+    size_t len = data->len;
+    int op = WEBSOCKET_OP_TEXT;
+
+    if (len > 0 && (uint8_t)buf[0] == WS_WAKEUP_BINARY) {
+        kind = 'B';
+        op = WEBSOCKET_OP_BINARY;
+        buf++;
+        len--;
+    } else if (len > 0 && (uint8_t)buf[0] == WS_WAKEUP_SCHEMA) {
+        for (struct mg_connection *wc = c->mgr->conns; wc != NULL; wc = wc->next) {
+            if (wc->data[0] != 'B') {
+                continue;
+            }
+            if (ws_client_settle(wc) == WS_SEND_RECOVERED) {
+                resync_client(wc);
+            } else {
+                send_schema(wc);
+            }
+        }
+        return;
+    }
+
+    // Broadcast message to all connected websocket clients of that kind.
+    // Updates missed by a slow client are replaced by a resync once it
+    // catches up, so it ends up with the latest value of every node. The
+    // resync goes first, a binary client must have the schema before any
+    // frame, and holds the values of this message.
+    for (struct mg_connection *wc = c->mgr->conns; wc != NULL; wc = wc->next) {
+        if (wc->data[0] != kind) {
+            continue;
+        }
+        if (ws_client_settle(wc) == WS_SEND_RECOVERED) {
+            resync_client(wc);
+        } else {
+            ws_client_send(wc, buf, len, op);
+        }
+    }
 }
 
 static void fn(struct mg_connection *c, int ev, void *ev_data) {
     if(ev == MG_EV_OPEN && c->is_listening) {
         DBG_INFO("Connection opened");
-        ws_conn = c;
     }
     else if(ev == MG_EV_ACCEPT) {
         DBG_INFO("Connection accepted");
@@ -913,8 +1587,7 @@ static void fn(struct mg_connection *c, int ev, void *ev_data) {
             handle_logout(c);
         }
         else if (mg_match(hm->uri, mg_str("/websocket"), NULL)) {
-            mg_ws_upgrade(c, hm, NULL);
-            c->data[0] = 'W';
+            handle_websocket_upgrade(c, hm);
         }
         else if (mg_match(hm->uri, mg_str("/api/devices/get"), NULL)) {
             handle_devices_get(c);
@@ -940,6 +1613,24 @@ static void fn(struct mg_connection *c, int ev, void *ev_data) {
         else if (mg_match(hm->uri, mg_str("/api/network/set"), NULL)) {
             handle_network_set(c, hm);
         }
+        else if (mg_match(hm->uri, mg_str("/api/status/get"), NULL)) {
+            handle_status_get(c);
+        }
+        else if (mg_match(hm->uri, mg_str("/api/values/get"), NULL)) {
+            handle_values_get(c);
+        }
+        else if (mg_match(hm->uri, mg_str("/api/stats/get"), NULL)) {
+            handle_stats_get(c);
+        }
+        else if (mg_match(hm->uri, mg_str("/api/devices/status"), NULL)) {
+            handle_device_status_get(c);
+        }
+        else if (mg_match(hm->uri, mg_str("/api/logtags/get"), NULL)) {
+            handle_log_tags_get(c);
+        }
+        else if (mg_match(hm->uri, mg_str("/api/history/get"), NULL)) {
+            handle_history_get(c, hm);
+        }
         else if (mg_match(hm->uri, mg_str("/api/reboot/set"), NULL)) {
             handle_reboot_set(c, hm);
         }
@@ -959,12 +1650,21 @@ static void fn(struct mg_connection *c, int ev, void *ev_data) {
         mg_ws_send(c, wm->data.buf, wm->data.len, WEBSOCKET_OP_TEXT);
     }
     else if (ev == MG_EV_WAKEUP) {
-        struct mg_str *data = (struct mg_str *) ev_data;
-        // Broadcast message to all connected websocket clients
-        for (struct mg_connection *wc = c->mgr->conns; wc != NULL; wc = wc->next) {
-            if (wc->data[0] == 'W') {
-                mg_ws_send(wc, data->buf, data->len, WEBSOCKET_OP_TEXT);
-            }
+        if (c->data[0] == 'H') {
+            handle_history_done(c);
+        } else {
+            handle_wakeup(c, (struct mg_str *) ev_data);
+        }
+    }
+    else if (ev == MG_EV_CLOSE) {
+        if (c->is_listening) {
+            atomic_store(&s_listener_id, 0);
+        } else if (c->data[0] == 'W') {
+            atomic_fetch_sub_explicit(&s_text_clients, 1, memory_order_relaxed);
+        } else if (c->data[0] == 'B') {
+            atomic_fetch_sub_explicit(&s_binary_clients, 1, memory_order_relaxed);
+        } else if (c->data[0] == 'H') {
+            cancel_history_job(c);
         }
     }
 }
@@ -979,18 +1679,29 @@ static void *webserver_thread(void *arg) {
     if (!get_http_config(http_url, sizeof(http_url), &http_port)) {
         DBG_ERROR("Failed to get HTTP config, using defaults");
         strncpy(http_url, DEFAULT_HTTP_URL, sizeof(http_url) - 1);
-        http_port = DEFAULT_HTTP_PORT;
+        http_port = CONFIG_DEFAULT_HTTP_PORT;
     }
 
+    // One manager and one wakeup pipe for both the HTTP server and the
+    // websocket log server, each listener dispatches its own connections
     mg_mgr_init(&mgr);
-    snprintf(listen_url, sizeof(listen_url), "%s:%d", http_url, http_port);
-    mg_http_listen(&mgr, listen_url, fn, NULL);
     mg_wakeup_init(&mgr);
+    s_mgr = &mgr;
+
+    snprintf(listen_url, sizeof(listen_url), "%s:%d", http_url, http_port);
+    struct mg_connection *c = mg_http_listen(&mgr, listen_url, fn, NULL);
+    if (c) {
+        atomic_store(&s_listener_id, c->id);
+    } else {
+        DBG_ERROR("Failed to listen on %s", listen_url);
+    }
+    websocket_log_listen(&mgr);
+    mg_timer_add(&mgr, WS_CHECK_INTERVAL_MS, MG_TIMER_REPEAT, ws_check_timer, &mgr);
     DBG_INFO("Web server starting on %s", listen_url);
 
+    // mg_mgr_poll() returns as soon as a socket or a wakeup is ready
     while(1) {
         mg_mgr_poll(&mgr, 500);
-        usleep(20 * 1000);
     }
     mg_mgr_free(&mgr);
     return NULL;
@@ -999,6 +1710,8 @@ static void *webserver_thread(void *arg) {
 void web_init(void) {
     pthread_t thread;
     pthread_attr_t attr;
+
+    start_history_thread();
     
     pthread_attr_init(&attr);
     pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
@@ -6,5 +6,16 @@
 
 void web_init(void);
 bool apply_network_config(void);
+void send_websocket_message(const char *message);
+
+// Opt-in websocket subprotocol: a JSON node schema, then binary frames
+// of (node id, value) pairs. The frame layout is documented at
+// UPDATE_FRAME_VALUES in rtu_master.h.
+#define WS_BINARY_PROTOCOL "modbus.bin.v1"
+#define WS_BINARY_FRAME_MAX 4096  // Must fit one mg_wakeup() message
+
+void send_websocket_binary(const void *data, size_t len);
+void websocket_set_schema(const char *schema);
+int websocket_client_count(bool binary);
 
 #endif
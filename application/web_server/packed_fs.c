@@ -28,15 +28,15 @@ static const unsigned char v4[] = {31,139,8,0,0,0,0,0,0,3,173,60,139,114,219,56,
 
 static const unsigned char v5[] = {31,139,8,0,0,0,0,0,0,3,237,60,219,114,219,200,149,239,254,138,14,214,155,162,106,5,16,0,193,155,44,105,202,145,93,171,217,56,174,169,241,68,15,235,114,149,33,178,73,96,140,11,11,0,73,209,10,255,41,223,176,95,182,231,244,13,221,0,72,209,158,76,146,7,49,30,0,221,56,125,250,244,185,247,105,40,113,186,202,139,138,60,146,232,156,68,85,154,156,147,117,73,63,84,97,69,217,211,219,197,130,206,42,178,39,139,34,79,137,229,56,253,251,117,54,79,168,243,107,105,189,122,241,130,62,176,209,179,60,43,43,242,35,222,200,21,121,124,65,72,191,79,222,229,225,60,206,150,164,92,197,89,70,11,18,195,107,120,243,129,55,17,248,130,244,30,201,44,9,203,242,125,152,82,24,105,69,246,144,108,237,161,69,246,103,228,234,154,17,244,25,198,16,114,89,110,150,236,129,240,1,87,47,31,235,129,255,69,44,18,102,113,10,68,219,56,155,181,23,160,15,105,146,149,87,86,84,85,171,139,126,127,187,221,58,219,129,147,23,203,190,239,186,110,31,80,90,2,112,17,39,201,149,149,229,25,149,61,155,152,110,255,148,63,92,89,46,113,137,31,192,63,254,230,90,188,191,156,197,197,44,161,162,37,169,178,242,85,56,139,171,157,237,15,173,250,21,96,241,124,173,189,51,219,5,52,221,186,89,86,69,254,133,94,89,179,117,81,208,172,186,201,147,188,104,190,181,183,241,188,138,174,172,64,190,184,190,236,115,130,20,125,171,176,138,14,81,55,214,168,227,75,239,158,108,126,101,253,37,32,158,31,78,200,4,216,224,122,19,123,114,231,222,12,157,193,120,128,109,34,159,60,63,10,190,166,62,180,253,169,247,122,236,76,71,62,225,87,28,133,40,110,221,153,75,6,142,27,248,196,115,188,193,16,64,39,192,214,1,130,13,38,201,192,246,157,81,48,254,170,173,7,23,192,87,115,137,162,194,199,207,231,47,184,110,253,148,172,75,169,80,248,252,15,212,166,111,214,157,67,154,210,165,85,199,100,107,74,214,111,116,39,113,70,103,225,234,202,42,114,48,192,142,151,191,230,113,102,188,85,154,128,111,201,131,199,148,142,236,224,14,28,121,240,69,19,239,83,139,244,219,208,67,14,140,80,15,2,106,39,70,245,15,201,229,3,13,139,89,164,76,157,181,158,101,115,68,54,220,104,185,139,240,44,238,26,224,14,46,97,210,41,20,223,227,82,193,59,147,202,200,25,13,133,96,248,227,65,217,220,36,121,73,251,55,69,94,42,211,97,93,207,242,57,201,118,38,156,241,35,206,247,145,224,121,183,148,70,6,44,27,106,2,119,88,78,184,161,202,110,224,249,95,41,149,211,163,225,49,169,116,71,162,163,34,57,46,148,35,130,230,161,106,66,198,183,195,208,39,44,234,184,54,60,108,166,170,9,247,200,11,234,166,237,223,77,53,88,219,143,236,65,106,123,36,72,236,1,25,164,208,11,15,208,5,141,59,181,218,35,142,175,170,32,217,41,251,55,249,178,172,253,31,239,124,182,176,19,61,160,111,201,228,8,61,224,64,183,45,67,137,80,216,222,212,129,188,98,24,122,224,245,8,187,184,236,127,206,96,0,205,137,159,56,238,8,254,73,17,19,15,215,239,76,6,68,117,216,172,9,98,6,48,252,175,137,202,70,52,54,199,215,120,1,141,161,119,231,123,161,134,140,248,58,106,219,223,0,206,233,235,38,121,83,130,132,119,78,5,51,49,90,12,170,5,145,68,91,6,235,74,14,16,141,235,103,216,218,68,3,201,182,119,59,8,13,42,53,196,104,3,93,36,7,206,136,76,91,20,203,121,106,246,53,73,212,81,115,78,139,197,53,39,16,139,191,109,77,2,36,50,70,107,52,147,6,205,96,227,64,115,123,32,147,80,147,7,68,74,52,105,211,220,230,51,235,82,18,233,88,63,67,119,215,49,57,155,250,86,87,15,210,80,15,112,70,118,7,221,54,31,250,245,73,127,243,46,206,190,72,55,131,207,207,46,230,136,139,65,223,193,125,6,240,126,16,194,222,67,8,106,236,12,3,248,7,187,15,173,215,30,59,238,152,93,18,16,199,24,13,105,236,53,93,17,71,7,14,200,51,6,14,3,27,241,97,4,49,166,113,199,236,146,32,42,219,192,215,22,237,109,158,170,76,0,159,159,69,123,138,104,7,100,154,76,237,49,248,215,241,198,107,248,229,58,41,224,62,239,171,33,205,60,217,177,196,109,5,147,84,192,149,41,241,125,116,211,32,248,161,184,250,199,246,60,239,105,181,205,11,101,141,162,249,44,181,35,82,43,176,166,244,128,40,201,142,93,229,20,174,69,34,26,47,163,138,237,127,10,14,82,112,152,254,129,225,94,240,173,227,15,228,233,224,230,61,158,169,143,142,65,99,26,111,130,31,216,5,200,237,182,231,54,246,219,193,17,109,122,67,55,241,140,170,20,82,52,159,181,233,4,109,10,152,58,212,218,224,141,106,109,192,231,167,212,105,202,198,79,213,120,109,120,183,66,76,197,94,156,139,87,212,71,130,110,93,24,26,176,222,240,24,176,196,235,26,136,253,110,29,86,152,93,19,245,1,112,4,219,241,57,30,4,212,142,207,113,4,216,27,154,208,222,176,27,220,64,29,28,197,108,34,14,90,120,219,150,241,215,178,46,34,227,243,179,77,156,18,23,125,160,207,219,216,126,24,144,64,164,41,129,29,220,78,244,54,9,54,134,178,116,108,201,198,108,71,118,204,113,189,203,103,117,70,10,207,207,226,57,193,101,13,120,4,243,106,159,53,209,124,150,119,216,103,41,249,142,33,5,189,27,171,100,19,54,15,112,219,28,19,212,219,157,74,47,225,241,89,76,39,109,28,32,17,44,3,123,2,204,102,23,194,47,96,58,19,155,61,96,63,187,124,125,194,144,90,181,141,46,75,90,198,89,109,74,208,120,22,210,73,66,26,146,65,20,152,123,238,141,23,132,141,109,119,112,52,251,199,45,226,88,102,254,176,117,59,26,115,229,217,200,224,132,163,145,183,243,184,82,118,7,207,207,50,61,73,166,30,9,110,107,17,242,162,174,38,83,86,176,137,204,14,44,189,141,187,55,236,19,7,54,115,14,108,7,29,207,199,146,15,94,185,174,192,142,253,29,219,236,37,96,212,96,238,112,157,58,67,27,254,251,122,68,168,191,20,97,169,142,187,88,227,89,172,167,237,214,71,145,185,107,170,101,52,37,163,150,213,222,142,205,29,252,221,168,115,236,132,140,238,2,179,86,216,114,8,7,178,104,153,233,202,115,53,87,152,244,1,7,16,52,192,131,22,120,231,1,92,157,34,177,198,239,160,44,223,38,233,39,191,114,248,167,157,221,128,237,77,54,65,130,71,47,35,123,16,78,201,20,37,230,217,222,132,21,205,177,229,122,216,120,186,54,250,51,93,20,180,54,75,209,236,224,245,243,33,90,135,32,112,55,48,140,156,225,196,79,189,161,51,24,142,136,255,122,226,184,46,100,57,236,138,199,101,1,190,38,83,60,36,187,157,166,224,163,61,216,98,12,35,27,186,61,236,12,17,116,64,248,21,5,103,51,84,99,91,224,28,131,69,123,195,19,4,89,210,170,22,35,52,158,133,120,162,53,77,201,56,177,157,201,8,82,25,136,114,129,255,90,56,65,207,27,57,222,96,2,123,194,219,49,188,246,165,115,196,170,244,116,58,196,19,157,225,228,221,144,140,211,33,232,193,40,13,236,17,92,225,173,11,142,213,35,92,252,54,180,33,143,210,218,196,219,12,64,115,198,145,55,122,250,232,34,95,230,235,74,203,111,161,117,200,17,142,192,17,142,142,58,194,127,178,40,15,42,213,191,64,198,32,219,81,2,155,121,126,86,141,15,96,187,183,227,116,4,146,243,66,240,164,92,176,240,112,59,210,154,246,0,246,139,178,9,45,136,144,170,69,6,27,239,136,0,247,175,94,188,224,223,250,221,189,254,249,199,215,239,127,249,32,62,247,91,21,113,26,22,187,11,98,221,47,237,251,100,77,237,145,235,146,40,223,208,226,66,246,140,161,167,162,15,149,189,141,226,138,90,231,48,172,164,128,109,174,6,46,139,112,7,154,166,13,100,61,190,28,200,90,128,152,143,93,207,102,180,44,229,72,74,51,115,78,222,213,49,233,60,204,150,0,194,198,21,116,110,142,194,142,142,49,219,176,200,226,108,201,7,237,104,146,228,91,115,156,232,107,13,173,57,246,225,199,255,125,43,217,85,166,128,105,245,0,162,89,237,240,200,143,143,41,83,54,87,58,231,47,3,124,233,179,174,100,201,187,70,216,53,224,208,201,82,160,23,223,96,46,214,217,172,138,243,140,252,105,93,85,121,214,195,121,170,221,138,25,210,61,235,98,168,54,97,17,135,89,133,189,66,104,156,155,241,87,6,153,206,89,19,141,19,154,217,58,73,100,243,167,188,140,25,126,128,74,232,162,226,132,137,111,60,175,200,34,76,74,202,216,27,151,225,125,66,231,122,159,97,213,108,96,158,221,36,241,236,11,123,25,197,201,28,204,12,86,115,198,184,195,249,117,31,150,244,6,199,209,146,92,49,77,180,226,12,45,197,94,36,244,129,0,123,211,210,158,129,117,210,130,252,186,46,171,120,177,147,205,69,158,85,118,74,231,241,58,37,204,162,64,168,201,18,186,103,235,242,2,188,13,195,130,158,64,116,21,176,4,200,50,181,70,190,88,64,180,1,238,191,82,244,8,198,41,146,148,9,124,20,111,62,145,191,253,77,117,58,130,185,245,120,228,112,61,152,105,195,71,236,99,195,88,211,73,231,53,184,100,99,61,196,146,93,23,242,51,206,161,171,192,46,192,85,149,121,1,171,170,236,16,85,145,206,53,218,217,202,126,134,133,49,79,38,148,80,183,90,109,233,204,86,135,194,200,76,19,213,160,152,41,106,80,202,24,13,24,180,192,26,72,25,158,6,131,246,86,67,212,102,166,129,8,211,146,80,123,197,239,87,47,212,2,65,125,230,188,34,12,139,235,177,104,193,151,24,47,72,79,40,233,153,232,34,0,93,173,139,140,199,147,203,151,143,236,187,101,71,251,46,121,95,43,236,85,157,141,247,175,63,191,98,8,246,10,51,218,69,141,182,254,10,26,136,96,72,63,34,192,167,87,230,180,12,224,7,99,246,131,19,146,11,102,131,250,188,2,139,236,222,51,46,232,43,226,94,155,155,188,152,25,253,0,132,44,188,201,20,72,24,32,244,138,39,249,66,106,20,188,81,166,12,26,42,152,40,161,100,20,252,168,66,146,102,175,231,170,211,52,154,186,95,51,134,186,179,161,242,245,11,83,125,235,126,197,52,217,245,201,193,48,218,179,136,117,102,70,229,151,143,166,11,187,146,78,140,252,241,143,74,58,82,133,64,127,84,47,227,40,228,27,171,48,147,31,81,167,5,248,133,235,151,143,250,128,61,68,73,0,185,38,159,247,106,70,233,27,127,32,150,248,20,222,113,28,11,36,42,29,222,254,8,113,5,150,128,191,139,186,228,105,234,46,251,92,59,88,84,127,245,98,223,142,33,183,52,132,209,144,143,173,75,90,156,131,178,136,164,77,120,232,182,186,69,108,128,36,2,2,34,11,128,164,140,194,57,216,110,153,66,250,245,0,138,84,229,43,219,37,108,113,112,71,9,216,163,128,68,54,164,141,42,129,154,199,27,137,39,178,23,160,230,36,125,176,195,117,149,19,22,20,33,118,178,72,8,49,17,238,19,53,206,28,201,98,132,12,11,247,180,218,130,43,34,2,157,30,58,180,225,109,4,182,103,93,95,246,161,243,24,144,25,137,128,207,51,106,3,157,6,226,39,70,53,96,137,41,209,58,245,81,217,5,100,10,205,33,48,40,86,19,132,37,196,94,27,101,103,139,18,52,27,246,0,172,100,202,123,217,143,219,227,95,62,226,128,125,147,20,174,58,230,98,154,60,105,250,27,249,211,157,12,215,160,38,122,65,241,193,200,46,147,36,159,220,231,5,106,24,191,217,85,17,102,64,24,102,231,146,37,160,78,204,202,64,71,186,18,128,116,174,101,102,228,88,238,247,29,121,2,233,8,105,198,74,91,18,150,97,167,222,255,116,5,1,46,175,186,2,37,127,124,84,67,40,181,81,31,16,148,209,212,26,151,125,110,190,135,253,193,135,120,78,239,67,116,8,98,75,244,51,76,79,137,145,176,1,183,190,96,158,194,67,130,12,138,184,29,130,120,222,183,164,143,78,194,123,154,64,15,126,218,164,58,99,182,255,51,3,178,252,246,201,224,11,242,36,18,193,145,15,222,159,119,206,151,241,207,112,90,211,190,111,244,119,205,172,125,194,243,125,147,207,249,87,27,173,201,223,52,250,187,38,215,190,248,248,190,201,147,124,217,158,249,157,222,217,53,173,170,71,126,223,164,229,174,4,179,109,77,251,193,236,238,154,88,255,72,250,148,185,63,29,72,120,194,18,116,212,200,78,44,30,115,88,148,113,69,232,137,236,114,134,105,41,214,21,2,34,119,152,19,99,219,70,86,224,66,208,41,44,48,239,220,177,216,211,40,228,104,222,156,141,243,193,181,50,167,115,159,39,115,146,222,99,92,250,239,176,162,219,112,71,110,242,108,17,47,77,219,203,66,221,44,215,137,68,198,195,7,110,251,116,51,134,92,2,109,203,73,195,85,207,176,249,30,246,55,106,35,245,239,50,233,240,242,151,97,171,11,242,136,130,46,174,172,255,224,243,56,40,211,189,213,1,38,147,190,207,157,126,154,239,87,165,191,37,204,67,179,140,198,158,97,218,86,194,50,58,112,18,211,163,96,242,163,136,232,4,39,152,80,105,85,134,46,66,241,7,218,103,150,17,198,221,176,251,207,205,152,212,246,214,248,51,98,50,104,15,193,234,20,184,231,1,121,106,63,218,17,171,241,39,184,141,54,209,166,160,59,240,106,148,92,139,225,204,210,246,135,128,47,251,97,43,242,244,155,106,161,235,205,89,77,202,101,127,157,212,193,66,105,44,160,68,75,59,28,43,126,9,239,75,8,20,21,220,206,73,8,125,27,10,93,152,68,194,237,38,194,77,224,225,60,82,51,44,17,233,239,101,200,87,181,32,48,47,45,93,4,194,228,8,27,222,172,30,184,60,100,34,166,39,136,176,3,2,162,154,102,212,131,206,3,54,244,84,86,195,119,154,218,194,16,151,19,207,207,186,211,28,176,28,48,145,0,141,197,147,171,186,103,201,67,157,174,200,100,166,195,88,20,47,153,149,240,153,58,212,3,205,67,224,22,91,121,142,244,152,193,92,168,49,173,196,74,238,244,69,158,100,102,163,194,194,52,1,13,218,19,52,45,172,169,145,76,44,66,145,159,76,105,106,1,41,38,27,202,41,188,108,183,106,222,132,197,28,115,24,184,161,62,190,161,9,197,191,115,6,1,198,85,66,255,186,154,135,205,164,230,99,92,226,97,61,4,168,115,130,231,15,178,245,9,18,29,249,135,210,61,86,231,58,171,203,45,31,43,68,199,6,48,196,6,48,78,238,84,58,52,232,70,197,231,102,67,222,169,102,123,92,13,122,246,74,126,22,199,169,134,240,29,38,164,68,80,178,141,32,192,173,138,124,85,194,94,19,213,18,32,213,223,114,247,244,242,136,164,80,167,138,152,68,116,76,140,145,152,124,228,67,206,73,227,253,167,51,173,46,3,179,207,19,170,115,215,44,207,112,168,170,136,83,80,127,6,6,0,140,123,14,118,246,4,65,88,107,249,131,14,85,23,93,194,132,22,85,207,226,99,103,97,150,229,21,185,167,132,166,171,106,103,157,153,165,23,89,70,81,56,117,148,78,66,179,101,21,145,107,226,187,7,208,167,224,214,9,78,64,31,102,20,66,156,239,34,127,11,176,75,90,148,71,39,51,52,204,152,182,102,185,210,45,77,159,246,221,188,252,51,221,253,84,208,18,179,237,30,109,84,187,168,243,133,238,120,17,225,45,139,62,245,98,168,179,42,232,6,44,251,13,93,132,235,164,234,41,146,91,114,146,175,246,132,2,45,45,196,229,44,92,81,13,243,1,242,15,171,216,254,240,226,68,136,104,44,141,131,101,116,43,181,4,52,36,44,150,180,114,54,33,56,182,90,79,36,136,148,231,229,149,33,80,69,142,132,59,64,208,34,47,210,16,64,89,205,186,199,20,223,228,243,31,120,159,8,97,176,175,0,79,104,189,210,105,205,183,88,66,167,91,242,70,99,168,172,238,46,22,248,18,64,108,130,136,244,151,188,228,138,194,253,11,36,65,14,100,161,121,209,99,35,250,196,115,93,215,192,148,198,25,228,77,13,96,137,161,79,70,38,116,148,175,139,6,172,68,32,96,213,250,36,142,75,236,87,203,252,31,110,2,91,171,102,184,68,96,0,126,126,249,40,250,247,41,9,151,249,231,26,158,211,112,73,252,64,135,102,189,251,72,131,21,239,144,59,78,149,191,67,255,6,174,16,183,216,61,205,54,142,167,16,178,14,165,157,2,136,146,84,58,175,83,252,40,158,207,105,102,84,160,84,148,17,152,100,126,59,80,123,134,161,75,14,102,40,157,213,39,163,226,35,240,235,185,137,138,52,90,180,251,161,59,177,63,90,130,226,149,43,178,12,87,141,109,132,24,28,103,171,70,233,128,255,88,145,152,109,103,186,50,4,102,101,88,67,70,155,233,202,87,33,43,98,134,11,48,45,99,238,134,7,47,246,38,223,102,230,0,233,218,186,134,164,225,3,55,106,246,101,250,193,13,138,168,221,97,154,229,179,3,54,121,96,198,19,173,146,166,49,219,166,213,169,12,238,255,204,250,146,74,157,228,118,230,27,138,66,234,4,165,131,66,220,75,50,208,214,187,86,141,231,80,250,41,152,45,82,208,150,231,238,98,156,84,98,118,214,120,175,157,204,232,187,94,185,210,198,9,234,72,234,243,177,29,78,151,58,33,73,87,22,251,187,118,158,133,148,109,176,206,237,141,170,12,136,63,131,111,84,5,6,14,214,5,224,218,81,23,235,206,25,79,231,166,158,155,52,127,71,98,92,11,176,35,226,153,191,253,41,98,18,149,68,46,36,108,120,154,66,26,101,203,223,40,164,55,113,137,180,126,167,156,212,255,139,196,63,68,80,29,197,101,221,255,93,124,191,71,132,128,100,111,109,183,203,39,70,190,81,206,121,194,85,84,5,108,40,192,212,58,55,246,7,93,228,101,63,242,127,139,86,26,250,7,36,208,214,46,19,127,218,49,144,70,117,96,238,223,142,109,5,133,74,176,207,149,217,243,55,106,131,252,182,249,119,83,6,173,66,209,226,157,126,224,192,119,119,58,143,84,241,102,2,164,76,158,52,152,186,148,117,136,143,220,113,26,150,200,236,181,46,125,133,120,124,133,178,96,58,88,70,16,32,190,216,6,223,165,9,50,106,217,102,170,126,107,212,242,37,131,213,103,198,39,113,184,201,89,179,14,169,153,205,202,56,179,106,85,56,203,180,81,14,72,177,114,81,91,194,203,71,230,237,230,217,190,121,232,160,97,90,22,241,156,224,5,75,130,37,140,199,36,37,56,120,6,167,165,90,43,200,188,180,147,28,117,174,248,45,199,108,205,140,236,132,99,183,230,170,173,235,95,96,103,73,139,16,146,78,218,93,116,107,35,121,40,77,13,82,204,170,50,39,236,44,221,117,29,176,105,43,75,43,240,102,218,242,240,232,29,211,146,19,22,164,10,213,166,107,83,14,161,235,88,80,210,186,193,239,0,172,247,253,215,214,41,135,132,164,117,46,237,53,190,226,186,254,191,191,223,156,180,250,163,103,176,255,142,74,114,187,78,99,112,131,187,223,172,33,209,191,141,134,168,100,240,176,138,68,191,131,138,252,231,247,40,200,17,15,4,140,17,223,207,53,121,222,14,7,86,167,251,61,116,80,54,64,231,139,7,2,94,35,194,97,41,141,172,89,110,62,191,0,94,213,149,133,158,86,85,219,119,83,111,156,210,234,181,205,255,7,254,104,17,28,184,81,0,0,0};
 
-static const unsigned char v6[] = {31,139,8,0,0,0,0,0,0,3,237,61,107,115,219,56,146,223,243,43,16,86,106,75,174,177,228,216,121,204,172,99,39,229,177,61,179,190,202,56,169,216,51,119,91,41,87,76,139,148,197,13,69,106,73,202,143,243,233,191,95,55,222,0,65,18,146,229,76,50,27,212,76,44,130,120,52,26,221,141,70,163,27,12,102,101,76,202,170,72,134,85,240,234,81,50,153,230,69,69,238,200,120,157,140,171,73,186,78,224,245,73,21,86,49,253,117,56,26,197,195,138,254,252,45,158,228,100,78,70,69,62,33,193,96,176,1,255,93,204,178,40,141,7,255,42,245,134,142,134,121,86,174,147,159,103,85,149,103,122,133,253,28,138,100,113,86,149,172,198,163,141,13,178,15,101,171,16,178,72,152,69,4,106,142,146,203,89,17,86,73,158,61,194,118,42,178,255,238,248,151,163,95,201,46,185,123,68,200,111,123,255,243,233,224,240,143,163,253,195,147,109,178,185,245,211,58,207,59,125,119,186,247,246,211,241,187,3,204,127,246,244,169,200,63,222,251,237,240,211,219,195,227,95,79,255,177,77,182,88,246,209,241,167,247,239,222,190,61,58,254,245,211,209,241,233,225,135,63,246,222,66,91,178,74,253,221,203,23,47,158,189,16,85,79,143,126,59,124,247,251,169,94,67,102,201,130,7,123,167,123,159,78,255,249,30,161,249,8,207,132,124,220,92,39,193,207,121,158,198,97,22,156,173,179,188,45,200,59,202,170,159,100,198,51,200,248,221,200,121,206,138,108,190,148,57,47,120,25,45,235,37,43,244,108,139,244,246,126,222,63,88,147,47,126,84,47,246,15,246,126,86,47,126,226,141,212,171,252,93,123,99,214,129,1,147,224,151,52,15,43,187,206,230,166,122,99,213,193,33,30,228,179,139,52,102,121,244,159,95,126,63,222,63,61,122,119,252,105,159,77,152,134,162,167,155,164,79,62,196,97,4,148,145,164,165,129,170,167,91,226,221,65,82,14,139,184,138,201,81,54,157,85,165,129,191,167,207,68,169,127,228,105,148,100,151,240,112,153,148,85,92,148,6,86,159,62,23,229,104,35,118,41,248,103,14,36,58,154,101,67,36,70,114,16,95,37,195,184,236,173,81,58,4,202,165,60,66,38,97,22,94,198,19,32,106,200,101,4,251,49,132,26,87,241,105,120,177,78,202,184,218,19,79,103,64,195,130,183,122,65,68,219,235,51,138,15,214,94,169,234,236,77,73,43,243,94,141,170,31,207,244,210,101,156,2,131,198,17,43,73,43,157,24,89,70,221,108,150,166,122,237,164,124,155,135,136,36,90,241,72,60,25,117,170,98,22,235,117,96,158,163,195,162,200,11,90,231,173,120,50,135,23,152,189,156,132,87,170,19,246,96,148,31,133,105,105,116,82,134,87,177,234,228,68,60,181,116,130,53,78,102,67,192,86,41,235,240,231,246,174,146,114,47,194,65,107,24,60,50,178,252,170,31,231,145,89,25,51,156,85,25,253,252,146,23,19,16,195,240,162,84,141,101,241,181,6,198,177,120,50,154,185,163,52,156,109,147,32,96,228,28,133,32,141,216,207,105,130,130,137,201,63,66,46,183,9,237,19,159,230,58,204,208,141,4,247,152,253,110,239,66,245,48,146,191,162,74,254,172,84,175,115,57,192,195,40,169,106,3,140,33,19,112,115,148,69,241,13,237,254,80,203,104,37,85,94,83,67,207,161,158,227,83,23,199,89,235,89,102,250,182,96,87,118,213,99,24,192,21,51,249,223,56,34,87,97,58,211,176,80,229,85,152,98,213,146,85,197,114,61,138,72,16,47,187,175,233,47,192,47,227,253,65,17,71,179,97,220,235,209,90,235,60,27,203,177,118,200,15,164,199,242,6,89,249,102,144,198,217,101,53,38,255,247,127,228,233,218,58,254,207,36,30,111,236,12,158,24,120,12,18,83,122,52,131,68,122,102,73,242,120,119,151,224,88,201,27,1,167,37,137,206,222,0,56,8,198,199,51,2,18,254,204,2,100,221,234,218,6,108,20,87,195,49,123,181,79,69,36,128,21,150,183,217,144,195,195,40,180,42,110,249,47,98,200,47,37,179,248,27,41,165,152,208,224,47,88,87,240,111,85,228,105,26,23,208,7,112,6,217,187,0,69,102,95,230,246,100,67,124,246,146,73,156,207,170,163,8,138,67,211,167,236,177,199,224,82,141,13,66,108,166,7,147,128,172,241,116,237,21,82,196,230,83,168,2,101,34,209,138,9,74,17,151,160,33,129,122,6,131,189,14,19,142,134,94,176,17,78,147,13,142,185,141,203,184,10,214,229,176,9,153,196,213,56,143,128,87,127,61,60,229,236,138,105,12,75,27,172,102,219,90,73,66,2,28,22,44,86,253,211,219,105,28,64,157,112,58,77,147,33,213,183,54,254,85,230,153,214,192,92,253,44,147,203,44,76,183,245,209,177,44,81,100,174,33,21,84,156,66,32,69,226,74,189,79,70,164,247,88,12,116,144,127,94,211,0,172,198,69,126,77,231,128,77,150,6,249,249,47,97,146,2,43,85,57,67,10,39,59,83,101,220,38,79,238,100,211,40,122,102,229,105,124,83,205,207,101,67,114,46,231,38,230,163,176,10,37,214,101,19,136,145,158,78,71,66,11,160,197,41,113,235,111,205,133,151,22,18,252,248,154,60,5,86,121,10,172,32,37,11,192,64,0,243,48,148,94,140,163,85,136,64,144,64,83,28,196,140,98,41,46,216,168,81,157,113,14,28,40,130,53,226,36,122,57,124,90,102,144,133,19,32,49,224,224,128,146,58,45,19,104,184,126,67,130,15,241,191,65,98,49,98,143,8,76,225,128,188,135,137,5,210,68,158,11,47,195,36,27,232,85,182,121,211,19,88,110,65,33,66,220,4,106,198,80,101,112,194,45,154,144,8,25,37,64,85,105,3,87,171,181,23,231,15,254,215,37,25,44,247,139,203,11,166,138,212,196,133,212,55,132,142,161,229,115,157,66,95,205,49,1,115,255,17,166,73,132,74,161,49,196,146,92,196,163,188,136,17,66,232,203,160,186,36,187,194,58,156,170,0,100,33,243,71,73,10,170,168,154,183,158,146,250,26,210,31,11,185,143,232,22,15,81,168,63,77,19,250,180,87,20,225,237,0,84,21,252,171,150,139,53,133,126,141,59,77,168,52,10,110,99,213,224,36,7,162,226,240,147,49,32,74,140,206,66,71,208,196,130,67,49,111,2,9,147,112,218,211,6,78,122,170,119,224,116,49,8,37,165,80,15,146,72,80,217,168,19,73,108,168,236,75,153,123,169,50,179,82,53,204,1,200,96,81,180,187,167,0,224,11,189,123,170,37,209,204,80,207,28,241,204,145,158,137,186,19,205,141,42,61,91,228,106,153,243,181,53,37,100,255,172,165,107,137,85,170,108,90,165,222,191,59,121,168,101,234,34,143,110,183,201,127,157,188,59,30,160,125,35,187,76,70,183,61,70,86,107,95,235,98,134,114,107,101,107,25,26,84,64,124,194,12,93,228,121,69,246,222,31,145,112,4,130,132,148,76,104,141,102,41,237,208,154,78,44,188,191,32,41,177,90,167,109,4,101,55,220,73,86,88,252,67,27,113,177,34,127,10,109,9,170,169,13,202,143,118,44,116,213,40,72,31,122,7,29,105,235,42,159,231,50,46,174,226,194,33,88,173,37,203,94,230,228,250,87,95,203,78,198,208,39,167,26,34,22,117,88,198,200,51,174,192,150,170,25,115,214,21,224,13,11,166,64,45,218,233,158,26,157,126,136,71,64,241,99,50,197,206,24,225,134,192,27,105,120,139,131,5,194,70,152,232,88,213,224,187,193,184,78,178,40,191,30,164,57,155,99,216,79,161,58,210,211,33,121,193,32,161,79,139,232,100,108,73,247,215,200,148,94,241,103,107,100,141,98,199,210,200,220,116,194,136,204,84,192,78,199,192,178,189,105,145,79,75,169,166,160,65,249,124,167,26,75,142,8,203,114,55,152,222,244,95,146,233,109,255,25,169,64,160,245,211,120,84,177,95,55,37,144,24,112,38,12,48,153,77,88,222,37,40,44,125,152,31,50,155,78,227,98,200,198,27,14,63,3,56,253,235,4,216,155,1,44,212,162,39,119,20,130,1,168,202,105,84,196,217,156,230,239,108,84,227,215,231,106,59,127,26,53,194,26,217,80,62,39,215,227,164,2,214,12,135,113,63,203,175,139,112,202,32,43,45,8,131,78,24,34,132,65,2,145,148,124,215,13,115,255,123,150,192,236,34,80,72,9,64,57,55,195,116,198,237,18,144,219,223,212,104,186,136,171,89,145,9,13,175,28,148,160,120,9,122,226,234,210,58,232,94,80,211,80,23,105,14,221,183,27,141,255,237,111,82,225,25,84,249,219,252,58,46,246,1,201,200,68,184,197,7,104,204,236,71,146,56,230,198,88,208,118,224,26,9,107,156,91,93,120,207,210,228,98,15,141,10,67,97,79,208,106,158,105,42,173,249,2,149,88,129,17,20,111,175,92,40,178,107,152,40,203,168,77,199,3,97,10,236,191,253,77,105,140,84,11,92,10,117,32,241,246,162,136,74,118,105,102,6,214,28,142,227,225,103,218,46,109,131,204,40,70,51,20,196,225,176,200,241,15,44,241,124,104,141,51,176,71,139,170,157,5,27,46,157,19,250,139,143,233,64,97,134,78,134,241,210,156,39,120,211,69,133,146,252,52,132,27,210,24,87,150,207,9,48,208,56,22,157,136,141,161,182,30,70,58,80,10,255,7,122,163,188,127,42,145,244,53,100,95,98,175,132,25,36,195,89,1,28,88,153,125,240,186,154,213,140,65,207,40,33,19,163,182,214,17,39,236,88,88,81,204,136,232,90,94,247,48,116,66,34,170,99,189,180,156,3,165,246,105,85,76,44,88,185,11,144,166,92,11,133,112,55,201,148,239,108,145,64,5,165,42,202,187,226,219,94,37,205,4,247,219,156,77,201,25,56,153,245,95,36,147,222,154,216,93,34,88,218,254,146,143,32,224,214,70,90,113,24,102,25,40,59,23,128,253,201,180,186,13,212,50,196,154,167,173,202,205,42,59,54,28,88,135,128,181,30,206,29,61,0,230,99,152,218,39,119,238,54,64,67,24,135,176,4,225,89,209,185,14,132,64,251,44,77,109,249,40,112,116,146,194,186,11,76,95,32,55,3,150,66,246,83,67,20,43,159,205,38,127,160,205,24,202,76,195,162,4,10,168,100,217,87,114,196,192,243,225,113,79,148,93,163,168,21,21,119,200,166,241,252,154,108,61,255,177,142,96,10,16,225,77,147,201,172,164,8,190,136,171,235,56,206,160,9,60,149,133,138,193,130,227,124,15,186,49,181,234,3,146,32,15,135,154,240,223,94,99,149,133,213,96,133,124,168,141,153,191,208,70,46,230,205,113,210,235,40,111,208,138,93,158,201,236,26,213,240,241,17,1,103,13,115,138,120,28,64,204,41,90,13,250,170,23,153,44,76,92,98,1,88,29,251,29,203,69,232,97,152,175,214,254,3,178,30,223,30,32,114,248,70,222,139,18,69,217,251,18,34,119,18,232,162,63,94,172,129,236,196,24,90,169,141,55,225,32,50,249,198,135,182,196,17,229,56,68,31,143,66,201,123,150,65,15,205,247,225,247,37,165,183,184,134,204,59,166,108,176,179,47,216,86,193,138,54,168,194,226,50,174,88,215,105,92,177,29,10,217,229,61,211,236,242,58,161,219,47,70,192,114,247,133,122,127,144,5,219,230,190,9,170,214,87,159,30,237,81,46,105,132,92,20,113,248,249,149,209,82,20,182,52,165,11,105,159,198,166,73,75,99,150,36,108,111,47,138,71,225,44,173,182,93,111,249,166,30,41,208,218,154,134,48,61,85,207,220,108,178,41,53,106,234,7,202,61,216,252,196,87,166,89,115,48,24,96,166,176,100,124,196,25,56,219,102,243,183,206,181,130,154,226,207,136,129,41,41,95,23,65,8,105,88,195,56,149,133,172,52,108,126,24,52,240,227,113,171,6,205,91,89,51,76,73,188,75,45,135,192,6,158,169,238,0,245,24,84,197,164,100,242,45,76,97,38,163,91,16,112,73,89,81,205,52,204,110,133,6,42,54,242,232,152,21,114,125,159,73,233,64,129,61,111,35,193,170,5,17,194,46,226,65,201,35,173,25,224,255,255,30,199,74,225,131,89,132,97,13,233,4,151,184,79,217,36,208,205,214,58,90,133,64,129,162,39,98,213,237,52,102,175,122,220,215,105,205,64,59,67,54,181,115,108,6,184,20,105,25,91,129,137,92,229,154,224,34,86,39,201,154,132,43,69,56,27,184,89,136,57,47,112,33,7,224,115,112,213,48,180,210,156,236,69,210,89,171,101,98,30,148,151,153,231,220,21,148,197,117,36,46,146,33,25,37,113,26,209,137,65,165,228,146,73,108,214,199,199,32,12,214,113,118,225,159,8,77,167,64,47,103,131,36,163,27,140,146,113,150,2,161,11,241,53,164,55,32,28,231,151,161,248,125,145,95,37,81,44,80,194,103,61,31,1,157,0,120,88,13,117,169,81,152,164,194,170,40,81,62,39,49,108,109,238,15,155,38,197,244,214,157,210,236,100,118,49,73,42,91,136,197,180,101,216,75,30,176,81,244,132,233,82,63,249,195,157,57,155,8,93,173,0,16,14,155,151,43,233,243,51,200,56,88,172,26,87,202,237,154,198,234,164,234,70,161,81,89,40,166,118,109,123,57,82,13,76,19,49,32,161,207,177,186,48,139,6,36,240,108,52,110,211,238,2,53,91,8,92,153,1,212,1,228,174,174,40,113,47,80,187,119,57,241,231,191,133,55,201,100,54,65,254,184,136,11,164,54,113,56,217,51,148,34,222,208,28,77,10,225,112,28,71,3,178,207,148,81,0,158,76,240,228,86,0,34,142,94,186,0,127,92,55,237,25,179,220,8,52,44,30,220,38,219,186,124,180,45,24,30,32,106,126,12,138,137,62,10,214,129,117,26,126,106,142,104,120,38,250,241,140,204,133,171,131,161,71,136,129,104,190,98,134,67,154,237,146,102,58,165,41,131,67,205,233,78,179,53,187,245,13,127,46,21,211,98,185,48,237,114,23,166,53,137,163,229,217,89,42,27,220,179,206,98,101,190,137,176,107,137,149,89,84,170,26,57,80,111,160,149,225,140,130,29,11,8,181,148,65,87,202,212,8,228,198,137,201,105,105,148,212,221,166,40,41,12,180,145,249,42,117,36,79,174,212,188,238,76,81,162,57,143,119,139,19,230,115,167,132,10,179,52,154,34,69,107,80,137,21,7,74,235,146,134,182,230,37,103,24,97,205,166,72,71,14,7,18,205,119,66,179,109,203,209,49,55,15,97,106,52,25,67,87,195,248,206,80,215,186,64,56,240,118,181,76,42,35,108,213,76,249,153,112,87,41,83,5,51,85,57,194,165,14,245,176,180,222,160,178,38,149,11,65,95,81,181,70,149,139,195,172,156,161,140,70,19,184,80,134,172,250,161,163,122,184,102,247,50,114,148,26,213,74,185,64,169,172,82,115,253,241,76,59,78,86,7,180,6,122,25,158,148,229,213,150,210,230,44,27,98,152,170,66,78,33,172,203,224,145,246,91,105,190,31,98,104,3,21,70,161,151,9,85,146,42,75,143,228,120,149,244,118,72,107,10,128,91,86,71,64,86,66,211,97,22,64,147,12,69,41,205,108,44,14,108,18,126,84,83,179,186,208,179,202,98,162,49,230,30,76,254,109,62,35,148,10,240,199,117,152,241,81,97,247,98,65,13,158,220,169,158,230,193,27,114,138,114,231,58,1,110,4,224,101,105,228,206,4,132,143,197,136,244,175,121,24,92,17,185,70,58,60,183,122,159,128,237,232,88,19,122,132,196,198,174,157,169,106,226,210,156,215,198,181,138,163,79,177,77,221,227,80,243,45,20,68,102,171,184,108,156,212,240,182,203,206,190,236,179,14,62,56,101,76,108,112,240,5,190,254,40,235,27,115,37,38,169,115,110,232,42,0,51,35,58,131,121,57,95,179,209,188,172,140,243,151,114,86,79,194,13,90,57,130,53,76,170,194,94,125,127,200,212,40,1,29,202,71,163,245,185,170,161,246,143,14,113,160,120,174,91,34,212,92,34,171,176,16,142,234,46,254,179,188,239,123,58,141,162,126,0,11,23,114,4,192,19,79,161,201,233,45,174,119,120,250,197,89,10,125,50,174,242,4,151,174,40,25,221,98,47,248,54,47,146,75,244,226,172,241,248,105,78,67,2,118,137,38,175,108,134,215,85,72,41,103,173,66,145,146,221,168,92,54,21,131,13,141,166,115,242,13,190,93,72,57,134,209,37,76,173,90,10,36,177,122,113,65,62,127,101,33,79,120,251,106,99,172,137,66,26,206,194,6,95,155,6,102,143,210,219,226,14,157,102,30,247,235,52,51,97,140,150,198,18,112,61,105,132,146,13,85,40,169,194,6,203,108,91,44,184,4,159,253,201,59,24,135,252,253,40,185,173,60,99,101,213,107,62,149,72,121,200,148,86,36,137,242,249,172,205,185,54,217,141,242,218,230,34,77,6,215,104,68,190,211,105,99,24,102,195,56,21,212,209,194,159,11,183,172,11,128,54,137,239,8,134,233,217,178,173,85,32,80,57,238,47,14,176,120,155,48,232,88,104,52,13,167,198,251,237,85,149,224,24,45,92,87,169,130,134,58,234,87,57,82,42,226,226,149,69,221,154,228,161,186,151,66,102,195,102,25,95,45,102,156,95,167,22,208,117,230,137,2,59,23,111,91,61,16,201,63,104,159,172,234,69,126,3,242,2,35,52,213,38,12,45,196,212,222,43,74,4,134,229,209,164,234,197,108,124,28,220,154,149,175,105,3,204,65,21,90,175,5,233,71,60,36,90,167,167,59,205,182,210,230,115,67,211,218,174,140,223,168,55,4,134,169,219,242,26,81,174,128,208,191,233,32,178,196,129,191,172,237,60,185,88,244,252,159,226,143,89,100,27,161,6,124,117,66,109,236,150,22,61,184,183,106,181,30,223,119,141,255,139,30,228,51,234,51,255,2,25,254,78,117,57,42,43,25,137,132,37,200,88,102,97,88,13,99,104,167,44,1,186,146,6,52,12,137,225,207,155,91,164,81,44,82,30,51,146,89,212,244,103,26,109,83,165,130,117,46,206,122,218,253,14,52,194,236,246,252,49,72,145,53,238,237,128,160,81,192,74,28,128,212,110,75,162,100,233,67,218,206,153,190,199,65,45,182,125,239,195,90,65,17,232,188,120,165,121,134,1,62,41,22,249,44,32,107,40,223,69,15,82,89,120,14,25,78,239,231,69,162,109,221,204,131,189,185,6,153,44,34,78,139,101,134,207,169,177,29,235,186,78,236,120,100,25,135,85,27,156,38,179,30,198,106,170,41,218,110,12,212,214,75,231,129,176,99,122,71,129,255,58,73,207,10,69,191,171,61,121,166,64,201,142,1,48,115,153,196,156,45,203,170,162,171,87,13,103,207,142,147,103,193,135,182,100,197,228,127,220,108,28,54,123,205,7,238,240,204,67,96,77,135,89,228,224,215,111,146,22,61,208,117,177,145,34,146,202,80,22,218,85,5,79,199,42,163,168,203,185,202,139,219,86,233,107,229,195,106,181,149,126,137,67,238,197,214,244,238,174,150,90,104,208,212,129,13,138,13,173,107,195,169,17,195,99,77,22,82,187,135,43,63,108,200,31,53,228,71,85,195,11,22,46,228,99,51,161,162,214,195,112,178,248,65,26,44,183,212,181,27,89,68,184,167,211,32,211,26,106,218,215,22,3,113,245,53,38,51,23,151,175,232,48,238,203,28,93,57,77,186,202,74,4,123,236,51,197,141,122,49,109,235,141,106,143,194,178,205,188,190,38,222,21,157,246,212,77,52,46,123,16,179,9,52,219,153,116,214,236,50,1,249,182,223,16,200,114,9,138,95,129,59,6,78,32,230,198,129,1,37,202,48,2,55,67,8,52,240,208,222,112,1,20,199,95,241,221,65,160,140,17,195,124,134,59,56,120,183,169,50,241,124,142,85,56,127,114,39,170,207,159,220,241,194,243,115,142,252,235,113,2,235,104,147,219,198,177,189,74,210,202,63,252,32,166,215,163,23,141,248,133,175,45,171,180,48,14,165,136,105,192,160,238,3,238,14,194,177,81,137,53,86,143,72,83,112,9,52,154,129,65,95,2,167,124,115,205,118,63,128,224,3,121,116,129,178,75,147,92,214,70,73,21,53,9,241,155,245,75,226,226,144,17,9,67,109,19,239,245,20,211,59,29,125,84,35,43,117,248,145,209,201,141,147,119,204,205,204,157,83,39,140,221,214,196,53,58,0,185,213,1,86,156,218,187,105,249,81,82,148,85,231,41,202,95,210,205,164,153,108,164,231,147,181,18,235,36,100,59,41,212,9,168,221,89,129,63,120,185,34,212,169,200,37,86,199,220,74,77,151,68,138,23,134,43,139,148,246,233,251,38,89,208,230,179,246,32,110,114,11,14,137,199,38,58,7,228,224,144,102,167,142,251,58,155,52,207,31,27,145,188,103,212,136,221,143,242,225,12,47,86,28,84,73,149,210,165,234,228,231,163,119,167,125,174,24,241,53,171,118,81,24,147,94,243,117,118,55,211,35,17,41,199,239,16,18,156,199,151,12,26,244,205,193,219,137,146,43,25,252,221,127,25,168,72,224,157,241,166,120,65,35,190,183,110,82,22,168,126,145,167,192,81,23,88,88,232,177,191,201,11,33,119,54,198,155,90,27,208,186,124,144,161,240,23,151,125,26,93,78,10,88,216,162,56,234,167,151,164,28,135,81,126,221,159,68,4,160,32,163,20,52,93,40,49,41,251,195,152,174,204,255,130,13,105,50,186,229,143,202,142,163,223,12,164,143,165,222,2,139,101,191,233,111,5,122,29,168,245,228,142,94,222,58,56,153,38,25,48,57,62,204,89,51,200,172,187,193,184,255,130,92,195,255,20,11,23,176,11,236,191,124,250,52,32,27,86,51,208,126,102,32,140,134,200,99,209,215,124,26,156,87,15,128,50,189,179,129,117,141,145,108,192,80,52,52,234,143,218,3,85,8,168,204,170,205,108,211,188,222,103,86,121,19,79,238,228,101,152,202,140,161,211,84,211,188,67,235,207,97,122,159,19,32,128,2,166,29,248,130,92,228,69,4,147,195,254,208,220,231,144,75,65,195,135,31,225,129,83,73,11,81,112,43,69,51,85,188,214,96,158,91,200,133,18,23,244,214,94,99,58,243,108,63,77,134,159,119,159,220,213,120,109,110,20,84,23,39,60,195,139,19,54,197,224,182,0,242,113,126,21,23,219,60,227,153,26,10,146,185,28,226,79,98,188,229,4,102,98,56,43,183,243,89,149,38,25,222,187,144,197,60,11,239,245,233,111,233,15,88,21,239,95,208,128,49,9,242,67,92,21,183,6,77,177,97,54,144,213,249,92,78,175,188,134,244,75,78,175,123,242,52,96,230,94,112,243,123,87,150,135,252,178,0,74,114,192,206,242,37,244,236,177,19,254,3,7,199,83,99,81,164,221,78,148,222,62,38,39,183,37,80,54,115,205,227,23,220,160,107,193,116,154,234,115,200,205,193,32,51,26,145,33,248,252,113,191,79,78,195,139,146,244,251,146,247,53,153,192,56,221,192,139,20,207,108,192,23,106,228,32,199,182,180,171,62,104,133,44,148,21,250,208,216,244,134,241,167,144,178,63,217,82,214,193,99,58,151,177,53,80,191,57,184,118,91,240,220,170,204,122,127,114,119,78,239,43,1,6,220,36,73,70,25,167,46,41,196,152,40,15,89,151,173,148,19,171,97,164,165,90,22,44,247,2,50,126,80,109,64,231,40,79,47,176,17,29,227,178,241,66,16,143,92,68,156,181,182,101,173,170,8,51,64,40,53,150,153,247,194,48,201,162,242,126,84,210,70,155,180,103,174,46,230,231,38,34,95,91,37,40,229,168,69,49,174,208,0,82,214,86,197,73,1,43,41,44,130,26,125,137,196,137,126,223,184,215,220,232,162,38,138,104,238,18,36,2,211,253,25,214,168,62,191,214,236,171,35,18,27,190,191,42,153,188,133,113,46,66,34,111,25,94,8,191,82,172,147,58,118,54,64,222,180,43,68,114,25,240,227,211,55,214,202,32,199,228,162,94,148,164,132,95,161,86,27,205,142,165,78,200,150,112,195,2,27,8,209,34,255,54,64,29,25,150,92,254,137,73,82,75,185,49,72,53,176,155,64,197,110,203,80,236,132,94,87,198,147,4,117,59,71,21,15,78,229,109,215,116,91,251,26,40,214,87,150,23,147,48,117,246,68,112,27,111,218,144,230,27,78,211,143,216,192,175,185,0,169,105,202,34,127,188,229,200,125,114,199,112,110,11,5,76,74,174,88,182,47,87,225,40,41,195,139,52,142,160,180,121,113,186,237,160,195,139,123,216,202,92,221,92,133,69,18,102,21,104,147,69,50,9,139,91,23,227,39,64,200,187,193,251,116,70,69,114,189,132,11,249,38,33,58,176,183,81,35,73,131,167,100,174,131,170,233,117,9,117,154,174,33,202,240,142,194,84,103,63,218,133,205,11,114,179,136,251,66,215,134,209,73,110,59,227,103,6,189,66,5,131,27,112,167,243,60,120,109,142,5,168,232,153,179,177,17,142,49,207,88,240,157,164,24,246,56,119,83,123,195,94,52,206,34,114,25,78,177,111,103,181,122,197,254,102,99,81,40,156,134,23,113,218,248,90,237,184,211,124,248,89,219,101,184,174,155,195,181,1,176,178,229,94,109,48,53,195,65,200,177,112,140,106,0,180,38,65,110,74,75,130,76,82,24,106,75,19,208,127,111,18,222,116,56,184,148,107,76,70,180,52,212,130,206,13,138,207,150,2,212,93,178,165,109,244,106,96,3,108,27,74,70,151,71,7,243,170,68,143,155,129,212,180,8,90,151,196,16,9,164,25,221,26,72,226,212,124,157,218,234,1,66,153,144,218,109,68,107,55,117,93,247,113,19,67,196,22,120,171,182,115,98,58,134,190,251,93,96,163,43,116,162,54,108,77,83,216,117,140,129,175,227,98,55,56,164,202,92,253,248,173,173,129,34,254,247,44,129,29,105,99,145,154,132,20,169,102,77,48,94,126,155,204,204,252,99,121,184,253,195,115,245,102,31,157,118,191,2,190,101,39,15,221,156,27,133,139,177,110,20,62,8,239,38,160,8,180,34,23,184,123,55,64,71,230,111,148,135,75,221,79,251,59,251,234,169,141,125,133,123,183,184,239,226,225,57,184,221,95,188,223,238,43,222,218,246,228,171,88,208,125,5,195,52,89,76,48,76,147,135,18,12,237,51,210,33,51,150,158,175,175,89,152,76,173,160,135,239,242,68,79,109,242,228,183,184,160,166,154,20,207,186,221,22,2,14,114,39,187,153,230,247,134,17,45,67,62,53,99,30,48,65,127,220,255,248,124,107,122,115,182,220,176,217,4,52,31,40,14,103,69,153,23,253,105,158,52,152,100,140,198,186,4,13,38,38,108,100,140,88,71,233,36,218,13,26,12,207,42,49,185,212,89,140,71,145,25,194,233,178,93,50,27,242,169,103,127,165,197,157,156,238,1,109,201,184,148,199,163,252,229,182,12,217,24,88,145,113,205,105,94,179,26,219,137,211,192,24,239,69,135,255,13,235,172,60,159,180,201,115,65,145,213,34,84,88,50,214,106,88,149,183,76,6,15,94,255,51,46,155,12,100,90,43,157,60,218,42,193,154,95,182,189,178,141,33,194,182,137,230,16,113,98,244,140,76,170,54,187,136,243,116,64,37,198,59,172,80,51,154,109,171,159,229,235,210,76,7,234,152,247,57,147,73,198,17,63,59,56,132,223,155,154,88,74,47,213,1,176,60,67,107,232,160,121,58,24,132,141,211,225,58,72,209,222,123,33,173,164,134,172,102,164,213,198,126,113,169,168,159,226,161,230,206,33,7,78,203,253,184,204,192,79,212,39,91,22,27,118,35,33,238,108,160,33,207,101,61,118,84,80,71,169,178,152,58,29,40,241,64,32,141,59,108,249,237,126,46,136,161,81,10,191,199,73,20,197,25,174,207,246,161,41,109,176,162,61,9,182,135,85,141,47,143,208,81,18,197,253,91,241,67,144,24,161,21,250,163,228,38,110,176,141,86,248,137,24,13,72,174,234,55,176,222,78,85,52,146,215,147,187,211,241,252,245,113,62,112,152,144,237,66,176,16,117,151,50,44,15,221,197,237,157,78,119,13,91,151,233,174,177,199,110,126,111,44,184,179,225,70,16,126,126,3,240,236,158,1,252,104,83,141,76,154,102,180,97,98,212,121,10,6,15,52,12,194,17,83,224,54,188,43,216,138,198,119,132,124,142,111,241,12,4,219,234,222,7,60,185,107,186,208,135,30,121,202,101,17,35,115,131,160,99,39,100,31,2,91,151,0,177,225,181,181,81,86,183,41,106,87,84,107,219,38,92,109,123,181,164,110,88,53,239,13,20,2,150,248,156,202,82,219,92,76,124,86,200,15,100,179,13,11,244,131,44,237,3,243,0,190,67,217,125,114,167,127,241,86,77,123,135,150,229,58,146,109,128,210,71,155,102,201,207,34,175,146,135,109,94,37,177,163,183,46,140,233,82,39,89,170,109,239,173,59,43,252,90,185,159,5,95,165,218,222,107,139,187,179,181,238,189,124,208,212,161,214,98,234,154,115,245,125,194,239,180,173,37,95,227,148,74,62,246,107,149,220,228,221,110,205,86,105,69,244,221,105,229,214,202,122,216,187,85,250,54,40,190,29,219,223,73,190,51,249,88,102,85,114,147,124,187,157,86,165,213,145,252,210,246,91,173,153,251,88,114,85,250,202,217,228,92,168,193,56,73,24,119,254,157,93,180,180,152,69,145,37,79,147,33,75,202,112,104,114,76,167,241,144,165,213,48,204,151,49,207,177,180,18,162,253,74,102,90,77,94,180,208,172,9,119,184,7,155,156,85,77,196,195,203,130,198,176,34,59,61,188,84,232,176,245,233,73,219,79,199,214,245,177,237,9,63,202,156,79,223,23,249,52,188,164,222,162,61,237,118,143,246,36,110,3,53,110,92,237,74,243,133,4,128,22,153,241,210,246,126,198,204,191,251,81,86,55,97,97,106,177,79,234,169,203,68,107,148,253,202,167,80,93,218,233,91,103,169,249,227,54,117,219,121,125,165,179,215,106,86,215,147,255,252,173,80,236,127,229,116,160,95,177,250,208,236,44,151,10,141,28,104,222,223,241,76,187,104,59,211,86,201,143,38,112,68,255,97,28,173,223,86,255,208,51,137,1,127,214,68,98,214,74,217,250,128,142,103,181,108,189,188,18,209,116,52,64,155,117,230,59,45,216,208,12,158,23,184,14,174,232,89,143,159,243,126,205,26,255,152,223,4,177,148,107,126,229,60,172,106,57,234,117,133,177,112,47,124,39,38,236,120,22,35,80,185,81,215,162,17,254,7,113,133,151,176,209,187,25,229,33,73,253,186,225,166,121,93,73,180,11,166,30,71,52,189,23,99,187,54,1,52,91,196,194,172,147,83,188,252,162,177,45,217,134,186,105,195,138,159,49,46,198,104,26,90,139,123,128,59,134,134,190,105,139,163,193,228,136,165,65,8,155,138,59,162,105,232,188,57,99,105,48,249,220,46,210,212,153,79,76,13,166,174,184,26,76,77,83,45,194,72,142,245,239,98,235,169,225,240,208,205,168,244,141,140,180,65,196,52,196,216,96,178,80,88,99,101,76,205,106,7,141,108,105,156,84,43,222,69,125,127,170,9,215,139,197,237,44,132,98,207,128,158,70,254,233,156,34,76,58,119,53,83,90,203,114,192,119,107,59,29,14,171,152,236,149,81,70,125,10,39,62,38,94,208,253,182,67,197,233,90,194,122,242,242,37,58,174,52,193,47,136,241,139,115,154,4,5,75,92,92,180,169,172,219,203,141,88,74,210,7,26,114,147,100,36,125,77,152,204,25,70,58,218,42,226,73,152,100,120,139,138,23,174,26,87,149,134,224,50,250,78,91,52,47,139,36,34,248,79,127,152,167,101,255,69,71,184,152,59,252,212,120,223,229,71,186,98,79,210,174,217,233,136,20,91,145,79,250,202,162,197,58,252,0,186,188,233,188,108,120,190,103,212,94,103,211,154,151,57,187,37,179,93,83,175,89,96,173,155,178,59,220,243,239,121,250,188,180,199,111,59,14,12,247,111,121,83,118,123,157,78,159,239,86,147,99,171,215,228,183,199,164,31,226,203,164,68,13,221,35,8,236,79,96,129,142,243,107,155,5,58,14,172,239,199,2,95,130,132,229,116,120,196,66,253,231,16,233,47,250,85,233,247,164,80,182,53,243,32,189,209,98,164,55,250,230,72,175,235,24,131,139,249,95,126,63,222,63,61,122,119,252,105,31,245,170,54,23,68,145,122,31,249,135,1,232,108,156,121,248,34,138,180,147,79,233,60,11,228,210,191,115,188,212,11,91,154,239,108,176,247,93,90,97,123,71,173,206,131,160,38,80,2,249,143,225,173,3,199,39,225,107,48,175,146,175,162,14,193,111,51,86,212,184,11,101,233,43,228,44,195,242,33,5,132,246,121,6,35,107,171,13,66,79,38,61,216,59,221,251,116,250,207,247,223,25,244,47,199,160,252,75,13,95,102,39,229,252,252,67,223,249,233,135,142,182,124,226,121,191,220,150,203,199,143,140,137,167,5,165,211,131,10,167,154,127,152,23,238,107,238,96,94,181,190,132,118,203,73,249,33,148,218,133,194,113,151,9,75,243,57,226,243,11,77,107,9,78,107,51,166,99,122,224,224,180,118,126,236,56,73,239,62,104,243,69,96,87,152,218,195,6,170,117,220,152,210,230,12,210,25,165,215,22,84,233,14,89,115,197,167,209,242,120,110,192,236,215,77,17,106,180,216,178,81,106,141,49,98,216,89,195,240,150,12,93,115,182,214,136,194,197,98,218,88,149,198,179,89,250,218,39,182,77,47,216,30,223,166,149,180,109,43,126,181,140,205,174,95,21,169,195,251,21,231,98,216,175,112,87,84,28,45,218,114,252,221,18,29,71,95,175,36,66,14,147,251,212,181,67,27,166,223,111,210,191,38,228,167,10,3,73,241,8,57,89,179,225,122,56,189,78,183,27,229,67,68,147,97,234,118,126,208,70,210,21,89,70,7,211,225,83,73,203,172,194,199,154,193,102,127,81,144,125,220,66,60,117,54,176,136,119,37,133,220,223,27,23,211,162,145,103,152,22,138,62,195,100,197,43,248,88,252,245,228,244,191,94,72,25,213,211,170,98,209,48,61,92,216,1,38,15,231,97,76,62,148,177,77,41,174,27,233,223,121,67,75,203,243,134,103,232,26,38,23,111,120,198,174,97,90,45,111,124,107,244,220,137,168,191,56,61,123,24,46,245,228,117,56,160,39,23,113,118,28,22,232,233,91,34,78,63,218,196,116,143,211,5,61,45,111,200,212,83,131,81,115,161,54,232,215,82,168,13,116,177,174,61,13,166,122,242,31,92,231,117,71,10,140,46,163,234,162,0,108,19,247,4,143,146,44,242,157,97,62,187,108,90,213,87,222,169,212,26,121,181,177,246,102,240,113,243,236,187,128,91,92,192,117,157,210,232,201,37,225,186,78,109,244,244,45,137,56,227,104,199,252,88,175,56,222,241,110,169,94,189,245,40,72,79,75,72,218,197,142,136,244,244,93,202,182,166,175,65,202,106,147,187,2,9,43,191,140,158,49,86,110,119,136,20,233,187,176,93,114,119,180,200,37,7,152,188,14,170,244,228,18,208,127,154,124,94,238,80,203,104,97,169,3,46,61,125,67,123,180,115,102,153,131,249,234,186,243,0,211,95,156,187,22,8,178,195,84,187,77,44,188,138,197,23,194,123,202,230,187,48,221,120,132,31,123,71,44,98,242,95,151,60,99,145,49,45,18,189,72,203,47,141,92,243,211,235,203,98,179,57,24,248,129,112,233,29,25,140,105,49,108,250,177,246,23,36,253,5,20,31,61,230,151,126,18,247,190,140,178,146,192,94,76,254,163,240,12,240,197,244,229,216,132,201,32,22,136,187,18,196,222,47,206,22,147,63,70,189,227,109,49,45,200,44,247,95,212,218,14,32,105,23,141,239,26,81,223,24,139,203,95,186,226,113,217,43,231,25,127,211,213,179,173,101,20,216,46,97,65,93,0,172,239,235,117,126,191,206,251,211,204,181,245,191,235,187,115,196,250,210,168,72,60,54,86,0,42,190,51,105,183,78,131,82,237,76,13,96,166,155,220,58,187,48,48,241,97,150,198,37,116,195,14,209,93,110,17,77,30,128,77,161,135,220,169,143,5,30,26,221,52,126,72,204,196,52,63,166,165,95,158,85,248,110,114,177,104,253,184,181,29,101,221,26,13,233,12,112,110,244,83,108,113,136,97,31,226,20,99,110,241,234,107,132,164,67,106,186,62,174,220,230,208,3,52,90,115,232,17,71,227,62,151,130,247,58,239,93,208,190,67,95,192,176,73,154,95,38,67,50,142,139,102,33,216,120,85,66,123,180,42,98,181,81,8,121,220,127,221,73,69,124,87,163,113,186,224,126,175,143,211,9,47,171,103,242,187,169,29,65,138,45,88,117,199,62,190,100,177,143,29,174,180,173,126,14,173,158,44,136,166,147,124,86,12,99,249,1,192,46,39,96,173,202,49,245,195,241,169,0,130,23,245,38,188,108,218,167,248,41,253,124,193,66,32,241,42,254,32,237,13,61,224,241,241,172,244,33,20,109,10,205,105,107,238,250,56,39,252,211,185,148,205,74,249,5,237,56,34,183,113,53,104,7,106,161,87,237,43,179,123,81,225,139,215,65,60,141,129,119,178,97,242,144,75,139,163,179,135,94,96,44,70,220,242,248,102,101,11,25,141,159,123,47,54,204,41,190,213,211,82,103,216,230,184,68,192,208,243,22,144,58,15,63,190,146,47,25,181,50,178,97,57,15,130,215,236,74,116,82,50,12,69,92,126,116,219,184,189,46,146,103,137,95,39,239,109,235,183,173,251,242,26,231,215,218,111,63,59,124,91,87,45,59,165,46,235,122,167,135,248,151,34,108,67,236,127,39,108,7,97,179,239,250,124,39,108,14,193,242,132,189,228,90,216,153,89,223,169,74,39,117,186,108,158,208,207,57,102,17,183,177,241,47,162,151,218,146,105,232,137,218,93,83,130,46,43,131,64,209,101,124,90,161,173,26,22,74,82,11,225,96,139,22,111,78,129,229,188,206,168,125,15,144,140,72,143,106,32,197,164,23,236,21,49,185,205,103,164,156,241,31,215,33,236,170,171,28,143,128,135,97,17,145,16,24,107,72,143,63,202,55,193,218,90,109,63,49,138,171,225,152,241,57,251,242,186,125,95,155,14,152,177,123,144,151,25,149,49,128,19,89,215,25,177,43,140,246,211,188,140,237,59,140,140,43,151,96,26,128,73,85,187,250,140,89,214,79,195,191,187,3,113,104,70,215,71,53,247,237,159,192,46,42,196,43,140,26,222,178,113,33,241,152,195,210,225,166,164,229,254,142,189,54,6,141,64,229,207,243,87,143,128,74,227,155,105,94,160,108,25,133,179,84,74,225,87,143,254,31,204,73,98,214,56,224,0,0,0};
+static const unsigned char v6[] = {31,139,8,0,0,0,0,0,0,3,237,125,235,114,219,70,178,240,127,61,69,27,229,114,81,181,34,41,201,178,147,208,162,93,138,164,236,234,148,35,187,44,101,207,217,114,185,236,33,49,36,177,6,1,46,0,234,242,41,124,168,239,21,206,147,157,154,251,5,3,96,64,81,142,157,120,170,18,139,131,185,246,244,109,166,123,122,130,101,142,33,47,178,104,92,4,47,182,162,249,34,205,10,184,131,217,14,204,138,121,188,3,203,28,95,20,168,192,244,175,211,201,4,143,11,250,231,175,120,158,194,10,38,89,58,135,160,215,235,247,122,253,209,50,9,99,220,251,119,174,55,116,54,78,147,124,7,126,94,22,69,154,232,21,142,211,249,34,77,112,82,228,172,198,86,191,15,199,105,146,23,40,41,114,64,73,8,227,52,153,68,211,101,134,138,40,77,182,72,59,5,28,191,57,255,229,236,239,48,132,187,45,128,95,143,254,231,227,201,233,63,207,142,79,47,6,176,183,255,227,14,207,187,124,115,121,244,250,227,249,155,19,146,255,116,119,87,228,159,31,253,122,250,241,245,233,249,223,47,255,49,128,125,150,125,118,254,241,237,155,215,175,207,206,255,254,241,236,252,242,244,221,63,143,94,15,96,79,86,41,127,123,254,236,217,211,103,162,234,229,217,175,167,111,126,187,212,107,200,44,89,240,228,244,151,163,223,94,95,126,188,56,125,119,118,244,250,227,219,55,239,46,7,16,244,67,124,213,47,138,219,249,205,120,47,208,139,253,124,244,219,201,199,119,71,151,167,3,216,219,123,182,207,134,175,213,189,24,192,123,171,182,209,218,190,245,251,169,245,251,32,248,64,90,148,221,144,246,246,72,55,176,127,64,254,127,240,35,249,255,79,207,201,255,247,126,162,31,158,254,72,191,60,251,129,101,210,81,209,70,222,30,189,59,187,60,163,77,108,1,0,188,15,206,73,111,231,105,130,89,47,36,235,148,100,157,94,225,68,101,189,33,89,111,194,144,229,208,255,157,28,93,30,125,188,252,215,91,173,177,189,29,8,126,78,211,24,35,85,117,127,7,130,179,164,248,81,102,60,221,129,224,55,35,231,128,21,217,123,46,115,158,241,50,90,214,115,86,232,233,62,116,142,126,62,62,217,150,31,126,80,31,142,79,142,126,86,31,126,228,141,148,171,252,164,125,49,235,236,237,238,64,240,75,156,162,194,174,179,183,167,190,88,117,200,20,79,210,229,40,198,26,120,126,249,237,252,248,242,236,205,249,199,99,134,214,26,136,118,247,160,11,239,48,10,225,56,141,226,220,0,213,238,190,248,118,18,229,227,12,23,24,206,146,197,178,200,13,248,237,62,21,165,254,145,198,97,148,76,225,29,158,70,121,129,179,220,128,234,238,129,40,71,27,177,75,125,216,217,90,189,216,218,154,44,147,49,33,89,56,193,87,209,24,231,157,109,74,173,253,62,80,78,2,115,148,160,41,158,227,164,216,2,96,100,253,30,141,139,232,10,95,162,209,14,228,184,56,18,191,62,192,80,114,160,78,16,210,246,186,140,47,4,219,47,84,117,246,37,167,149,121,175,70,213,247,31,244,210,57,142,241,184,192,33,43,73,43,93,24,89,70,221,100,25,199,122,237,40,127,157,34,2,36,90,241,76,252,50,234,20,217,18,235,117,226,20,133,167,89,150,102,180,206,107,241,203,156,94,96,246,114,129,174,84,39,236,135,81,126,130,226,220,232,36,71,87,88,117,114,33,126,213,116,66,106,92,44,199,99,156,231,178,14,255,93,223,85,148,31,133,100,210,26,4,207,140,44,191,234,231,105,104,86,38,25,206,170,12,127,126,73,179,57,228,228,67,174,26,75,240,181,54,140,115,241,203,104,230,142,226,112,50,128,32,96,232,28,162,1,236,177,63,23,17,97,223,140,205,2,76,7,64,251,100,191,242,197,128,139,156,158,131,139,179,50,163,172,84,70,242,86,222,195,237,0,8,99,220,2,88,233,96,72,240,181,132,192,57,251,187,126,212,106,208,19,249,87,88,200,63,11,125,34,225,104,0,252,207,116,172,77,106,37,161,121,26,70,69,9,154,56,140,138,40,153,158,37,33,190,161,3,59,213,50,106,233,130,215,212,214,226,84,207,241,169,75,32,80,234,89,102,250,182,96,87,118,213,99,16,32,74,76,244,255,112,8,87,40,94,106,80,40,210,2,197,164,106,206,170,146,114,29,10,202,206,54,12,95,210,191,0,56,211,233,101,56,92,142,113,167,67,107,237,240,108,82,142,181,3,127,131,14,203,235,37,249,171,94,140,147,105,49,131,223,127,135,221,237,29,242,31,99,175,188,177,15,91,0,108,120,108,36,38,171,170,30,18,116,204,146,240,104,56,4,50,87,120,37,198,105,177,189,15,175,122,73,78,134,241,254,3,12,224,253,7,107,32,59,86,215,246,192,38,184,24,207,216,167,99,202,143,97,8,40,191,77,198,124,60,12,119,139,236,150,255,5,6,179,84,12,146,127,145,44,145,113,40,254,129,117,53,78,147,34,75,227,24,103,48,132,4,95,195,209,40,205,138,99,153,219,145,13,241,213,139,230,56,93,22,103,33,12,73,211,151,236,103,135,141,75,53,214,67,164,153,206,246,14,37,154,221,237,23,4,35,246,118,33,199,227,52,9,69,43,230,80,50,156,47,210,36,199,100,178,215,40,226,96,232,4,125,180,136,250,28,114,253,41,46,130,29,57,109,128,57,46,102,105,56,128,224,239,167,151,156,144,73,154,97,20,226,44,31,104,37,1,2,50,45,156,20,221,203,219,5,14,6,16,160,197,34,142,198,84,5,238,255,59,79,19,173,129,149,250,51,143,166,9,138,7,250,236,88,150,40,178,210,128,26,99,148,9,160,72,88,169,239,209,4,58,143,196,68,123,233,231,109,109,128,197,44,75,175,233,26,176,197,210,70,254,233,23,20,197,56,132,34,101,64,225,104,103,106,241,3,120,124,39,155,38,172,103,153,95,226,155,98,245,73,54,36,215,114,101,66,62,68,5,146,80,151,77,16,136,116,116,60,18,42,7,45,78,145,91,255,106,74,121,90,72,208,227,75,216,133,87,176,11,3,144,156,5,96,5,99,68,166,210,193,100,182,10,16,100,72,105,140,123,152,97,44,133,5,155,53,209,157,156,19,15,118,128,53,226,68,122,57,125,90,166,151,160,57,134,225,112,8,1,69,117,90,38,208,96,253,10,130,119,248,63,75,204,145,61,132,116,89,244,224,109,140,81,142,41,205,161,41,138,146,158,94,101,192,155,158,227,60,71,83,76,96,19,168,21,35,250,137,115,220,162,9,9,144,73,148,160,56,174,160,106,37,232,201,250,1,172,116,78,134,174,112,123,126,193,244,158,18,187,144,202,141,80,104,180,124,174,192,232,170,3,73,253,62,252,19,197,81,72,52,80,99,138,57,140,240,36,205,48,25,97,148,76,13,172,139,146,43,82,135,99,21,12,37,207,159,68,113,129,181,117,235,40,174,175,1,253,145,224,251,4,220,226,71,136,244,95,139,136,254,58,202,50,116,219,139,114,250,175,18,23,219,10,252,26,117,154,163,210,48,184,142,84,131,139,116,142,197,248,97,134,174,176,152,157,5,142,160,138,4,199,98,221,4,16,230,104,209,209,38,14,29,213,123,50,0,49,9,197,165,136,210,37,129,160,178,137,2,38,161,161,178,167,50,119,170,49,186,133,204,205,23,4,114,77,218,25,112,13,109,129,178,28,159,37,133,128,237,40,219,118,84,183,20,55,224,202,155,24,221,45,37,155,115,141,7,247,251,112,20,94,161,100,140,67,130,127,68,229,200,33,77,226,91,32,10,9,26,197,152,46,196,114,58,131,98,134,225,232,237,25,160,12,195,103,188,40,0,229,221,40,151,45,245,122,61,49,182,2,81,241,189,76,66,60,137,18,28,194,147,39,112,7,133,130,94,129,96,181,189,227,170,58,25,185,170,78,70,178,234,100,84,85,53,139,92,85,51,181,56,89,84,85,181,152,59,7,60,87,3,158,27,85,147,92,161,7,71,163,36,13,75,72,68,209,136,124,208,145,136,106,193,52,19,233,153,19,158,57,209,51,137,110,76,115,195,66,207,22,185,70,38,153,14,205,77,199,108,248,68,107,38,124,199,24,185,86,46,28,81,161,65,203,18,101,91,100,234,197,87,219,219,74,2,255,81,122,205,26,42,76,94,165,194,188,125,115,241,80,58,204,40,13,111,7,240,95,23,111,206,123,228,60,50,153,70,147,219,14,227,57,219,95,171,166,67,132,218,198,20,29,75,126,217,50,79,10,195,178,96,187,152,165,215,144,179,122,32,36,252,36,205,224,41,215,102,115,213,140,137,54,106,194,21,210,83,44,19,57,71,221,93,71,45,98,82,213,95,41,82,162,253,143,86,138,42,23,215,82,138,220,171,3,14,29,232,114,6,67,232,44,178,116,145,75,77,129,28,179,127,58,44,102,18,103,81,158,15,131,197,77,247,57,44,110,187,79,161,192,55,69,55,198,147,130,253,117,147,195,36,77,138,238,28,135,209,114,206,242,166,25,186,237,62,219,221,133,229,98,129,179,49,155,47,26,127,142,146,105,247,58,10,49,7,147,208,76,30,223,209,17,244,198,179,40,14,51,156,172,104,254,97,191,152,189,252,164,118,212,151,97,229,88,67,123,148,7,112,61,139,10,156,47,208,24,119,147,244,58,67,11,54,178,220,26,97,208,56,134,144,140,65,14,34,202,249,198,23,205,241,111,73,244,159,37,97,91,29,130,9,59,128,111,198,241,146,31,13,192,16,186,123,26,66,103,184,88,102,137,80,178,242,94,158,206,177,192,39,46,180,118,32,34,53,13,141,141,230,80,81,102,52,254,228,137,148,86,189,34,125,157,94,227,236,24,229,152,80,16,217,101,163,57,54,179,183,36,114,172,140,185,144,237,187,107,38,172,113,126,240,193,123,150,167,30,246,212,40,211,18,91,122,173,230,7,77,171,52,63,16,61,82,64,132,48,149,23,46,16,217,53,76,144,37,244,88,197,3,96,106,216,79,158,40,113,79,69,248,90,160,163,250,85,72,249,176,60,86,46,82,24,207,240,248,51,109,151,182,1,75,10,209,132,176,63,52,206,82,242,79,28,11,61,181,114,5,142,104,81,165,220,179,233,210,53,161,127,241,57,157,40,200,208,197,48,62,154,235,68,14,73,26,176,80,162,159,6,112,131,21,19,126,254,57,90,80,125,145,119,34,246,102,154,220,10,245,65,41,248,159,232,141,242,254,41,71,210,197,197,177,132,94,14,81,2,227,101,150,225,164,48,251,224,117,181,131,43,54,122,134,9,137,152,181,37,68,156,99,39,133,21,198,76,64,151,165,205,211,208,17,9,84,199,122,105,185,6,74,184,106,85,76,40,88,185,45,80,83,202,66,193,220,77,52,229,155,75,130,160,2,83,21,230,93,241,157,167,226,102,130,250,109,202,166,232,252,251,239,188,255,44,154,119,182,197,6,143,12,75,219,226,241,25,4,252,192,143,86,28,163,36,73,11,24,97,192,243,69,113,27,40,49,196,154,167,173,202,253,34,223,252,88,166,209,82,15,159,28,61,224,155,49,198,33,60,190,115,183,177,130,241,12,101,104,76,108,67,159,244,65,8,176,47,227,216,230,143,2,70,23,49,186,194,71,97,152,17,106,30,66,7,177,63,53,64,177,242,201,114,254,79,114,108,11,67,181,185,19,101,95,200,25,71,249,57,58,239,136,178,116,207,39,43,30,194,158,241,251,37,236,31,252,80,6,48,29,16,240,166,97,190,204,41,128,71,184,184,198,56,129,61,106,171,222,63,248,33,104,57,207,183,105,28,211,131,245,2,103,87,40,38,83,141,248,223,94,115,149,133,213,100,5,127,40,205,153,127,208,102,46,214,205,97,255,118,148,55,112,197,46,207,120,118,9,107,248,252,64,140,179,4,57,133,60,142,65,172,40,88,13,252,42,23,153,183,70,46,33,0,54,71,126,231,82,8,61,12,241,149,218,127,64,210,227,123,3,2,28,190,93,242,194,68,81,246,190,136,200,93,39,154,240,143,23,171,64,59,49,135,90,108,227,77,56,144,76,126,241,193,45,97,146,156,33,226,249,146,41,126,207,50,168,145,252,120,134,146,41,197,55,92,2,230,29,83,54,152,249,9,86,48,4,114,182,147,77,113,193,186,142,113,193,118,40,48,228,61,211,236,252,58,162,219,47,134,192,114,247,69,244,254,32,9,6,230,190,9,134,14,233,211,161,61,110,43,113,56,202,48,250,252,194,104,41,68,53,77,233,76,218,167,177,69,84,211,152,197,9,235,219,11,241,4,45,227,98,224,250,202,183,210,4,3,173,173,41,138,113,86,116,204,205,38,91,82,163,166,110,64,238,116,22,25,190,50,207,164,122,189,30,201,20,103,13,239,201,10,124,24,176,245,219,225,90,65,73,241,103,200,192,148,148,54,8,177,195,212,92,28,250,99,70,191,15,111,151,163,56,202,169,33,66,28,72,14,32,195,212,29,43,77,8,115,32,189,79,98,52,165,200,31,98,20,142,80,18,26,92,138,109,179,211,113,176,173,159,198,115,19,181,1,23,9,17,122,92,38,199,187,93,1,228,114,39,225,168,77,39,228,156,237,87,84,204,122,115,116,211,217,221,97,44,136,122,209,112,164,97,118,213,234,1,220,139,126,132,240,40,33,40,21,29,172,244,147,39,156,154,159,60,129,71,181,27,14,222,202,182,113,118,198,187,212,114,0,130,35,182,211,185,142,10,114,138,28,229,76,28,160,56,195,40,188,5,124,19,229,5,85,228,81,114,43,20,118,113,238,65,188,251,16,223,30,49,161,22,168,97,175,234,40,182,168,1,132,56,67,242,32,252,137,214,76,191,15,255,61,195,74,63,134,49,153,22,195,200,156,108,235,246,32,205,96,127,135,28,93,141,49,51,249,21,183,11,204,62,117,184,43,216,182,1,118,6,108,138,74,123,1,89,125,45,99,63,48,129,91,129,94,6,176,45,10,55,233,92,74,60,54,113,179,16,115,196,224,50,97,140,129,15,87,77,67,43,173,225,167,141,163,53,11,243,160,172,143,185,95,94,225,140,202,120,156,69,99,152,68,56,14,233,194,16,29,110,202,4,28,235,227,125,128,136,11,223,132,252,47,36,103,197,65,17,124,232,69,9,221,143,229,140,178,26,233,90,206,163,4,244,10,128,147,245,101,32,126,155,165,87,81,136,5,72,248,170,167,19,216,35,195,35,213,8,3,156,160,40,22,71,159,18,228,43,192,113,142,239,63,54,141,233,235,173,59,153,255,197,114,52,143,10,155,231,99,218,50,78,138,19,54,139,206,182,98,227,210,86,73,14,50,216,66,232,90,24,154,179,67,82,183,116,151,46,81,189,132,15,139,85,227,123,24,187,166,33,204,85,221,16,25,149,133,30,111,215,182,165,183,106,96,17,137,9,9,158,207,234,254,254,187,57,146,223,127,55,27,183,113,183,69,205,26,4,87,167,38,202,100,58,212,245,74,238,74,108,247,46,23,254,211,175,232,38,154,47,231,132,62,70,56,35,216,38,204,169,29,67,135,228,13,173,200,9,12,26,207,112,216,131,99,166,187,163,48,132,57,177,53,139,129,8,123,64,211,192,31,149,79,66,141,85,174,28,116,112,36,142,176,107,197,71,157,192,240,24,162,230,121,161,136,232,189,20,219,84,130,107,126,122,196,254,247,254,3,172,132,115,134,161,118,137,137,104,126,111,134,191,158,237,177,103,251,236,249,121,237,249,248,237,25,158,123,234,224,167,228,236,168,157,249,187,245,62,127,242,23,235,109,121,115,13,185,55,215,182,4,254,250,124,66,106,49,220,253,208,226,17,124,51,103,215,18,34,95,84,42,42,73,91,111,160,150,146,141,130,13,146,137,158,88,70,19,237,200,55,202,5,150,58,79,124,37,217,212,105,96,10,2,117,244,179,73,229,203,147,220,53,7,68,147,71,105,87,27,154,249,20,115,63,84,220,138,157,248,154,188,74,107,80,241,43,7,72,203,44,140,182,230,197,192,24,98,45,23,4,143,28,190,52,154,27,137,102,99,144,179,99,30,47,226,200,215,36,12,93,191,227,59,116,93,157,235,245,122,188,93,45,147,50,31,91,231,83,46,55,220,107,204,212,237,76,29,17,56,59,163,206,166,214,23,162,5,74,173,69,224,87,88,108,83,173,229,52,201,151,132,249,19,83,132,208,178,172,250,200,81,29,109,219,189,76,28,165,38,165,82,174,161,20,165,82,100,79,165,237,163,228,152,71,108,51,101,22,95,233,63,63,104,118,124,101,205,54,86,131,129,85,29,152,219,210,194,68,10,67,28,80,149,204,41,12,116,89,48,209,254,86,26,248,59,156,99,226,198,43,245,67,161,210,82,165,109,75,130,71,151,34,154,195,180,229,50,237,100,253,116,120,110,198,31,226,24,11,125,140,29,235,154,56,45,74,105,182,0,97,133,139,184,253,173,116,148,70,13,208,217,92,163,242,163,12,195,109,186,4,138,82,228,143,107,148,240,57,147,238,133,216,15,30,223,169,158,86,193,43,184,36,76,236,58,138,99,64,113,46,75,19,82,143,138,220,166,106,250,175,105,225,47,64,74,114,135,71,92,231,227,14,68,116,174,204,157,136,205,221,225,161,169,26,145,95,43,4,31,7,159,233,170,96,122,114,106,62,155,2,5,109,69,156,205,147,158,166,14,153,65,211,54,96,241,201,169,19,226,10,199,233,94,146,191,151,245,141,181,18,139,212,184,54,84,164,4,143,239,68,103,171,224,213,167,109,27,204,235,50,76,127,150,105,245,36,220,203,149,107,86,197,162,42,232,149,119,177,76,217,19,163,35,204,214,104,125,165,106,168,93,174,131,89,40,154,107,230,23,37,87,211,2,101,226,2,128,139,254,172,91,13,29,29,71,137,178,145,97,170,80,65,136,241,2,198,233,226,150,8,79,98,210,228,36,85,164,128,174,210,136,200,193,48,154,220,146,94,200,215,52,139,166,196,59,182,68,227,151,41,189,106,49,148,144,151,0,18,4,47,216,142,116,155,84,156,64,215,128,45,39,70,89,40,84,18,130,232,198,85,197,22,209,182,166,50,243,243,9,187,144,114,182,82,190,150,242,163,175,207,165,195,227,82,182,225,233,121,169,252,46,213,248,109,255,75,42,202,149,244,86,64,19,82,156,3,118,245,194,90,119,225,0,174,45,79,137,139,211,235,84,108,221,74,24,196,14,252,244,182,184,143,175,153,199,93,125,205,204,69,100,107,110,1,215,23,39,132,41,19,85,82,170,242,193,58,251,66,107,92,130,69,252,193,91,68,135,232,120,175,232,224,3,43,171,62,243,165,36,68,67,200,197,186,92,164,28,72,75,107,174,45,118,165,168,177,25,128,38,62,74,56,34,191,233,184,49,38,30,191,177,192,142,26,214,210,186,101,157,119,213,9,43,199,253,168,142,205,150,107,121,25,21,65,254,156,140,20,47,241,49,141,93,53,200,72,77,117,43,241,133,250,170,138,181,77,90,215,85,42,177,161,150,251,85,14,149,170,220,190,178,170,107,169,215,158,125,91,202,55,81,71,31,61,242,171,155,142,43,152,30,213,88,213,58,86,156,87,144,79,109,237,84,228,116,123,61,107,213,63,104,159,172,234,40,189,129,136,94,78,86,251,96,114,250,79,207,242,69,9,211,90,100,18,84,187,243,91,62,220,210,9,110,213,25,4,31,170,216,73,88,35,125,79,236,165,59,212,208,185,3,193,40,171,57,13,175,54,164,155,246,20,101,222,32,58,87,96,24,51,44,55,42,205,158,134,2,211,99,106,13,15,24,89,219,105,155,106,235,16,3,234,204,189,114,212,139,168,121,212,198,62,180,173,39,139,85,171,214,159,165,105,254,95,212,179,5,52,69,89,252,219,239,195,111,84,15,166,204,154,161,8,202,1,241,163,158,205,144,135,102,71,11,136,111,117,64,175,198,49,248,121,211,140,60,157,12,149,11,153,36,25,181,252,137,134,219,84,171,97,157,11,107,94,189,35,142,134,152,205,174,112,6,42,178,198,189,61,114,52,12,216,136,71,156,218,169,74,144,172,237,181,208,184,210,247,240,92,32,109,111,206,123,193,177,252,182,163,129,46,175,30,212,217,160,185,163,205,56,28,112,47,230,43,205,69,52,205,24,246,112,236,35,44,65,57,49,123,144,72,107,220,101,184,116,63,119,50,109,187,111,154,172,87,218,200,100,17,225,7,33,51,124,252,33,236,123,231,59,96,199,6,144,119,34,75,147,211,120,245,195,28,219,107,59,28,55,4,74,218,130,211,213,193,177,188,147,192,95,63,160,86,112,209,239,102,125,42,232,160,100,199,195,161,165,30,144,156,125,235,36,174,138,134,180,197,112,248,84,8,254,99,75,20,104,229,72,97,184,81,120,173,7,217,90,155,238,13,154,6,215,198,165,193,111,145,218,186,42,184,200,72,33,73,97,40,73,245,42,146,167,135,37,52,121,89,122,81,219,38,157,46,125,72,173,153,131,55,235,55,237,116,153,230,174,214,18,176,228,140,137,52,40,78,18,92,59,125,13,25,30,105,188,144,30,56,185,242,81,69,254,164,34,63,44,42,62,20,91,230,194,87,31,86,81,86,235,113,98,213,222,146,11,29,118,199,131,144,136,184,167,66,175,10,151,64,83,47,91,12,192,149,101,76,98,10,151,175,200,26,252,101,108,167,78,51,128,58,158,235,37,226,128,142,36,189,152,118,240,64,180,60,5,101,155,120,125,205,2,27,178,31,150,207,198,92,7,113,236,68,164,250,128,79,39,205,166,179,55,223,246,43,110,180,77,113,130,51,178,83,226,8,98,110,152,216,160,68,25,134,224,230,93,34,109,120,228,180,101,132,114,241,137,239,138,2,117,20,51,78,151,100,231,10,67,161,70,144,76,98,247,101,21,62,61,190,19,213,87,143,239,120,225,213,39,14,252,235,89,20,227,74,135,164,115,91,74,210,202,127,251,155,88,94,143,94,52,228,23,78,247,172,82,107,24,74,22,83,1,65,253,50,136,251,54,158,13,74,82,99,243,128,52,25,151,0,163,121,67,240,75,192,148,31,42,176,93,223,81,40,108,176,69,74,121,151,198,185,172,13,162,42,106,34,226,55,235,113,199,217,33,67,18,6,218,42,218,235,40,162,119,186,176,169,70,190,13,87,54,25,117,160,18,43,206,185,225,160,17,39,132,249,194,194,136,74,215,54,183,158,193,138,83,11,6,45,63,137,178,188,104,180,139,253,41,29,168,170,241,81,250,244,89,34,190,206,159,166,140,153,245,126,53,252,135,225,53,83,229,23,83,198,34,23,191,158,241,195,127,42,107,41,92,228,21,100,29,149,142,233,247,42,38,83,231,141,249,109,121,150,182,132,21,191,86,237,132,148,131,244,170,93,151,238,235,112,85,141,24,108,70,50,112,180,17,115,36,76,199,75,18,3,182,87,68,69,76,133,235,197,207,103,111,46,187,92,149,227,82,182,20,102,144,241,219,213,14,139,236,182,37,46,249,242,8,100,130,164,185,144,163,241,42,248,240,14,195,232,74,198,173,232,62,15,84,16,131,195,217,158,248,64,131,85,236,223,196,44,198,198,40,141,67,152,143,72,97,161,121,255,42,99,215,30,246,103,123,90,27,97,116,165,109,136,121,115,163,105,151,6,198,128,44,37,177,145,194,110,60,133,124,134,194,244,186,59,15,97,209,125,14,147,24,223,64,84,224,121,222,29,99,170,75,252,123,153,23,209,228,150,255,84,39,79,122,92,49,125,46,229,22,88,24,142,155,238,126,160,215,1,56,124,124,71,163,113,247,46,22,81,146,224,140,252,88,177,102,8,23,24,6,179,238,51,184,238,62,99,33,59,70,241,18,119,159,239,238,6,208,183,154,201,23,40,49,0,70,163,123,144,162,47,249,50,56,163,166,244,122,189,195,62,169,107,204,164,31,70,87,26,24,245,159,218,15,170,194,80,102,88,90,217,170,117,189,207,170,242,38,30,223,201,184,189,234,224,69,199,169,170,117,159,143,186,7,176,232,30,192,104,218,205,112,216,221,219,221,133,81,154,133,56,227,255,208,220,131,221,93,6,106,242,227,135,221,93,129,37,53,72,193,207,85,170,177,226,165,54,230,149,5,92,128,195,17,13,195,110,44,103,154,28,199,209,248,243,240,241,93,137,214,86,70,65,21,243,229,41,137,249,178,39,38,183,191,187,11,179,244,10,103,3,158,241,84,77,133,160,185,156,226,143,98,190,249,28,38,233,120,153,15,210,101,17,71,9,9,25,147,96,158,69,2,63,117,247,245,31,164,42,9,29,163,13,198,68,200,119,184,200,110,13,156,98,211,172,64,171,79,43,185,188,50,98,242,151,92,94,247,226,105,131,89,121,141,155,7,106,90,127,228,211,12,227,196,49,118,150,47,71,207,126,54,142,255,196,65,241,244,120,43,164,199,125,52,4,24,14,123,149,83,19,84,251,168,219,133,75,52,202,161,219,149,148,172,81,56,163,91,99,150,146,217,178,225,143,212,60,208,45,65,78,131,11,30,38,72,86,232,206,71,221,197,13,163,54,193,51,127,180,121,166,131,98,116,154,97,18,77,15,89,94,10,83,190,178,42,179,222,31,223,125,162,129,147,22,55,221,61,136,18,74,6,101,186,23,115,162,20,97,69,125,202,231,86,195,4,51,74,89,0,50,180,58,183,129,25,163,115,148,167,145,180,68,199,68,8,60,19,168,32,69,130,179,214,64,214,42,50,148,228,11,68,15,235,204,0,85,140,79,168,188,31,20,239,208,22,237,169,171,139,213,39,19,144,47,173,18,20,115,148,136,227,87,159,75,50,110,158,117,247,137,72,211,240,75,36,142,194,199,198,179,19,70,23,37,198,2,107,162,72,28,37,159,209,148,174,2,137,98,247,213,33,137,61,190,63,43,154,188,142,146,207,109,80,228,53,131,11,240,32,141,141,216,113,216,79,80,131,122,35,153,186,31,157,190,178,248,188,156,147,11,123,9,39,5,30,141,177,52,155,67,75,57,144,45,145,237,199,57,190,22,45,242,167,91,202,192,176,248,242,143,140,147,90,170,138,129,170,129,221,4,81,211,246,13,53,77,104,105,57,158,71,68,83,115,84,241,160,84,222,118,73,83,181,227,209,177,190,146,52,155,163,216,217,19,144,221,190,121,134,181,234,59,143,158,196,62,127,219,53,144,146,222,43,242,103,251,142,220,199,119,12,230,54,83,0,131,175,88,103,111,174,194,97,148,147,16,180,225,240,241,157,249,98,131,237,24,197,139,123,156,213,185,186,185,66,89,132,146,98,24,44,178,104,142,178,91,23,225,71,227,52,25,6,111,227,37,101,201,229,18,46,224,155,136,232,128,94,191,132,146,6,77,201,92,7,86,211,184,45,101,156,46,1,202,240,74,131,146,154,37,187,176,105,65,110,253,200,46,207,181,253,115,162,219,225,236,169,129,175,241,212,164,6,178,111,57,8,94,154,115,57,236,207,158,58,27,155,144,57,166,9,187,125,42,49,134,253,92,185,177,189,98,103,137,147,16,166,104,65,250,118,86,43,87,236,238,85,22,5,56,140,209,8,199,149,159,213,254,57,78,199,159,181,61,131,43,238,37,145,13,243,81,119,223,45,109,160,2,181,68,58,23,14,105,21,3,45,113,144,155,220,226,32,243,184,187,87,221,55,237,191,51,71,55,13,14,54,249,54,227,17,53,13,213,128,179,79,225,89,83,128,58,171,214,180,77,188,42,216,4,235,166,146,80,241,232,32,94,149,168,185,123,248,248,78,187,155,238,226,24,34,165,9,243,39,147,200,169,249,152,213,213,155,163,27,198,164,134,149,96,109,198,174,235,238,132,60,144,33,54,180,251,165,125,16,211,49,244,189,108,139,109,171,208,137,234,160,181,136,209,24,207,210,56,196,217,48,56,165,202,92,217,252,87,215,64,134,255,179,140,50,28,86,22,41,113,72,145,74,103,3,198,199,111,147,152,153,95,50,15,100,241,240,84,189,215,37,206,210,95,1,221,50,3,69,51,229,134,168,29,233,134,232,65,104,55,74,134,65,45,112,231,232,102,24,16,7,242,111,148,134,115,221,63,254,59,249,234,169,142,124,133,91,189,136,36,243,240,20,92,239,167,223,173,247,209,175,109,123,254,85,8,116,95,198,176,136,218,49,134,69,244,80,140,161,126,69,26,120,198,218,235,245,53,51,147,133,117,217,228,59,63,209,83,173,58,128,179,8,197,240,54,205,170,41,165,153,210,152,69,189,145,132,242,69,59,18,202,23,15,65,66,95,9,34,215,173,138,36,82,253,73,91,234,199,88,203,80,59,36,128,37,61,73,101,143,16,164,11,122,192,37,0,75,190,174,94,242,127,15,251,236,235,203,242,62,93,165,210,145,171,74,135,125,182,232,127,37,98,249,25,45,67,120,135,138,234,221,240,198,72,101,84,43,145,202,164,50,202,254,234,164,162,222,106,246,32,20,226,21,84,77,40,228,43,33,20,250,239,119,66,113,167,90,45,21,101,81,113,251,240,84,178,112,30,163,138,228,208,201,110,255,234,84,34,30,35,247,160,145,247,252,174,25,93,171,15,214,171,125,174,228,164,37,250,47,33,38,218,204,119,106,170,72,117,176,253,21,103,212,156,22,147,137,187,173,56,98,242,77,116,101,58,60,84,204,104,29,68,46,25,92,231,81,210,157,117,223,31,236,47,110,62,172,55,109,182,0,213,46,92,227,101,150,167,89,119,145,70,21,102,51,163,177,166,205,32,200,13,161,140,162,208,80,58,10,135,65,133,115,128,74,140,79,53,22,227,247,116,13,102,53,173,223,61,27,252,170,99,191,170,233,78,78,79,207,186,100,132,36,245,40,63,29,200,91,204,61,43,118,68,117,90,213,208,59,75,28,7,102,228,17,173,238,129,105,65,151,30,97,54,122,182,220,86,214,108,252,88,50,206,83,230,113,119,223,36,240,224,229,191,112,94,101,196,212,90,105,164,209,90,14,86,253,177,238,147,109,176,18,246,103,98,178,18,94,61,79,97,94,212,217,174,156,30,28,42,49,218,97,133,170,193,108,91,102,45,183,229,106,60,80,142,117,7,140,39,25,78,149,204,85,11,221,82,79,45,205,144,40,93,238,164,159,83,69,7,213,203,193,70,88,185,28,46,103,23,237,187,23,208,114,106,108,172,6,90,105,238,163,169,194,126,10,135,146,3,173,156,56,45,247,195,58,19,39,111,12,174,53,237,74,68,60,236,19,99,171,203,194,239,168,160,220,221,100,49,229,193,145,19,167,141,24,55,248,91,212,123,22,19,8,77,226,244,186,59,139,194,16,39,68,62,219,142,109,180,65,246,64,173,32,251,40,233,114,241,24,70,228,198,114,247,86,252,33,80,12,104,133,238,36,186,193,21,246,235,130,188,8,170,13,146,31,199,86,144,222,97,145,85,162,215,227,187,203,217,234,229,121,218,115,152,249,237,66,104,142,155,75,25,214,161,230,226,246,105,180,71,7,236,188,233,117,148,120,140,198,86,124,154,107,28,177,55,197,42,11,30,246,221,208,36,15,59,98,20,186,151,139,60,186,90,194,169,170,229,175,88,69,229,32,83,163,120,59,46,169,186,61,41,212,216,178,202,111,0,159,241,45,113,106,33,109,53,111,95,30,223,85,69,21,165,62,108,82,134,146,16,55,65,208,176,141,178,189,250,172,72,164,108,122,117,109,228,197,109,76,84,49,170,226,13,128,235,120,47,214,84,36,139,234,195,94,128,210,115,162,254,15,117,214,180,90,175,74,240,85,129,191,193,94,29,20,232,83,159,245,19,243,24,124,131,102,252,248,14,107,193,248,212,178,55,168,100,46,31,187,138,81,250,168,222,44,249,185,88,168,228,225,108,161,146,216,145,90,161,31,155,116,79,150,74,103,3,86,8,56,191,86,238,231,146,161,82,105,163,182,207,111,27,212,110,212,124,192,212,160,3,147,212,180,230,234,217,242,239,184,173,37,95,107,163,74,62,14,9,42,185,209,187,222,61,65,165,13,225,119,163,219,130,86,214,195,129,65,165,111,3,227,235,161,253,29,229,27,147,143,169,93,37,55,202,215,27,222,85,218,28,202,175,109,144,215,154,185,143,105,94,165,175,156,76,62,9,53,152,44,18,9,100,244,23,32,151,70,83,134,74,62,86,114,149,220,216,95,111,51,87,105,51,216,191,30,190,145,189,182,151,148,104,198,57,88,223,90,174,146,180,155,123,150,175,48,117,180,183,175,171,212,120,4,10,30,198,15,163,108,107,188,171,55,57,171,228,198,187,122,3,180,74,127,70,188,107,99,122,86,73,26,161,239,135,117,237,141,213,42,125,5,88,87,111,194,85,169,66,214,215,26,116,85,250,35,177,238,1,16,206,223,138,171,82,123,123,174,74,27,179,236,170,180,97,212,107,163,123,52,61,208,177,114,95,255,180,83,40,24,95,221,75,29,141,237,172,64,233,68,226,233,14,251,126,166,153,254,36,122,81,219,109,132,175,89,150,37,79,187,43,75,202,250,106,114,151,70,11,44,75,27,101,46,15,108,227,100,105,35,202,252,87,178,210,106,241,194,86,171,38,238,125,62,216,226,108,106,33,30,158,23,84,70,195,177,211,195,115,133,6,131,169,158,52,59,3,222,54,223,246,170,79,184,151,23,233,226,109,150,46,208,148,94,139,238,104,97,116,235,147,120,239,168,99,62,217,86,159,86,173,24,128,22,80,228,185,125,205,159,100,254,228,135,89,126,194,189,198,200,171,167,38,59,183,81,246,43,95,66,245,44,145,111,157,181,214,143,59,38,216,81,26,54,186,122,181,190,9,122,242,95,191,13,178,253,175,28,15,244,71,164,30,154,156,165,168,208,208,129,230,253,68,28,3,179,58,199,64,149,252,112,130,204,232,47,70,209,250,83,162,15,189,146,36,78,149,181,144,36,107,163,100,125,66,231,179,89,178,94,95,137,168,114,153,128,74,110,225,220,218,29,246,169,31,133,203,251,135,58,204,248,69,169,40,121,41,60,226,145,81,215,138,65,81,56,61,126,106,252,229,92,241,90,120,184,9,39,36,236,192,45,70,124,189,74,93,139,6,166,60,193,5,121,237,128,62,130,34,157,71,202,175,154,85,173,235,70,194,186,144,212,225,128,166,113,98,7,165,5,160,217,34,232,203,14,92,146,96,176,149,109,201,54,84,228,89,43,80,140,17,40,182,106,106,53,62,150,238,96,49,208,20,48,6,220,65,99,200,8,171,138,59,194,198,208,117,115,6,141,33,201,39,218,110,85,103,62,193,99,192,35,128,12,212,240,32,17,47,229,156,133,76,45,167,10,167,42,55,161,130,17,82,134,0,166,34,152,12,24,1,101,104,201,18,41,67,37,57,131,8,225,82,185,168,86,96,23,210,1,15,238,82,81,165,93,128,154,86,32,246,140,92,83,73,63,141,75,4,20,152,62,152,86,35,14,248,110,237,176,225,102,54,56,36,227,51,35,122,165,100,47,228,158,121,131,138,211,36,194,58,50,202,57,157,87,28,205,163,66,4,146,174,98,20,44,113,118,81,167,178,14,214,155,177,228,164,15,52,229,42,206,8,93,141,153,172,24,68,26,218,202,240,28,69,9,9,254,235,5,171,74,169,82,17,69,9,44,161,57,205,162,16,200,255,186,227,52,206,187,207,26,226,34,185,227,172,25,223,155,46,227,108,248,58,78,211,234,52,132,68,218,80,240,133,141,133,69,106,240,143,108,186,146,224,117,134,231,235,187,231,229,179,167,93,221,99,207,209,212,107,234,165,19,88,235,41,190,134,56,20,247,244,202,91,251,218,84,61,12,140,56,7,242,73,186,250,58,141,193,13,106,143,28,107,175,158,124,123,68,250,14,79,163,156,104,232,30,209,142,254,0,18,104,240,235,179,73,160,193,145,239,126,36,240,37,80,88,46,135,71,208,159,191,14,146,254,162,191,73,120,79,12,245,48,190,51,212,155,180,67,189,201,55,135,122,77,102,12,206,230,127,249,237,252,248,242,236,205,249,199,99,162,87,249,88,211,29,86,116,207,19,81,95,243,121,67,67,245,29,213,90,213,155,173,233,127,50,218,58,41,61,134,233,24,243,38,233,42,108,96,252,54,97,133,149,187,80,150,190,66,202,50,78,62,36,131,208,222,65,53,178,246,235,70,232,73,164,39,71,151,71,31,47,255,245,246,59,129,254,233,8,148,63,137,250,101,118,82,206,119,86,187,206,55,86,27,218,242,9,92,247,229,182,92,62,254,245,140,61,181,228,78,15,202,156,74,126,243,94,176,47,185,201,123,213,250,18,218,45,71,229,239,74,45,80,11,22,10,71,40,169,219,134,254,49,20,16,142,90,10,232,209,67,211,64,208,96,56,204,11,188,24,6,40,105,112,147,253,18,40,46,86,245,225,112,188,50,216,75,173,95,82,83,160,24,95,239,166,7,136,17,195,176,46,29,183,138,255,66,49,47,29,183,8,255,178,6,238,125,141,65,85,26,217,82,163,144,127,135,201,229,11,32,219,105,10,3,72,147,248,246,161,101,245,186,17,91,54,19,152,197,199,63,195,47,56,75,77,120,150,58,75,40,60,124,120,150,250,5,106,112,131,106,246,146,240,5,96,83,160,150,135,13,213,210,16,200,181,206,147,175,49,78,77,93,88,33,119,208,22,87,132,22,16,70,95,102,124,172,138,209,2,247,137,211,82,25,37,133,116,86,49,189,53,131,183,56,91,171,4,97,187,168,46,80,31,217,5,124,163,187,232,5,235,35,188,104,37,237,131,113,191,90,198,73,165,95,21,121,0,227,87,156,235,208,126,133,223,46,71,113,148,207,252,10,55,197,133,129,6,71,167,154,248,48,176,177,24,49,224,112,112,98,254,53,13,231,30,29,98,2,222,161,134,224,51,207,200,49,108,212,25,143,17,35,107,86,188,120,163,215,105,118,152,127,136,120,42,224,229,61,167,205,164,41,182,10,120,120,207,195,166,110,211,128,238,59,127,46,135,72,159,245,22,191,26,27,104,227,71,15,237,238,93,192,26,177,87,160,109,252,21,40,223,226,243,177,237,234,201,121,211,166,165,218,171,210,166,162,177,192,131,94,13,4,191,107,34,224,225,188,13,212,215,37,241,2,250,119,218,208,210,250,180,225,25,188,5,42,104,195,51,122,11,108,156,54,190,53,124,110,4,212,159,28,159,91,220,187,6,95,51,176,158,92,200,217,96,22,214,211,183,132,156,254,215,162,239,97,71,214,211,250,38,43,61,85,152,175,90,181,65,159,115,167,214,174,118,93,123,154,198,244,228,63,57,175,155,226,208,50,80,129,47,115,113,47,240,36,74,194,150,247,238,217,178,210,63,37,47,232,77,188,218,216,126,213,123,191,247,225,59,131,107,207,224,154,236,241,122,114,113,184,38,251,188,158,190,37,22,103,24,241,13,150,46,13,249,222,45,149,171,215,26,253,245,180,6,167,109,231,12,160,167,239,92,182,54,125,13,92,86,91,220,13,112,216,5,202,114,124,150,20,244,116,164,23,22,245,174,239,34,125,103,182,107,238,142,218,132,249,3,95,151,4,61,185,24,244,31,198,159,215,115,95,48,90,88,203,149,65,79,223,208,30,237,19,59,153,235,21,141,81,255,224,207,79,93,117,134,110,111,99,181,209,98,59,122,93,47,206,10,75,190,6,109,61,149,194,235,120,26,184,245,180,89,234,253,178,209,118,88,242,164,39,88,127,61,219,114,96,95,167,24,51,57,245,228,6,55,25,51,109,122,45,125,220,104,204,228,233,84,99,38,77,101,126,180,62,34,75,166,189,191,251,0,106,189,55,146,53,56,227,232,169,197,41,92,58,246,226,150,76,33,27,193,75,216,245,26,193,43,248,244,70,122,116,116,254,247,255,115,97,18,142,86,219,126,76,119,0,129,108,192,7,152,3,8,78,175,112,118,75,31,150,173,125,236,0,254,252,226,170,69,244,15,112,61,255,128,174,168,21,147,70,220,81,38,202,214,106,142,71,92,36,239,80,42,208,106,243,233,25,36,9,90,134,85,129,123,1,151,133,49,18,128,93,23,154,213,81,138,30,8,150,222,33,139,160,53,52,253,248,212,23,68,253,86,2,73,5,35,34,107,122,111,66,217,72,196,33,104,181,180,158,145,135,224,139,146,9,227,65,44,66,208,70,0,123,191,0,64,208,10,162,222,129,128,160,61,177,220,95,168,213,249,203,64,45,61,86,130,190,50,72,16,84,7,10,130,106,109,166,234,97,177,218,50,106,216,46,102,65,221,219,94,71,201,103,68,95,166,74,138,44,141,137,163,27,253,27,39,69,201,221,205,223,209,109,209,125,94,146,255,118,0,33,17,63,72,143,24,82,174,5,252,153,52,57,208,11,92,16,206,98,223,128,102,209,114,236,76,109,192,76,55,185,117,118,97,64,226,221,50,198,57,92,176,103,186,156,46,127,85,87,24,170,98,162,112,247,95,22,17,197,232,166,42,8,133,5,105,238,85,4,139,238,129,6,239,42,247,193,218,61,185,29,254,169,54,76,203,166,60,154,169,207,218,149,156,115,141,11,115,229,72,26,184,166,210,71,159,242,93,72,189,179,234,60,44,59,171,10,79,46,159,39,31,59,141,1,225,250,125,26,227,38,193,215,144,45,99,12,113,58,141,198,48,195,89,53,19,172,140,225,86,31,70,135,64,181,146,9,121,188,110,216,136,69,124,71,167,81,186,160,254,106,204,209,170,11,15,226,167,98,79,56,106,136,158,82,3,85,119,80,150,231,44,40,75,195,93,160,181,95,156,166,244,126,145,46,179,49,230,220,168,113,203,169,87,57,167,62,166,62,21,142,211,132,232,77,228,117,64,159,226,151,244,113,218,86,67,226,85,252,135,116,52,246,24,143,207,173,1,31,68,209,150,208,92,182,234,174,207,83,136,57,71,205,40,227,30,167,201,36,154,46,51,28,194,45,46,122,245,131,106,245,169,94,50,187,133,10,23,94,39,120,129,147,16,39,227,232,33,69,139,163,179,135,22,48,22,33,238,55,68,71,170,191,252,119,56,59,240,22,54,236,86,95,237,45,2,157,96,171,3,166,28,246,103,7,53,67,106,180,213,223,227,161,113,122,4,155,46,139,56,74,200,169,73,130,245,83,217,253,118,71,180,181,132,108,24,122,131,224,37,123,195,18,114,6,161,144,243,143,102,147,172,215,203,159,44,241,247,63,189,77,211,182,49,90,190,187,247,82,251,219,207,108,92,215,85,205,78,169,201,24,220,120,251,233,75,33,182,193,246,191,35,182,3,177,217,171,237,223,17,155,143,96,125,196,94,83,22,54,102,150,119,170,242,2,22,21,155,228,152,18,80,18,242,51,54,96,225,78,115,77,100,26,122,162,22,4,87,224,101,97,32,40,185,14,181,40,200,89,245,168,123,0,165,235,137,76,104,241,230,212,176,156,113,86,235,247,0,209,4,58,84,3,201,230,157,224,40,195,112,155,46,33,95,242,63,174,81,82,64,145,18,243,203,24,101,33,160,56,230,39,249,249,171,96,123,187,180,159,152,224,98,60,99,116,126,76,213,26,59,144,180,62,48,99,247,32,163,172,230,120,156,38,161,21,103,149,197,86,61,142,211,28,219,193,85,141,88,176,23,232,42,74,180,55,40,244,21,179,78,63,141,235,72,13,128,35,199,232,250,172,86,190,253,3,196,41,34,177,85,43,190,178,121,17,228,49,167,165,143,155,162,214,49,87,18,105,116,110,215,28,52,4,149,127,126,122,177,181,218,218,194,55,244,90,110,136,39,104,25,75,46,252,98,235,255,0,43,3,174,78,89,5,1,0,0};
 
-static const unsigned char v7[] = {31,139,8,0,0,0,0,0,0,3,237,60,107,115,219,70,146,223,245,43,198,40,93,10,172,21,65,73,86,178,41,89,84,42,145,179,187,222,74,28,95,228,220,126,112,185,206,32,49,36,16,227,193,3,6,162,120,90,254,247,237,158,7,48,47,64,180,227,60,238,106,89,187,49,48,143,158,238,158,126,207,64,65,219,80,210,176,58,91,178,224,217,81,86,108,170,154,145,7,146,158,144,148,21,249,9,129,238,91,22,51,202,159,190,93,173,232,146,241,199,239,105,81,145,61,89,213,85,65,130,40,154,193,255,22,109,153,228,52,250,185,209,1,189,88,86,101,115,66,190,105,25,171,202,19,114,19,215,137,62,237,166,130,129,37,45,89,35,230,29,173,218,114,201,178,170,36,127,171,10,26,78,200,195,17,33,8,130,145,55,73,214,108,242,120,135,32,0,98,67,217,115,173,225,45,153,119,184,134,111,222,78,158,105,243,232,93,182,164,114,138,120,30,25,221,208,184,94,166,255,217,210,122,199,103,220,246,239,198,172,32,208,103,101,205,215,73,146,149,107,196,133,79,123,161,53,24,243,86,113,222,80,125,234,182,193,142,86,224,247,15,249,98,46,5,148,195,224,18,120,79,19,99,217,146,110,113,129,155,170,92,101,107,14,224,165,222,98,64,65,78,18,194,46,73,16,156,240,199,36,235,159,153,246,156,118,207,123,88,11,254,153,205,8,16,67,242,42,70,138,72,92,38,132,214,117,85,131,220,0,224,70,231,194,119,98,140,100,129,124,51,208,96,117,107,144,143,80,191,69,104,124,206,119,234,109,148,215,183,241,93,191,136,120,25,231,113,19,223,209,126,145,91,245,54,178,8,206,184,109,151,32,43,77,55,71,190,123,151,234,217,244,15,186,184,173,150,239,41,35,53,93,17,86,145,13,173,155,12,96,198,203,186,106,26,104,45,19,104,233,150,218,54,63,194,184,57,232,202,178,173,161,19,118,168,108,243,156,236,123,108,106,42,183,255,117,86,208,170,101,131,19,4,22,61,6,114,26,234,19,208,208,110,58,136,178,163,31,57,39,160,108,243,107,34,165,164,222,201,39,14,240,175,48,128,165,84,173,71,184,110,115,29,198,214,159,126,252,78,14,149,176,197,168,87,56,104,46,123,8,217,102,101,82,109,163,188,90,198,136,79,196,97,252,243,159,93,127,232,12,168,43,86,45,171,156,204,231,115,18,164,140,109,154,203,128,124,69,130,139,139,167,1,1,17,253,242,84,236,88,191,242,182,121,213,77,114,23,28,130,183,109,240,225,18,31,46,3,27,224,79,53,194,122,119,252,208,195,222,207,102,240,106,65,79,171,134,149,113,65,247,151,199,15,26,3,246,179,45,93,52,156,197,239,248,246,112,86,224,142,71,138,153,115,2,90,220,239,89,200,215,156,248,7,71,85,89,109,104,105,237,150,194,183,2,235,155,87,235,48,112,4,64,153,13,241,211,236,76,24,120,70,236,7,23,47,64,252,227,53,197,245,233,29,52,89,72,232,98,211,51,49,137,89,12,51,254,126,251,195,203,104,19,215,13,21,115,35,108,215,176,34,36,91,145,16,27,35,182,219,80,177,77,237,6,26,104,48,49,192,18,219,248,135,225,166,166,119,252,17,49,50,134,18,210,245,69,69,188,9,195,37,60,90,120,155,248,138,53,19,238,170,80,203,162,40,90,114,183,245,204,153,144,3,139,239,226,188,165,63,137,57,48,158,27,132,142,129,253,15,212,232,38,165,203,247,132,209,2,44,2,48,191,166,164,172,18,234,140,68,54,224,130,17,43,201,103,159,17,249,24,149,156,35,156,63,165,205,15,241,211,16,199,185,115,239,32,162,232,129,33,39,222,254,187,75,177,202,157,175,219,195,4,98,179,0,77,188,59,108,63,194,147,180,45,178,36,99,187,71,24,146,246,12,73,63,148,33,233,227,12,73,255,8,12,17,179,72,30,119,146,8,206,185,160,200,132,184,220,9,200,100,27,55,138,56,47,183,244,245,31,103,13,174,37,151,21,198,232,57,122,182,201,65,24,215,224,86,234,82,7,103,79,219,79,140,6,3,236,190,123,222,195,182,178,101,10,118,5,29,243,196,49,35,104,219,120,87,24,112,215,13,90,93,161,51,198,128,164,55,119,210,62,93,6,39,34,66,209,22,83,75,13,27,183,101,94,53,244,112,211,234,6,101,226,103,88,215,161,65,24,43,48,180,4,12,35,132,206,191,147,120,197,104,77,62,7,32,208,146,52,221,120,79,4,160,57,16,88,82,182,135,182,99,63,33,159,159,158,158,30,96,218,69,68,55,239,54,192,203,2,185,3,61,19,120,131,143,221,6,23,120,167,225,95,198,182,220,187,221,203,154,130,163,53,54,187,15,110,92,4,134,151,71,57,232,34,165,191,168,108,3,54,97,69,17,25,153,44,144,28,34,182,46,90,226,93,50,117,0,22,197,205,174,92,14,198,75,42,100,107,32,177,225,242,20,111,227,76,194,8,131,89,188,201,102,114,145,217,154,50,192,188,103,115,65,89,90,37,16,137,252,245,219,215,65,111,108,82,26,99,196,120,105,40,69,0,33,62,131,173,155,190,6,103,25,192,156,120,179,201,51,17,141,204,126,110,170,82,3,176,87,143,251,62,174,64,51,241,68,97,25,85,239,117,149,99,105,93,109,185,37,224,204,15,223,253,37,206,114,176,100,54,151,46,201,241,67,7,162,225,220,126,77,239,217,254,93,191,213,71,6,87,100,40,32,56,210,205,68,108,67,125,235,36,171,121,48,0,49,34,145,25,218,7,138,12,71,21,69,70,97,235,147,146,46,225,16,32,35,21,225,192,170,65,79,53,38,41,10,76,47,199,210,246,73,143,175,132,171,107,87,86,127,68,218,120,92,177,228,185,90,91,243,173,107,76,161,235,115,185,79,34,120,41,36,213,255,103,164,78,91,214,17,64,15,227,6,133,177,131,243,75,165,82,143,56,63,145,104,250,232,248,133,98,234,1,249,105,68,22,83,226,81,137,197,1,143,9,44,143,241,53,70,70,57,45,215,44,229,161,220,105,207,181,56,167,53,11,131,151,21,95,176,81,203,219,132,40,18,28,93,208,42,3,125,197,65,118,116,233,191,74,249,181,118,153,226,235,105,61,254,128,19,255,21,231,25,15,145,60,28,32,11,186,170,32,156,111,248,130,134,108,101,229,29,78,228,180,2,67,12,210,87,89,14,222,190,151,243,62,53,121,34,2,116,220,94,241,152,148,253,51,211,158,211,242,168,147,109,77,197,244,85,21,135,175,117,254,186,218,22,220,130,109,144,220,78,113,167,37,140,65,81,178,148,72,12,179,73,52,51,174,80,91,254,82,38,54,189,189,72,74,217,150,104,113,56,43,77,3,164,198,96,66,164,135,227,113,223,30,235,237,171,190,125,165,183,39,172,239,72,152,222,163,117,48,143,49,3,195,56,128,82,58,128,82,58,128,82,58,132,82,58,132,82,234,71,105,63,233,119,255,80,39,208,12,57,129,87,63,220,254,58,94,128,144,69,149,236,46,69,29,0,43,206,229,58,91,237,66,33,55,147,79,23,161,8,51,165,11,237,7,132,41,152,145,198,121,14,12,92,84,21,35,95,191,122,33,67,242,70,24,134,85,155,243,5,44,110,227,224,31,199,120,46,134,252,14,92,119,249,169,227,250,8,87,53,215,34,25,210,208,250,142,214,30,35,0,140,187,133,152,92,178,73,84,134,121,165,184,73,1,164,116,87,126,91,107,219,231,206,112,187,70,248,22,129,169,53,148,15,4,211,75,158,90,25,147,150,17,217,233,220,128,165,87,124,35,79,69,190,212,47,10,121,18,72,79,74,54,184,152,149,160,33,107,64,94,16,43,206,153,158,85,143,35,98,151,16,107,138,254,59,212,113,209,114,183,15,138,47,132,35,178,180,192,23,87,244,190,112,44,174,112,85,42,24,221,48,33,25,90,24,129,225,11,56,148,140,101,113,206,195,173,46,102,64,146,95,136,142,231,50,12,115,98,6,253,44,65,151,22,35,46,226,190,252,168,87,74,25,173,203,109,54,149,82,229,23,18,142,116,96,232,176,188,195,181,152,38,84,139,112,101,178,214,80,94,89,53,76,244,112,68,195,212,10,216,26,116,188,188,192,68,94,229,52,6,11,130,145,76,188,142,179,50,234,179,86,151,19,61,183,59,62,75,78,102,255,75,253,135,0,168,144,75,88,163,108,55,4,94,219,178,168,218,18,69,181,59,220,51,164,52,169,150,109,129,229,1,150,177,28,13,91,112,251,205,139,31,94,79,159,199,77,186,168,128,210,160,99,160,81,116,80,140,181,54,183,99,30,90,89,137,133,58,239,211,163,80,83,81,144,211,70,177,66,183,88,67,53,28,60,16,121,166,214,169,137,234,72,99,60,162,172,85,188,134,141,125,192,102,67,227,83,244,50,216,120,141,29,249,203,167,232,149,116,141,134,145,18,142,78,17,110,79,173,76,198,216,28,115,13,94,83,1,139,193,243,17,25,187,87,117,17,51,81,61,212,216,44,179,75,222,137,96,177,230,131,129,173,21,164,63,17,109,114,75,130,151,20,237,190,174,47,37,24,61,183,92,40,149,47,91,225,9,21,14,153,162,104,83,189,83,153,206,57,249,62,102,105,180,202,43,80,10,62,99,70,206,122,131,39,6,23,89,217,50,106,13,86,16,102,228,11,115,116,90,181,181,53,86,1,144,99,59,250,20,140,43,108,239,200,252,123,43,40,147,148,226,64,5,192,24,248,238,248,65,182,239,11,80,213,234,93,63,94,224,112,69,206,47,244,209,188,117,159,106,99,101,31,114,39,98,213,119,224,5,114,122,203,195,162,208,84,106,60,84,68,54,175,180,92,76,8,114,103,82,113,8,63,175,88,240,115,118,16,162,108,249,190,219,107,49,24,198,112,67,134,93,86,149,115,40,41,187,158,147,243,83,55,43,251,62,190,207,138,182,32,121,86,128,137,172,86,56,72,102,14,53,141,151,41,77,34,192,166,44,33,94,136,1,177,130,171,26,135,59,148,191,117,182,173,63,52,239,13,189,96,132,135,20,139,10,61,73,171,233,255,180,89,13,70,118,149,209,92,70,5,72,165,92,253,137,113,112,30,105,7,145,86,79,146,13,118,177,225,174,52,227,237,14,227,164,121,135,188,47,135,173,35,34,208,52,16,29,77,112,117,2,133,235,225,6,29,207,76,128,123,185,176,65,141,166,193,194,61,189,225,135,110,47,74,22,218,180,77,222,14,161,40,192,145,152,136,28,80,64,26,69,78,247,186,152,5,62,190,246,51,103,87,196,164,168,28,156,198,96,154,198,245,71,199,167,48,126,116,43,36,157,130,74,253,100,14,25,107,156,74,141,111,141,247,64,146,203,230,27,57,41,138,34,108,83,113,185,145,9,91,68,154,41,177,34,114,52,39,62,136,115,78,122,122,216,44,59,121,61,108,150,147,218,30,54,205,73,124,15,155,102,204,186,59,116,22,63,38,59,52,199,63,72,216,62,156,197,233,71,177,56,253,56,22,167,31,199,226,244,163,88,156,142,179,184,63,117,188,212,162,136,46,111,21,15,111,251,80,223,112,14,122,166,97,223,122,234,170,76,218,93,39,243,182,147,121,223,73,191,241,36,18,102,159,207,1,135,182,164,185,229,114,126,127,180,158,131,1,99,84,121,67,244,178,47,202,132,222,91,206,157,231,110,117,17,6,95,131,105,219,85,45,228,208,242,97,27,151,252,8,50,225,112,8,75,179,134,251,234,175,130,137,145,190,12,88,55,124,80,117,204,240,191,79,192,171,169,197,249,19,121,50,159,147,30,41,95,106,136,23,9,49,95,17,64,104,210,23,124,17,54,158,111,182,24,1,99,94,10,89,17,4,196,113,190,108,115,251,172,68,78,86,101,86,121,65,81,56,150,80,187,19,226,171,191,118,245,201,62,6,231,245,63,30,149,109,105,125,19,99,26,16,101,144,67,180,224,7,66,237,134,160,57,68,29,116,75,33,118,46,44,246,23,9,143,84,193,182,63,240,199,155,84,162,54,133,172,195,178,14,230,241,212,140,218,215,144,177,243,49,55,85,46,78,107,117,97,220,102,188,64,160,46,20,106,53,2,116,117,218,77,159,203,142,82,21,247,46,214,211,117,77,105,57,253,252,244,180,191,3,197,167,25,71,216,222,153,192,120,99,94,66,87,113,155,51,239,216,29,197,106,137,54,124,111,137,117,71,34,150,232,62,33,133,55,93,223,7,145,247,92,239,126,148,64,158,224,59,132,241,138,188,74,219,21,206,114,10,222,178,85,39,84,87,73,118,7,161,123,220,52,243,96,51,253,34,232,5,242,42,61,83,29,12,216,50,61,191,207,33,131,43,217,116,81,229,73,112,221,229,227,87,179,244,76,155,5,240,52,155,45,1,20,108,250,5,129,157,216,166,25,6,202,85,11,170,153,76,243,53,105,210,56,129,173,41,18,2,139,147,85,14,234,11,35,138,102,186,4,45,132,164,249,103,200,141,178,213,78,190,6,29,100,253,190,149,78,130,11,161,217,196,75,58,189,159,158,7,230,29,173,171,227,7,126,79,56,186,221,100,192,235,26,95,246,2,204,203,184,160,243,32,157,126,78,64,104,8,39,126,1,30,101,250,5,8,16,153,89,96,0,126,105,240,105,93,199,59,62,244,90,114,31,210,45,201,42,81,113,137,162,171,25,206,50,104,152,1,17,26,23,245,87,237,133,167,113,60,252,115,182,114,104,35,143,31,186,219,174,228,179,207,148,149,215,36,96,112,207,22,211,11,216,149,11,34,181,13,210,100,178,168,234,4,75,25,252,31,222,122,1,173,156,108,124,249,51,188,200,205,29,217,203,5,101,91,80,251,225,205,188,214,112,222,91,156,129,17,34,223,52,118,161,42,121,138,57,23,19,181,242,207,222,24,166,216,115,63,125,74,54,187,233,153,34,13,115,201,180,186,163,245,165,108,120,218,19,130,178,217,17,248,165,162,182,41,64,23,150,109,115,89,181,44,207,74,58,45,171,146,202,38,76,167,167,231,250,139,50,86,26,50,166,20,253,72,89,189,51,196,65,16,57,32,17,239,246,221,230,118,183,140,127,203,205,245,111,157,134,204,254,32,188,85,13,243,163,49,23,238,195,197,93,180,119,216,139,215,71,241,191,209,139,205,188,254,156,104,71,48,249,238,9,185,221,53,32,208,100,155,245,167,53,88,139,223,108,114,125,243,150,16,37,173,105,3,122,62,200,5,143,241,229,250,98,169,136,169,63,64,185,97,159,71,205,222,58,6,30,25,38,239,227,236,249,33,235,56,166,117,108,70,96,95,149,213,71,111,65,111,82,248,191,210,61,228,59,8,139,25,130,132,147,125,112,237,152,5,14,74,55,198,69,14,128,148,178,90,150,89,3,137,46,31,32,186,38,217,49,202,227,86,250,80,63,100,109,138,227,62,12,100,209,104,152,56,241,192,14,15,23,61,181,179,253,12,12,153,129,174,227,102,142,31,196,87,49,166,93,236,205,167,91,182,51,71,194,170,241,34,167,201,220,139,128,44,222,225,161,132,254,113,138,9,226,46,174,51,72,0,192,12,215,89,1,241,117,96,244,102,224,134,231,193,171,188,109,208,33,15,91,76,85,125,52,200,157,141,123,80,245,246,100,58,37,226,19,27,242,77,117,79,166,211,107,143,62,162,182,121,156,216,72,16,211,20,3,218,89,83,204,29,238,40,7,55,61,11,108,237,242,249,168,120,209,84,121,203,176,220,10,153,208,116,55,61,37,57,93,49,248,103,147,131,247,114,17,219,84,25,254,59,229,249,75,195,253,209,48,247,250,224,135,179,97,60,246,225,146,120,225,196,62,174,118,100,229,166,101,198,58,120,169,94,200,117,96,201,0,196,83,32,67,90,126,98,75,228,11,4,6,67,66,113,72,96,126,21,21,210,136,197,53,232,176,200,245,39,230,100,16,203,37,77,193,170,209,122,30,200,141,22,25,222,98,71,248,177,18,216,230,192,199,245,173,176,56,192,226,51,96,116,141,158,102,7,86,68,186,21,238,227,181,125,255,128,8,128,199,143,86,8,48,179,156,103,79,94,239,17,241,103,122,69,206,105,79,8,164,107,113,232,99,89,16,88,108,26,147,181,58,91,167,92,216,106,175,176,25,114,33,67,39,211,196,26,43,57,118,90,137,223,13,158,93,13,73,159,27,107,59,81,145,22,82,56,2,57,200,81,155,159,70,228,124,175,246,252,16,99,124,252,96,20,1,148,25,54,198,212,180,129,180,205,63,146,151,42,206,240,123,160,134,127,12,20,236,135,245,171,35,212,52,102,199,15,186,165,29,11,165,12,195,246,104,46,102,133,14,231,134,143,226,178,15,145,67,67,139,12,163,7,12,77,192,175,161,77,126,137,85,53,225,25,184,125,134,104,226,220,0,133,135,128,150,170,223,182,139,34,211,116,253,193,18,23,26,201,178,204,115,145,3,187,159,9,24,110,203,238,222,123,147,0,225,143,65,128,71,172,164,198,181,117,157,37,4,255,51,93,86,121,3,242,225,6,88,106,138,221,6,173,121,188,160,185,2,181,200,43,254,73,142,74,35,128,145,5,77,178,86,151,53,12,86,129,169,103,129,3,11,144,124,141,38,236,106,198,129,58,253,158,213,93,187,44,126,67,214,89,252,148,141,182,106,216,182,13,193,159,109,173,61,67,70,106,147,246,15,140,179,249,141,233,192,56,118,73,76,55,16,53,96,255,104,120,122,2,65,200,196,63,107,239,216,64,252,21,241,189,80,200,121,112,126,234,227,133,229,30,100,254,120,238,164,29,176,115,86,234,248,11,125,132,250,25,46,237,91,110,131,249,157,80,113,73,34,4,2,128,102,204,60,234,102,226,155,175,142,252,156,174,153,35,193,222,192,250,183,16,107,113,67,230,3,228,90,28,164,29,44,186,73,118,136,236,14,124,175,245,201,165,23,139,240,166,248,14,202,185,81,160,183,127,233,72,239,222,243,61,149,99,15,197,239,119,151,240,65,9,245,89,147,171,106,195,147,116,177,209,65,112,125,43,206,84,19,41,66,162,219,55,19,242,22,113,74,204,175,9,123,185,22,138,17,250,193,130,27,130,13,225,2,254,24,103,237,175,213,66,17,196,54,97,247,146,196,251,201,24,122,224,231,61,173,30,163,5,185,29,39,249,143,163,190,175,181,147,236,151,85,242,43,42,50,59,72,145,127,35,39,116,160,26,251,29,207,239,174,117,90,62,239,220,66,241,33,252,73,180,212,254,26,121,92,95,157,203,49,24,52,7,129,153,35,117,244,200,43,32,246,164,183,81,57,166,241,136,197,47,212,247,129,209,156,2,128,46,205,0,127,4,27,64,166,228,70,253,33,5,217,42,190,178,197,75,176,47,103,95,7,62,230,243,213,255,127,26,143,191,169,107,47,191,174,229,72,255,64,150,35,253,183,229,224,191,15,177,28,198,237,168,127,155,141,63,174,217,240,53,13,29,118,80,252,98,67,86,199,159,146,130,249,210,106,111,193,75,101,176,162,211,21,82,187,172,45,174,211,184,116,249,107,63,170,148,37,14,154,224,249,76,211,163,124,221,31,24,242,206,115,87,75,92,94,11,4,28,238,185,85,173,199,105,110,120,205,196,165,217,161,101,177,238,14,175,5,93,78,221,167,35,132,143,251,243,33,132,220,246,159,35,141,147,225,57,66,193,2,208,227,231,154,222,211,5,114,122,72,129,171,47,213,212,213,182,153,190,137,91,86,189,213,106,55,23,158,218,141,93,159,115,116,158,95,216,121,76,215,175,142,31,220,243,14,252,189,167,187,78,229,221,45,131,41,208,187,244,206,172,74,113,219,170,171,234,218,87,176,66,129,146,111,38,175,19,137,171,62,56,29,140,27,111,25,204,114,7,175,92,121,141,6,191,134,37,190,181,4,190,12,14,35,36,227,31,218,138,187,89,95,201,191,109,115,34,175,160,114,132,200,158,92,146,165,119,246,196,211,234,251,35,33,54,249,78,89,3,232,23,24,252,137,156,77,200,127,144,11,241,245,47,254,109,151,254,214,152,183,70,59,37,103,206,122,95,137,237,215,165,14,68,107,138,199,109,40,88,66,168,93,171,106,151,120,77,203,59,25,40,101,107,231,197,252,228,10,63,140,194,171,194,242,118,160,56,208,107,172,99,172,14,84,127,3,231,75,21,21,48,35,60,192,3,187,13,222,207,217,224,201,186,99,153,133,174,72,112,154,222,250,78,18,237,19,8,83,200,14,188,20,152,53,188,178,133,23,213,229,73,186,113,47,80,253,124,95,73,233,253,58,94,134,120,116,231,143,226,107,12,235,4,82,156,63,118,231,18,122,151,22,241,168,63,7,215,195,53,46,18,152,102,222,60,151,28,231,155,245,57,251,254,208,229,137,250,75,121,3,189,130,44,20,29,147,42,211,6,170,153,120,34,33,158,240,160,12,197,150,11,157,113,65,34,216,251,8,212,4,183,123,124,247,236,8,36,152,222,243,191,190,38,175,177,241,63,181,248,236,232,95,32,3,26,240,10,82,0,0,0};
+static const unsigned char v7[] = {31,139,8,0,0,0,0,0,0,3,237,60,107,115,219,56,146,223,253,43,58,44,223,20,85,35,82,178,226,100,114,178,229,41,143,147,217,205,86,94,23,39,51,117,229,114,37,16,9,137,156,240,161,37,64,203,58,71,255,253,170,241,32,1,62,100,37,147,153,217,187,90,125,176,41,160,209,104,52,26,141,126,81,78,201,40,48,94,196,1,119,78,14,226,116,149,23,28,238,32,26,66,196,211,100,8,37,163,151,156,112,42,158,158,45,22,52,224,226,241,37,77,115,216,194,162,200,83,112,124,127,228,251,163,121,153,133,9,245,127,99,38,162,231,65,158,177,33,252,84,114,158,103,67,184,32,69,104,14,187,200,211,85,158,209,140,51,57,238,96,52,130,215,43,238,197,25,204,227,140,20,27,224,52,161,41,229,197,6,88,57,95,21,57,207,131,60,25,2,163,20,10,94,126,72,9,227,180,240,35,88,228,5,240,136,194,162,32,41,133,132,108,242,146,31,224,228,28,126,189,252,240,211,243,87,231,111,255,251,195,155,183,175,223,189,190,120,253,2,102,224,164,121,56,47,153,63,143,51,255,230,200,57,81,176,239,223,60,61,127,247,236,195,207,111,207,95,62,251,240,203,249,139,247,207,46,97,6,71,146,178,167,132,19,224,155,21,5,239,12,174,214,113,200,35,64,74,55,156,178,161,232,253,37,166,107,40,40,9,105,113,61,132,36,230,60,161,64,179,48,38,153,154,64,224,252,240,246,217,249,211,103,111,17,245,221,1,192,209,20,174,142,134,224,134,55,67,200,7,48,59,131,240,198,95,82,254,62,206,248,19,55,31,192,131,217,12,198,215,195,3,128,73,15,232,115,9,41,96,30,222,131,78,0,29,79,225,106,210,141,232,232,177,155,15,129,23,37,149,160,143,122,64,17,95,19,246,241,20,174,142,187,209,62,156,216,160,63,236,15,250,164,7,20,41,104,194,254,231,23,192,30,141,123,128,127,78,114,210,134,62,250,34,104,220,170,39,125,208,143,143,77,232,173,146,47,26,228,33,5,162,101,255,134,36,37,101,74,164,227,140,231,64,224,37,89,65,190,128,12,1,51,108,247,206,36,220,193,162,204,2,30,231,25,132,2,205,47,98,240,207,56,214,157,151,139,5,45,134,192,130,136,166,100,32,132,78,138,99,120,3,51,200,232,186,146,94,5,59,56,169,64,20,21,18,236,37,89,185,162,47,94,224,202,124,148,253,23,52,91,242,8,78,225,33,124,254,108,201,218,88,138,110,199,161,146,52,0,20,148,151,69,166,230,64,188,219,106,222,32,47,51,14,51,91,216,142,20,211,16,52,161,28,242,197,130,81,132,122,136,45,168,4,92,108,142,97,6,227,19,136,225,84,161,249,238,59,13,250,61,76,224,84,96,173,105,63,129,248,251,239,53,73,114,118,193,224,153,226,24,18,224,218,66,47,144,41,98,4,53,80,77,48,131,137,108,24,141,224,215,152,71,121,201,133,106,18,40,133,250,192,111,5,101,72,190,161,180,2,146,101,57,135,57,133,21,41,24,13,5,14,228,243,3,49,242,243,103,120,96,105,143,43,108,246,249,245,0,230,5,37,159,78,12,234,165,114,26,10,85,116,13,51,232,28,119,82,77,80,177,70,234,180,51,155,59,22,126,185,83,62,163,220,21,104,50,57,137,148,114,129,166,205,14,129,85,111,110,99,199,183,7,181,224,254,61,79,169,107,74,231,85,24,179,85,66,54,120,109,48,84,250,252,169,209,128,11,211,247,147,123,117,109,136,236,85,72,111,226,128,170,33,242,121,7,52,163,164,8,162,255,42,105,177,17,35,46,235,239,214,40,199,49,71,197,236,60,12,227,108,137,180,136,97,207,141,6,107,220,130,36,140,154,67,215,12,59,74,73,223,175,234,139,61,85,24,179,32,207,50,26,112,26,90,211,102,116,141,19,92,228,217,34,94,10,4,175,204,22,11,139,20,104,62,5,199,25,138,199,48,174,159,185,241,28,85,207,219,193,201,193,129,16,221,243,48,132,36,39,184,34,32,89,8,180,40,242,2,24,34,102,38,23,94,72,24,197,2,245,205,34,163,58,177,106,12,98,125,134,216,196,152,23,250,219,78,94,95,146,155,122,18,249,101,55,143,25,185,161,245,36,151,250,219,142,73,112,196,101,25,4,148,177,106,140,250,222,57,85,205,166,95,233,252,50,15,62,81,14,5,93,0,207,97,69,11,22,51,14,36,40,114,198,160,160,89,72,139,154,107,107,246,150,46,240,242,135,160,44,10,154,241,41,100,101,146,192,182,166,166,160,106,251,223,197,41,205,75,190,99,192,104,4,175,80,65,196,33,94,6,119,217,16,248,22,80,151,148,89,64,67,152,111,132,142,97,180,184,161,133,80,145,234,122,17,90,167,38,74,170,186,246,60,90,235,227,100,114,182,122,185,138,70,60,188,140,242,114,101,40,111,209,81,67,206,192,21,119,160,18,201,98,163,158,4,194,191,81,169,33,213,164,32,140,71,97,36,98,235,251,183,47,20,168,194,45,161,222,32,208,76,245,0,172,227,44,204,215,126,146,7,4,233,241,5,142,207,159,171,126,183,5,160,140,73,152,205,102,224,68,156,175,216,212,129,31,193,57,62,126,232,192,20,156,39,99,71,169,178,122,223,222,84,131,218,19,246,225,91,51,124,152,226,195,212,105,34,124,95,32,174,143,135,119,53,238,237,104,116,120,215,196,30,229,140,227,125,191,157,30,222,25,12,216,142,214,116,206,4,139,63,138,237,17,172,64,241,242,53,51,229,197,93,237,132,43,230,28,194,85,219,44,190,174,150,107,97,240,165,188,188,195,155,107,6,14,41,10,178,145,86,130,211,61,165,159,103,249,138,102,141,61,215,171,206,19,234,39,249,210,117,90,98,164,53,157,252,24,170,209,117,58,32,182,189,147,167,148,49,178,68,98,93,122,67,51,222,32,194,20,62,252,160,193,80,27,57,101,146,156,24,157,120,61,10,36,126,136,214,127,156,49,78,178,128,230,11,56,71,62,252,36,173,37,11,31,212,216,218,166,88,141,107,88,159,56,77,251,192,156,121,11,52,97,180,129,89,89,109,72,202,12,254,113,249,250,149,47,108,5,3,173,133,67,217,105,132,19,95,24,30,66,52,229,180,14,218,68,98,13,126,204,196,127,9,135,183,58,27,52,87,4,109,98,13,139,176,1,10,80,99,242,83,178,114,133,169,32,118,65,218,30,113,56,132,59,200,166,160,77,8,174,30,57,108,175,7,13,108,141,5,141,70,224,176,140,172,88,148,115,7,242,76,11,207,16,117,69,6,121,70,193,41,87,33,222,82,142,50,172,86,180,0,105,17,0,11,72,54,108,225,147,240,14,4,164,40,98,202,128,0,139,179,101,66,149,101,109,130,171,93,65,182,182,248,90,81,133,102,176,221,167,41,26,192,119,223,181,184,165,62,29,155,113,211,181,19,45,131,92,129,74,86,199,156,166,146,213,248,132,204,21,255,111,174,7,13,70,26,43,233,36,214,217,99,230,171,43,185,211,67,185,222,155,235,235,230,36,7,221,207,56,171,194,246,221,119,149,81,25,255,15,133,51,24,55,39,110,216,125,174,187,42,232,141,120,196,133,54,104,172,250,36,59,2,82,132,141,243,175,63,242,44,201,197,134,34,50,129,23,159,239,251,129,136,82,156,180,6,84,138,226,189,28,3,51,16,182,64,165,136,234,207,104,4,23,17,13,62,1,167,233,138,22,132,151,133,116,0,90,144,200,9,156,208,231,153,193,138,136,48,221,234,103,29,50,128,31,131,114,28,60,235,4,2,189,32,159,55,4,95,127,110,166,122,82,244,114,234,73,187,160,59,152,2,77,150,160,181,215,6,219,238,224,81,84,166,113,24,243,205,61,12,138,58,25,20,237,199,160,232,126,6,69,251,51,40,250,179,24,36,71,65,66,42,73,5,30,167,226,212,146,76,69,8,96,77,152,94,107,39,247,204,249,239,231,20,206,165,166,173,66,3,212,29,236,69,177,114,238,12,116,205,97,91,91,189,219,55,94,245,188,133,128,240,32,2,87,56,29,54,205,218,134,16,93,174,35,172,122,88,21,57,218,233,232,171,212,102,133,178,3,166,206,80,58,47,198,100,122,170,126,35,34,72,114,70,247,55,97,218,254,154,252,88,86,76,31,16,186,17,28,53,5,71,231,161,50,253,129,44,56,45,224,17,48,108,9,89,5,223,225,28,24,183,50,163,186,221,109,154,225,67,120,52,30,143,247,48,161,164,179,55,171,54,160,147,5,106,7,106,38,136,134,46,118,91,92,16,157,150,29,183,107,203,59,183,59,40,40,225,246,102,215,174,72,155,128,254,233,81,14,42,191,230,103,29,136,224,57,44,40,18,163,226,8,144,196,140,87,190,141,232,82,81,5,152,1,97,155,44,232,245,110,180,55,199,86,121,38,228,137,172,73,172,112,184,206,136,172,226,145,154,100,180,164,220,25,26,108,78,41,143,242,112,10,206,223,158,189,115,106,101,19,137,240,50,155,90,135,194,185,200,51,78,51,238,161,149,238,76,193,33,171,85,18,75,223,97,244,27,203,51,3,193,86,63,42,95,31,116,152,73,83,233,231,159,204,35,199,163,34,95,11,77,32,152,239,126,252,153,196,9,13,91,92,154,194,225,93,133,130,9,110,191,163,183,124,251,177,222,234,3,139,43,202,140,149,28,169,70,34,181,174,185,117,138,213,194,74,65,211,234,74,27,25,95,36,50,130,84,20,25,77,109,151,148,84,177,8,137,210,215,158,196,231,207,224,212,171,198,248,133,70,83,203,177,210,125,202,34,168,149,140,106,215,90,127,135,180,9,187,35,16,97,156,178,16,91,199,108,161,171,195,60,223,68,240,162,60,165,255,103,164,206,152,182,37,128,29,140,235,21,198,10,207,239,149,74,211,34,253,70,162,217,181,142,223,41,166,29,40,191,141,200,98,180,108,167,196,34,192,125,2,43,156,15,131,145,126,34,115,9,232,134,24,110,0,73,104,193,93,231,85,46,38,100,122,250,230,66,244,18,90,103,193,8,26,214,193,72,213,81,69,6,117,52,208,104,87,209,63,51,226,7,242,186,254,133,36,177,48,145,58,56,0,115,186,200,11,138,36,198,217,210,146,173,56,187,193,129,98,173,24,30,48,151,190,136,19,78,13,57,175,93,151,7,210,40,23,25,0,241,24,102,245,51,55,158,163,236,160,146,109,227,136,153,179,106,14,55,220,172,230,105,115,46,243,148,42,110,71,184,211,10,71,175,40,53,14,145,4,107,46,209,246,200,92,99,250,41,200,197,212,250,34,204,84,91,104,152,229,60,179,21,144,134,65,135,197,52,199,73,221,78,204,246,69,221,190,48,219,67,94,119,132,220,236,49,58,120,135,50,3,136,122,72,138,122,72,138,122,72,138,250,72,138,250,72,138,186,73,218,14,234,221,223,247,18,96,125,151,192,155,215,151,127,204,45,0,48,207,195,205,84,198,176,176,0,33,91,198,139,141,43,229,102,240,237,44,20,169,166,76,161,253,2,51,5,61,84,146,36,80,208,121,158,115,56,127,243,92,153,228,76,42,134,69,153,136,9,26,220,70,224,183,187,120,46,65,254,2,174,183,249,105,210,122,15,87,141,171,69,49,68,230,20,58,148,192,104,4,151,148,107,54,201,164,145,72,34,177,40,95,107,191,172,91,215,54,245,115,165,184,219,74,248,18,145,233,57,244,29,136,9,142,135,13,143,201,240,136,154,238,92,143,166,215,124,131,135,210,95,170,39,125,75,23,5,101,17,172,112,178,134,131,134,172,33,73,130,84,201,108,75,197,170,251,9,105,6,252,11,138,247,183,107,210,98,248,110,95,100,95,200,139,168,113,10,186,236,138,250,46,220,101,87,180,143,148,179,115,195,160,233,103,161,249,2,113,22,243,152,36,194,220,170,108,6,92,242,115,217,241,84,153,97,45,155,193,76,51,154,210,98,217,69,226,46,63,168,15,165,178,214,213,54,219,135,82,251,23,3,51,131,46,174,190,78,112,195,166,113,245,36,226,48,53,230,208,183,178,110,24,152,230,136,65,105,195,96,99,120,241,138,104,42,188,73,40,97,84,88,50,100,73,226,204,175,189,214,54,39,106,110,87,124,86,156,196,168,106,103,202,14,15,100,144,80,146,149,43,12,164,151,89,138,181,18,7,80,215,122,89,82,26,230,65,153,98,120,128,199,88,214,52,3,231,242,167,231,175,223,121,79,9,139,230,57,41,66,167,98,160,21,116,208,140,109,108,110,197,60,212,178,138,10,93,10,96,90,161,246,65,65,78,91,193,10,83,99,245,197,112,68,82,71,207,83,128,238,136,8,86,172,21,218,94,195,198,218,96,107,98,19,67,204,48,216,238,92,22,242,87,12,49,51,86,198,26,118,132,112,204,21,225,246,20,90,101,236,26,99,207,33,98,42,219,161,244,71,148,237,158,23,41,225,50,122,104,176,89,121,151,162,19,209,98,204,7,13,219,134,145,254,64,182,169,45,113,94,209,27,145,253,3,163,94,102,221,17,46,84,135,47,94,96,82,25,65,60,20,109,106,118,106,213,57,131,151,132,71,254,34,201,243,194,21,35,70,112,84,43,60,9,156,198,89,201,105,3,88,99,24,193,99,27,58,202,203,162,1,171,17,40,216,106,125,26,199,41,182,87,203,252,71,41,87,230,212,165,50,26,129,5,248,241,240,78,181,111,83,32,203,252,99,13,47,105,56,133,201,177,9,45,90,183,145,1,171,250,144,59,62,207,95,228,1,73,232,165,48,139,92,251,80,99,189,1,178,121,97,248,98,82,144,43,149,138,32,34,159,49,23,101,151,16,36,113,240,169,218,107,9,124,30,10,127,224,2,187,26,81,206,62,167,236,108,6,147,113,219,43,123,73,110,227,180,76,33,137,211,88,84,52,77,198,99,229,57,20,148,4,17,13,125,184,144,165,77,36,12,33,21,71,77,224,237,243,223,42,221,86,215,211,212,138,94,50,162,99,41,141,85,152,78,90,65,255,89,198,5,13,97,17,211,68,89,5,184,74,53,251,3,171,166,198,55,202,6,26,61,97,220,219,197,251,187,162,88,180,183,24,167,212,251,34,78,18,44,35,149,134,166,69,232,78,7,215,92,160,202,110,162,66,23,181,98,140,38,82,7,49,227,4,203,235,233,74,36,140,159,103,220,109,174,109,112,221,71,162,68,7,4,164,15,40,49,237,36,206,188,117,69,30,252,222,185,79,90,187,34,7,249,89,239,48,30,15,174,13,174,223,11,31,197,131,235,157,91,161,214,41,87,105,102,238,144,177,86,150,106,247,214,116,38,44,101,82,86,13,242,125,31,219,180,93,110,121,194,141,69,218,46,177,94,228,78,159,120,47,206,181,220,211,253,70,53,157,215,253,70,181,92,219,253,134,181,28,223,253,134,89,163,110,246,29,37,210,100,251,250,248,123,9,219,151,179,56,250,42,22,71,95,199,226,232,235,88,28,125,21,139,163,221,44,174,179,142,83,195,138,168,252,86,249,112,93,155,250,214,229,96,122,26,205,130,200,42,202,100,148,65,218,133,144,118,41,164,89,12,41,29,230,174,59,231,2,139,128,146,198,149,243,215,147,245,148,38,148,83,125,27,226,45,251,60,11,233,109,227,114,23,190,91,145,186,206,121,65,97,147,151,192,74,245,176,38,153,72,65,134,2,15,240,40,102,226,174,254,209,25,88,238,75,143,118,195,7,29,199,116,63,12,33,174,38,23,79,162,24,188,38,170,203,53,196,247,74,208,95,145,72,104,88,7,124,17,55,230,55,75,180,128,209,47,45,54,152,7,37,73,80,38,205,92,137,26,172,195,172,234,125,21,121,177,184,70,205,72,87,252,181,138,79,214,54,184,136,255,9,171,108,77,139,11,130,110,128,31,103,65,82,134,148,185,70,241,176,13,162,19,221,74,136,91,181,204,117,141,241,129,14,216,214,9,127,81,177,41,98,83,200,58,12,235,160,31,79,109,171,125,73,185,76,106,94,228,137,204,214,154,194,184,142,69,128,64,215,26,27,49,2,188,234,140,138,186,105,181,82,109,247,206,151,222,178,160,52,243,30,141,199,117,197,162,24,102,165,176,59,71,22,52,180,198,133,116,65,202,132,119,194,110,40,70,75,12,240,109,67,172,171,37,98,136,238,27,174,240,162,234,251,162,229,61,53,187,239,93,160,112,240,91,11,19,17,121,237,182,55,222,131,192,151,174,116,134,234,52,140,111,32,72,8,99,51,103,229,61,118,106,129,60,141,142,116,7,167,183,220,155,220,38,176,200,51,238,205,243,36,116,206,42,127,252,116,20,29,25,163,194,248,198,208,217,10,65,202,189,199,48,95,122,235,40,70,67,57,47,179,144,134,94,178,4,22,145,48,95,123,105,8,43,239,49,44,18,122,43,10,201,152,23,208,12,131,94,191,149,140,199,139,141,250,234,84,152,205,122,44,115,9,109,12,108,69,2,234,221,122,19,199,174,225,58,61,188,19,175,141,249,151,171,56,203,104,129,95,182,18,205,43,146,210,153,19,121,143,96,237,61,2,177,248,121,82,82,239,241,120,236,192,168,129,134,173,72,102,241,105,89,144,141,0,61,83,220,135,80,179,74,70,92,124,255,116,132,163,172,53,140,194,248,198,224,162,249,213,248,242,81,190,223,112,208,177,149,125,27,121,120,87,21,194,215,85,129,166,4,244,238,217,220,59,134,149,119,12,234,180,29,141,199,48,207,139,16,67,25,226,159,104,61,30,143,37,135,240,203,15,227,177,222,220,29,123,57,167,124,77,105,214,191,153,103,6,205,219,6,103,0,78,165,191,105,237,66,158,9,23,115,38,7,26,225,159,173,5,166,217,115,235,61,132,213,198,59,210,75,67,95,50,202,111,104,49,85,13,15,235,133,160,108,86,11,124,162,87,203,82,88,228,65,201,166,121,201,147,56,163,94,134,37,161,178,9,221,105,111,98,126,209,202,202,32,198,150,162,183,248,238,161,37,14,114,145,61,18,241,113,91,109,110,245,2,194,159,185,185,221,91,103,16,179,221,139,110,29,195,252,106,202,229,245,209,166,93,182,87,212,203,175,247,210,127,97,6,155,69,252,57,52,82,48,201,230,1,92,110,24,167,41,172,227,58,91,131,177,248,213,42,49,55,47,136,72,182,164,204,247,253,94,46,116,40,95,113,94,26,71,196,62,63,233,220,214,207,59,213,222,146,172,188,99,75,229,125,157,62,223,103,158,150,106,221,53,194,105,150,210,154,208,107,111,2,145,55,169,206,30,242,29,14,239,108,19,196,29,108,157,179,150,90,128,166,50,78,19,111,82,29,214,134,102,54,80,226,149,239,14,182,109,149,220,82,202,187,181,244,190,247,80,99,83,90,215,135,69,44,42,13,155,38,97,216,97,114,177,35,118,182,29,77,198,99,139,220,214,53,115,120,39,95,146,182,245,98,173,62,219,97,59,27,50,140,25,153,39,52,156,117,18,160,130,119,152,148,48,223,91,179,81,220,144,34,38,25,159,57,171,34,78,73,177,113,172,222,56,200,179,153,243,38,41,25,94,200,253,26,83,71,31,173,229,142,118,223,160,250,219,3,207,3,249,246,29,252,148,223,130,231,157,117,156,71,60,109,29,151,216,14,35,134,165,61,167,179,160,232,59,220,80,129,206,59,114,154,167,171,235,142,34,115,150,39,37,199,112,43,163,220,219,120,99,72,232,130,123,99,88,37,222,195,14,194,86,121,140,255,61,225,191,48,113,31,245,115,175,54,126,4,27,118,219,62,66,18,143,91,182,79,251,116,196,217,170,228,214,60,88,237,47,229,218,105,200,64,82,210,217,225,157,225,159,52,37,242,57,34,155,29,222,185,50,73,96,191,48,233,82,159,147,98,73,185,244,245,7,246,224,85,66,2,26,229,73,72,139,153,163,54,90,122,120,248,150,26,166,149,124,223,119,186,184,190,150,26,103,149,120,71,99,88,21,120,211,108,188,137,190,86,196,29,111,236,251,23,88,0,194,126,108,152,0,163,198,229,89,47,207,126,125,195,190,21,161,199,4,50,79,177,219,197,50,199,105,176,105,151,172,21,241,50,18,194,86,116,10,155,37,23,202,116,178,85,172,53,83,75,79,107,241,187,192,220,85,159,244,181,109,237,150,85,100,152,20,45,129,236,229,104,147,159,150,229,124,171,247,124,31,101,124,120,103,5,1,180,26,182,96,10,202,202,132,119,67,138,80,197,17,190,189,199,196,171,123,206,182,255,124,85,11,181,149,217,225,157,169,105,119,153,82,150,98,187,215,23,107,152,14,19,235,142,18,178,159,113,143,209,52,70,235,1,77,147,99,231,12,117,242,43,140,170,201,155,65,232,231,211,81,52,177,80,97,18,176,113,212,47,203,121,26,27,103,189,249,238,0,245,85,88,230,169,244,129,219,175,9,88,215,86,179,123,219,233,4,200,251,120,227,29,239,208,146,6,215,150,69,28,2,254,241,130,60,97,222,164,195,192,210,67,154,109,0,167,9,153,211,68,163,154,39,185,120,101,71,187,17,25,247,82,26,198,165,41,107,104,172,166,115,239,200,105,225,2,56,123,135,42,236,116,36,144,182,250,59,102,111,235,101,249,233,211,206,242,163,117,116,35,134,221,212,33,208,161,173,59,64,118,196,38,155,31,223,247,237,215,207,123,224,248,20,236,107,192,103,73,28,80,119,60,132,201,184,243,189,25,12,105,118,209,159,146,91,121,32,103,206,100,220,197,139,198,245,160,252,199,73,203,237,32,155,166,235,248,59,239,8,253,177,174,180,103,66,7,139,154,80,89,36,225,166,228,22,38,99,244,60,10,54,232,26,175,83,126,173,174,81,75,130,59,13,235,63,67,172,101,133,204,23,200,181,76,164,237,45,186,97,188,143,236,246,188,190,245,205,165,23,131,240,182,248,246,202,185,21,160,111,126,162,29,189,219,142,247,169,90,250,80,126,254,114,9,239,149,208,46,109,114,154,175,132,147,46,55,218,113,206,46,101,78,53,84,34,36,187,187,70,30,222,169,44,177,40,19,238,228,154,43,33,204,196,66,219,4,235,163,229,240,78,140,218,158,233,137,252,108,11,110,245,37,36,219,193,46,242,0,186,166,233,80,90,167,35,41,253,255,58,199,247,157,145,201,198,95,138,248,227,14,50,223,235,32,255,73,151,208,158,199,184,251,226,249,203,79,157,225,207,183,170,80,186,8,254,38,167,180,249,182,242,238,243,218,42,142,65,163,217,113,186,95,113,215,37,32,205,65,215,126,182,235,196,35,21,191,243,188,247,64,139,21,136,223,31,16,106,64,60,146,237,0,60,184,208,191,125,162,90,229,91,182,88,4,251,106,116,238,116,49,95,204,254,255,83,121,252,93,151,189,252,177,154,35,250,23,210,28,209,191,53,135,248,124,137,230,176,170,163,254,173,54,254,117,213,70,87,83,95,178,131,226,27,27,42,58,254,16,82,222,229,86,119,6,188,180,7,43,59,219,66,218,12,107,203,114,154,246,186,186,99,63,58,148,37,19,77,100,35,242,76,70,184,164,74,24,138,206,73,251,148,180,121,45,9,104,113,175,29,213,186,127,205,76,196,76,218,107,110,173,101,190,172,146,215,114,93,173,184,79,181,16,1,247,195,62,11,185,172,95,71,218,189,140,142,20,10,6,128,238,207,107,118,102,23,96,188,79,128,171,14,213,20,249,154,121,87,164,228,249,181,17,187,57,238,136,221,52,227,115,173,51,47,10,118,238,59,235,167,135,119,237,124,7,126,62,209,77,117,228,219,91,70,10,212,162,65,231,200,60,147,213,86,85,84,183,89,130,229,74,146,186,70,138,56,145,44,245,193,225,25,93,139,150,94,47,183,183,228,170,83,105,136,50,44,249,174,229,16,226,94,48,192,159,201,156,205,84,109,214,143,234,183,111,134,170,4,85,16,4,91,152,66,208,57,186,249,51,77,208,254,169,38,232,114,105,91,97,141,195,59,201,40,248,30,142,6,240,31,112,44,223,254,197,223,122,169,171,198,58,99,180,30,28,181,230,251,81,110,191,41,117,65,158,120,152,110,67,193,146,66,221,214,170,205,16,175,173,121,7,61,161,108,35,95,44,50,87,248,98,20,150,10,171,234,64,153,208,99,141,52,86,133,170,174,192,121,162,173,2,110,153,7,152,176,91,97,125,206,10,51,235,45,205,44,207,138,66,103,156,219,174,76,98,51,3,97,11,217,158,69,129,49,19,145,45,44,84,87,153,116,171,46,80,127,186,222,146,178,68,194,248,102,137,71,149,127,148,111,99,52,50,144,50,255,88,229,37,204,46,195,226,209,191,20,89,227,181,10,9,108,53,111,231,37,119,243,173,241,58,251,118,223,233,65,255,136,102,79,175,92,22,138,142,189,42,91,7,234,145,152,145,144,79,152,40,67,177,21,66,103,21,72,56,219,174,5,26,130,91,61,126,20,191,191,74,111,197,111,37,170,50,54,241,43,172,39,7,255,11,81,90,97,231,25,92,0,0,0};
 
 static const unsigned char v8[] = {31,139,8,0,0,0,0,0,0,3,205,88,109,111,219,54,16,254,158,95,113,32,130,66,193,44,59,77,155,162,115,235,12,75,23,12,1,138,181,64,218,79,69,129,82,18,101,177,165,40,141,162,18,187,134,254,251,142,164,36,83,146,221,109,64,247,98,4,16,121,60,222,251,115,58,133,212,21,131,74,43,30,107,242,226,132,231,101,161,52,236,32,155,65,166,115,49,3,60,190,211,84,51,187,186,73,83,22,107,104,32,85,69,14,100,62,95,224,95,84,203,68,176,249,231,202,191,127,27,23,178,154,193,117,173,117,33,253,11,175,10,100,145,76,234,202,221,56,73,107,25,107,142,76,175,139,53,151,193,14,10,105,87,208,156,193,238,4,192,8,210,240,33,86,44,193,91,156,10,20,91,49,253,106,191,255,8,171,222,204,192,92,1,179,85,146,230,108,9,132,204,44,165,164,85,245,80,168,164,163,52,103,168,187,151,206,148,42,148,149,123,99,86,3,137,132,32,107,207,201,171,215,5,77,184,92,91,238,219,110,55,184,145,162,81,204,151,159,81,19,162,187,58,202,185,70,198,222,229,128,57,31,1,216,188,84,236,30,29,250,133,165,180,22,58,176,58,97,160,35,208,170,110,197,118,130,105,173,179,44,81,176,178,52,0,114,77,43,30,3,129,31,32,210,5,13,188,168,205,187,152,224,25,89,26,14,255,176,11,79,171,182,53,155,209,132,169,10,45,222,193,207,168,169,80,252,43,53,134,47,123,197,141,227,87,76,215,74,66,202,116,156,5,100,65,75,190,16,38,137,100,214,250,7,144,51,20,96,194,255,246,205,221,187,54,41,208,169,88,118,11,71,111,206,218,227,185,206,152,12,218,138,232,137,41,151,84,136,109,16,156,193,234,106,24,34,23,122,235,69,51,73,192,43,124,172,25,186,99,226,142,55,119,158,175,59,48,177,153,193,61,21,53,195,130,93,97,74,52,85,107,166,251,68,120,37,23,4,38,93,86,72,208,57,56,159,219,28,118,158,125,48,242,62,46,157,192,206,45,207,176,30,78,173,27,78,76,82,196,117,142,74,230,154,107,97,76,37,119,215,183,111,222,133,54,0,196,222,158,193,135,143,174,10,218,168,27,160,126,178,183,95,38,252,190,85,31,11,204,232,138,228,92,134,89,88,97,170,25,166,71,176,13,112,205,242,42,140,81,7,83,240,185,174,52,79,183,221,54,90,135,107,69,183,225,229,57,148,219,240,241,5,148,155,240,41,84,249,18,159,207,64,172,205,243,57,177,26,174,90,61,70,101,175,140,110,194,135,48,79,224,33,76,107,33,160,42,105,204,194,45,94,233,184,29,255,126,135,251,236,162,191,174,81,137,102,27,221,153,99,215,79,54,2,210,66,234,16,55,138,70,133,72,28,221,26,250,227,249,57,241,165,1,252,138,0,124,160,91,215,77,124,61,139,236,194,179,98,49,48,227,101,90,168,220,51,227,121,111,250,51,130,253,200,1,119,117,186,243,113,220,12,188,240,162,160,10,108,136,44,49,113,168,50,154,20,15,97,149,67,216,9,44,55,35,131,7,87,153,64,124,221,179,17,11,50,9,26,49,19,7,181,34,29,142,73,119,171,82,97,33,197,150,92,189,111,79,94,46,44,251,68,200,190,58,246,191,86,6,141,170,66,212,154,1,151,88,233,104,231,57,8,150,106,124,148,34,124,114,160,114,202,130,155,103,104,155,86,21,74,236,233,100,36,124,172,31,45,56,221,217,23,195,220,88,106,86,141,211,255,27,26,189,34,89,120,137,149,115,233,165,247,41,166,23,22,19,63,22,163,26,178,68,46,203,90,79,52,242,196,11,216,228,84,90,189,199,207,245,182,196,115,99,207,244,76,177,223,107,142,29,225,104,68,203,146,81,69,37,102,221,4,7,186,178,112,155,54,209,16,137,34,254,210,225,5,67,253,24,3,174,48,224,8,191,11,136,176,33,27,84,218,135,139,200,147,115,147,17,44,165,12,129,208,17,47,145,56,192,68,175,76,155,42,76,177,167,84,203,162,214,130,203,214,24,71,82,216,49,195,8,219,147,149,224,104,173,178,17,245,171,49,12,251,128,213,82,229,211,104,120,54,173,200,251,163,1,181,205,16,129,116,232,189,212,76,184,11,233,58,118,143,60,183,29,51,142,10,228,64,121,252,109,140,117,175,195,41,198,222,182,39,255,127,140,189,198,202,250,215,48,214,7,236,8,198,142,159,59,140,29,63,255,39,113,246,248,252,123,1,45,250,79,128,246,246,104,212,14,1,173,139,241,247,2,218,16,87,7,170,91,241,117,102,203,91,29,42,239,9,0,81,94,100,191,23,38,244,174,74,220,241,212,91,235,129,224,241,23,116,192,159,166,198,63,55,234,217,42,198,209,170,159,181,112,200,187,17,204,44,175,183,183,73,176,47,198,118,26,30,255,172,128,185,49,169,31,188,191,197,178,194,41,110,223,80,126,2,247,66,129,165,71,61,164,167,153,230,169,47,250,1,124,33,43,238,153,90,238,105,207,250,114,242,107,113,26,182,105,2,188,246,113,179,101,182,123,28,14,228,159,116,148,67,38,29,74,219,164,162,76,231,113,89,254,11,29,105,66,106,9,30,229,116,88,8,246,59,15,30,61,26,16,237,252,60,168,101,107,55,34,103,15,120,28,225,188,201,148,92,157,238,172,168,198,105,132,79,158,192,198,215,63,24,143,113,190,29,15,127,167,59,247,137,60,14,179,171,247,202,78,154,227,192,221,83,197,169,212,216,52,21,207,169,218,142,207,133,251,22,66,44,244,31,171,99,241,9,175,104,36,88,242,45,30,142,217,95,17,59,71,155,66,24,107,241,74,192,181,213,33,195,56,125,158,34,3,129,59,190,150,102,201,37,126,54,89,44,24,10,110,73,51,74,113,31,161,3,137,222,111,205,0,223,127,146,236,15,251,229,167,23,39,152,23,182,177,255,158,72,220,55,182,251,70,120,113,242,7,157,119,67,220,3,17,0,0,0};
 
 static const unsigned char v9[] = {31,139,8,0,0,0,0,0,0,3,221,91,121,115,26,71,22,255,95,159,162,51,165,242,66,10,134,75,178,21,44,148,146,17,118,216,181,37,149,192,217,218,114,28,123,96,26,24,107,174,76,15,66,132,240,221,247,245,57,61,23,66,81,84,217,90,108,1,211,199,235,247,126,253,206,158,193,88,18,140,72,28,57,211,216,120,125,224,120,97,16,197,104,131,22,53,180,136,61,183,134,160,123,20,91,49,102,223,6,179,25,158,198,236,235,7,236,5,104,139,102,81,224,33,195,52,27,240,127,178,244,109,23,155,223,136,78,104,56,13,124,82,67,111,150,113,28,248,250,132,126,0,67,124,236,199,132,207,56,104,52,80,31,198,198,22,52,33,203,183,17,204,156,57,243,101,100,197,78,224,31,80,58,49,234,95,93,190,29,190,67,61,180,57,64,232,98,240,246,252,227,251,241,151,203,193,248,223,87,55,255,234,178,70,132,156,176,139,140,214,15,109,179,245,242,196,108,153,173,102,211,168,177,14,226,65,71,251,248,216,148,127,178,99,190,74,207,16,205,118,11,154,79,76,246,79,54,181,69,211,145,121,36,155,22,93,52,179,92,130,233,229,150,190,157,95,15,191,140,135,31,6,87,31,199,93,4,203,55,155,53,4,210,181,154,136,96,16,195,38,48,230,102,240,230,234,106,252,229,98,240,254,252,63,93,116,44,199,28,107,67,70,31,251,253,193,104,244,229,3,188,157,191,27,124,185,248,120,115,62,30,94,93,118,81,71,14,239,104,195,135,215,95,174,207,199,227,193,13,12,104,252,90,249,197,222,180,106,157,237,47,102,117,3,239,252,226,176,81,227,3,111,206,47,223,13,36,94,158,227,119,81,147,11,227,89,247,93,4,208,8,89,182,176,47,179,165,63,165,59,128,46,113,188,10,162,219,74,149,205,131,213,153,98,192,20,223,154,99,15,118,18,90,249,46,125,242,249,208,62,219,193,26,48,25,95,234,45,159,97,3,165,98,85,54,219,234,235,100,166,67,6,182,19,59,62,159,53,148,87,169,25,12,109,125,18,134,65,218,90,3,117,185,99,33,28,69,65,68,248,120,246,117,39,83,35,235,46,225,137,95,236,102,137,88,119,152,209,101,115,70,242,42,53,201,48,178,51,70,203,233,20,19,162,230,136,235,221,75,57,228,125,96,217,9,123,226,42,53,41,142,150,169,57,46,140,73,216,123,47,175,242,236,241,157,166,214,238,252,142,109,116,103,185,142,205,12,18,73,189,32,138,170,232,196,195,240,220,182,35,224,155,83,163,147,43,76,187,64,117,122,103,168,226,132,236,147,107,31,216,235,12,85,190,227,134,109,38,74,108,198,152,196,116,104,21,69,56,94,70,62,55,178,215,98,146,104,115,66,147,132,174,19,87,12,211,168,154,248,14,71,235,74,197,95,122,169,5,52,254,150,24,120,10,173,136,224,161,31,179,129,175,213,32,65,146,143,58,235,161,132,37,102,46,38,216,9,122,241,66,244,159,22,244,91,247,146,216,86,144,221,114,171,250,244,25,62,56,152,105,164,70,203,9,152,202,7,139,220,150,64,229,65,215,222,96,177,193,89,184,196,60,238,93,1,159,24,197,1,154,56,190,21,173,15,116,112,120,19,176,65,169,40,76,52,116,147,54,207,10,19,144,83,96,154,113,48,130,88,226,207,43,237,170,25,90,54,40,82,20,87,78,106,200,104,26,85,141,194,183,192,241,149,126,73,246,22,120,122,75,229,115,226,127,64,0,224,24,33,194,16,98,76,161,138,229,186,168,69,208,44,112,221,96,5,218,56,89,35,218,212,36,213,180,86,52,126,109,125,223,252,254,176,193,97,225,146,149,238,136,174,222,204,41,32,15,84,23,92,90,162,216,172,249,131,104,45,217,41,181,65,52,250,92,187,216,130,184,10,62,17,71,74,148,225,53,178,132,93,84,176,57,55,107,40,21,164,170,34,158,136,56,85,72,34,133,6,167,145,138,103,9,13,22,210,10,105,204,65,239,86,214,90,99,71,77,98,1,175,112,82,24,57,30,85,143,139,203,81,225,196,118,41,199,44,62,149,78,221,86,75,44,100,134,227,233,34,21,52,0,119,139,172,253,169,0,156,227,29,3,97,137,188,238,252,18,135,39,122,148,139,75,169,29,95,11,222,227,8,116,10,216,238,33,31,175,208,249,4,146,151,190,106,173,40,66,124,124,236,120,56,88,198,67,27,134,3,233,49,191,172,40,245,230,12,38,84,77,139,210,171,84,107,106,132,48,96,45,81,16,93,89,214,0,42,200,146,8,245,90,214,202,114,4,46,21,163,97,133,78,67,68,217,198,28,199,70,77,243,118,30,142,23,129,13,59,242,110,48,54,146,69,23,216,178,113,68,186,218,72,132,12,42,38,108,89,125,188,14,177,1,115,172,16,44,126,202,92,124,227,27,9,124,141,192,54,249,74,156,185,111,185,93,93,72,222,36,135,108,53,73,64,47,34,9,146,194,46,233,103,46,77,10,106,6,183,85,141,193,120,17,5,43,182,39,124,243,52,206,191,190,181,28,23,108,22,220,25,3,5,9,56,210,121,99,23,29,110,20,109,72,46,227,37,25,227,251,120,251,85,81,82,155,187,77,67,15,254,217,82,176,43,18,20,146,138,174,88,41,29,173,208,73,122,111,146,138,232,93,91,4,0,3,199,21,230,88,18,121,233,194,1,164,208,152,43,42,19,153,11,7,42,93,34,31,236,60,167,82,168,236,74,74,54,198,244,45,15,84,169,215,67,6,83,113,54,198,208,48,253,17,25,55,248,183,37,22,74,110,35,216,42,19,9,195,166,182,102,205,45,199,55,245,41,93,65,90,56,77,244,199,31,200,72,118,134,230,25,197,140,27,137,198,115,72,102,224,166,93,183,196,156,147,164,135,238,19,252,105,174,98,97,209,186,99,232,135,203,184,15,223,231,184,196,67,227,84,32,229,115,55,136,66,82,227,65,189,134,98,48,130,26,154,210,72,4,252,111,129,16,54,33,132,129,129,21,239,105,37,140,240,93,218,255,67,116,51,77,218,156,24,203,39,186,198,231,46,163,206,209,103,43,76,130,123,3,16,151,171,117,5,19,202,128,212,142,210,224,72,109,72,132,167,213,2,251,84,192,8,234,54,8,175,132,210,5,140,52,107,226,185,45,95,86,183,38,149,235,166,24,87,12,43,70,13,67,95,126,155,10,156,156,118,214,93,243,61,128,116,198,3,99,81,142,90,71,28,179,53,192,211,92,224,153,181,116,99,105,68,124,62,88,56,231,140,150,118,91,225,26,64,238,159,69,162,68,35,135,72,42,15,164,148,223,229,242,205,74,82,8,152,44,115,148,162,43,242,208,76,55,85,143,231,208,36,245,42,183,42,207,207,208,7,153,18,165,150,77,146,55,125,93,226,21,174,75,188,220,186,196,43,93,247,29,143,209,123,138,58,95,21,46,57,95,229,150,156,175,74,151,164,225,25,116,10,50,196,125,17,182,91,133,203,218,173,220,178,118,43,177,220,189,40,183,139,41,183,243,148,219,41,129,40,233,171,201,55,60,141,205,91,188,38,21,53,183,106,186,216,159,199,11,116,134,154,85,221,197,8,123,72,6,166,11,140,20,117,173,248,211,243,11,189,190,147,53,29,202,84,112,202,129,229,178,150,255,143,20,132,148,165,32,215,87,163,231,202,65,38,129,189,238,162,127,142,174,46,77,194,138,14,103,182,214,180,168,250,191,154,173,208,66,255,175,75,86,104,112,160,69,80,132,39,65,16,211,179,39,100,205,104,6,78,184,230,205,150,46,91,49,179,167,116,112,255,145,74,199,103,141,247,82,189,236,10,79,82,64,74,234,102,151,26,242,33,127,139,22,74,221,202,9,188,159,134,101,48,205,233,153,46,250,3,218,166,165,93,66,25,184,63,55,254,210,12,87,51,48,109,140,58,168,75,101,106,186,135,221,108,245,70,221,53,10,87,154,232,243,104,1,114,9,245,149,197,56,59,17,94,134,44,84,125,28,38,132,36,142,149,204,137,79,137,251,149,219,39,181,175,236,140,53,197,207,13,158,1,58,11,20,50,62,102,188,188,181,177,11,69,52,96,109,209,195,8,1,117,130,253,195,28,174,28,223,14,86,166,27,112,21,51,35,76,147,229,74,1,147,250,89,241,159,169,32,8,11,89,143,168,31,146,112,246,119,215,15,229,190,50,83,63,164,163,115,113,185,160,159,244,240,132,53,74,206,120,120,67,223,242,167,216,45,41,32,82,27,248,39,149,62,147,37,148,29,16,114,110,40,249,61,121,209,138,146,212,225,123,177,145,106,217,139,228,32,53,43,117,58,70,107,48,228,248,48,211,114,51,55,101,80,114,87,40,165,223,118,48,93,210,59,2,102,236,196,46,117,217,198,232,205,240,106,92,23,174,196,224,75,231,207,120,184,246,131,230,127,250,156,63,156,251,56,132,213,229,77,35,133,148,168,16,71,80,2,249,44,144,21,160,69,111,101,201,24,122,106,59,119,224,130,45,66,122,198,204,197,247,200,137,177,71,234,83,126,108,69,66,107,138,235,247,245,182,113,166,116,244,148,220,205,53,133,21,115,45,223,241,192,25,213,9,44,140,22,245,99,180,130,191,24,162,117,125,2,85,92,253,101,179,169,107,249,189,231,250,48,105,17,199,97,183,209,88,173,86,230,170,99,6,209,188,209,110,54,155,13,88,64,31,60,115,92,183,103,248,32,168,222,122,231,224,213,155,224,190,103,52,81,19,181,143,224,127,210,123,166,141,59,157,58,17,132,24,173,69,241,28,128,116,78,188,174,183,143,141,116,55,80,109,181,51,109,235,124,91,4,77,205,116,19,100,94,193,45,238,25,211,101,20,1,132,253,192,77,123,4,57,162,190,114,236,120,209,51,142,244,206,179,211,6,103,54,197,127,104,197,139,93,220,191,202,112,207,225,42,103,192,238,25,31,142,80,171,109,157,160,19,128,174,217,58,169,159,252,220,236,31,155,157,87,29,122,141,228,183,86,123,113,244,187,215,134,235,246,15,173,243,87,230,15,47,219,136,191,211,89,148,196,79,205,105,19,117,204,230,81,27,181,204,86,231,24,134,158,192,86,116,232,176,206,137,219,169,183,205,151,71,175,126,207,200,72,5,210,212,137,110,183,174,93,161,229,75,17,153,254,204,35,107,205,244,231,76,232,118,177,3,132,170,29,72,193,100,73,235,180,1,170,205,47,190,150,184,149,129,86,60,149,221,113,224,189,53,20,248,55,24,92,54,109,21,11,232,102,196,13,41,111,22,222,164,126,132,66,248,155,204,235,17,182,235,173,102,19,18,245,8,210,45,241,193,90,143,160,149,201,74,47,94,193,69,20,44,125,27,108,60,111,145,223,150,36,134,196,190,62,1,12,48,246,75,116,158,74,126,184,17,188,111,53,36,248,235,112,35,164,65,47,94,104,205,105,129,24,161,9,187,81,157,106,67,0,69,31,50,193,219,158,34,179,205,12,16,194,135,247,245,14,10,215,245,150,148,30,172,27,45,2,72,12,186,162,161,147,200,90,247,236,4,131,19,9,8,241,208,12,156,39,233,66,228,116,29,31,215,169,27,16,77,180,198,169,183,245,11,58,245,184,153,49,201,179,12,115,140,227,180,148,13,46,166,62,242,235,86,211,80,13,190,50,85,18,153,213,94,202,244,4,29,154,71,176,233,5,90,196,219,149,30,241,75,77,147,138,245,36,81,145,199,9,43,130,212,91,7,187,118,161,168,98,126,101,131,92,107,130,221,90,250,88,17,244,135,29,76,138,84,171,134,108,135,88,19,72,113,106,40,116,33,224,44,2,151,138,182,213,40,229,149,243,52,163,211,208,194,214,146,168,77,32,147,188,213,148,8,42,25,200,192,156,165,135,18,175,66,1,2,116,245,232,38,129,97,180,182,25,53,97,141,153,69,29,122,208,154,153,78,79,54,185,247,50,50,61,20,7,176,27,250,145,53,26,6,14,244,177,207,108,167,132,140,217,28,255,154,29,34,65,132,33,242,107,137,93,174,234,80,5,187,72,154,103,91,234,210,225,134,237,71,102,18,75,99,53,103,149,51,48,250,234,170,33,12,88,176,107,99,171,91,246,35,140,152,229,11,176,136,18,168,203,244,30,168,182,242,43,107,250,2,114,107,87,105,209,27,233,77,19,130,210,219,215,76,173,78,67,101,107,49,120,43,169,52,202,29,81,145,207,196,36,240,166,225,217,87,157,124,198,189,62,96,52,67,127,22,236,103,51,252,206,250,163,173,64,75,232,118,107,191,144,138,107,122,46,70,164,41,81,92,232,96,174,156,185,193,15,66,64,203,119,245,96,134,172,207,196,237,233,178,116,52,172,191,212,211,206,69,43,37,86,251,222,229,114,77,96,191,169,21,195,96,1,49,234,235,137,193,105,99,209,210,200,20,186,88,208,176,213,2,226,172,82,89,119,142,200,194,130,130,148,42,47,48,178,35,18,243,203,50,7,155,206,199,75,252,172,158,170,176,140,159,66,150,67,167,12,155,39,34,115,32,89,85,15,193,80,187,208,83,163,138,246,120,76,190,72,169,110,21,5,245,148,79,142,130,234,201,140,22,97,51,201,67,210,113,52,41,184,141,203,162,164,143,21,196,182,118,182,231,174,191,67,163,53,129,125,66,43,39,57,6,164,231,18,97,232,174,209,148,185,78,2,201,162,42,152,213,41,144,142,239,131,10,161,105,230,225,70,61,165,165,109,253,143,5,233,20,172,49,11,34,15,188,57,191,53,4,46,75,191,83,180,149,171,243,178,107,93,63,202,5,166,135,10,54,154,43,20,76,202,6,199,252,68,168,23,72,16,213,195,192,97,218,92,68,162,36,216,201,23,15,122,234,86,94,201,40,22,0,13,123,81,214,47,110,255,1,50,250,13,144,69,54,146,201,151,22,23,115,247,61,203,230,72,12,96,39,234,146,221,135,75,214,228,213,40,1,71,175,92,60,23,130,90,42,209,48,206,6,62,13,103,232,226,167,254,117,186,82,73,81,41,74,50,120,7,243,17,59,245,97,30,209,7,90,224,173,62,13,92,2,145,204,179,187,201,101,27,205,173,176,76,61,14,55,122,82,87,12,29,227,172,103,36,247,30,139,241,225,91,236,132,197,189,50,205,73,221,155,44,94,239,241,155,203,34,116,79,68,106,82,74,88,75,149,246,208,50,61,199,200,60,72,91,48,190,80,59,30,3,175,118,147,117,23,190,196,219,27,95,226,61,19,190,101,132,159,128,111,250,121,228,231,192,87,220,76,222,133,237,124,181,55,182,243,213,51,97,91,70,248,175,209,221,103,65,246,58,121,42,110,23,186,118,225,234,133,232,218,173,103,66,183,140,240,19,208,149,79,198,63,139,79,208,31,27,220,137,109,123,127,108,219,207,133,109,9,225,39,98,75,127,98,176,31,182,251,132,74,150,1,201,20,30,251,182,58,234,238,32,168,117,94,22,7,201,194,211,48,254,226,217,15,31,80,188,5,201,169,153,126,111,165,88,248,228,0,237,40,85,161,103,106,236,220,217,153,58,213,80,167,108,162,210,123,76,1,30,204,102,4,199,197,69,121,177,104,218,206,202,223,6,20,201,85,156,55,113,28,10,83,161,252,177,156,234,59,220,240,223,208,148,234,112,10,107,145,95,63,133,121,196,30,222,131,206,7,199,57,96,171,96,178,80,153,208,95,251,20,33,86,12,68,66,151,158,184,240,111,180,80,161,135,43,148,26,226,54,72,140,162,101,79,27,229,134,144,109,164,153,111,186,85,47,83,186,197,133,139,102,59,143,42,79,50,7,214,185,114,165,196,212,178,167,24,178,166,37,216,115,104,93,155,148,180,35,28,211,210,139,20,10,203,104,237,48,219,172,162,208,58,110,95,147,156,171,58,129,27,95,186,96,4,147,84,70,200,198,81,179,124,70,43,44,214,41,118,203,84,34,244,40,27,251,19,245,198,126,5,6,61,0,219,25,236,104,129,196,126,76,181,44,41,48,100,48,75,221,163,133,64,66,205,134,23,89,54,51,154,11,97,217,133,6,243,64,76,126,144,203,135,170,160,98,38,139,43,146,167,242,242,96,201,80,204,76,113,250,190,15,51,217,92,186,100,1,200,97,159,44,219,131,73,101,137,54,20,38,120,79,6,250,225,60,172,132,157,194,156,104,127,151,157,107,84,39,208,90,159,250,250,245,245,193,246,224,0,223,179,31,157,218,252,1,99,121,254,252,250,224,191,109,203,83,123,228,58,0,0,0};
 
-static const unsigned char v10[] = {31,139,8,0,0,0,0,0,0,3,237,61,237,118,219,54,178,255,243,20,8,175,111,87,110,45,74,150,226,52,81,108,119,29,71,73,189,199,95,215,82,218,221,186,174,77,73,144,196,152,34,85,146,178,236,184,58,231,62,203,62,218,62,201,157,193,23,1,18,146,21,199,109,146,222,246,180,141,8,12,6,192,124,207,0,100,156,73,66,73,146,198,126,55,117,94,60,242,71,227,40,78,201,45,25,174,145,97,58,10,214,8,116,183,82,47,165,236,87,179,223,167,221,148,253,60,161,125,50,35,253,56,26,17,199,117,43,240,111,103,18,246,2,234,190,75,116,60,123,221,40,76,214,200,203,73,154,70,225,26,105,123,157,68,31,182,27,1,96,72,195,52,225,227,30,85,42,100,23,70,164,30,52,17,47,236,17,24,223,247,7,147,216,75,253,40,124,132,216,82,178,123,116,248,122,239,13,217,34,183,143,8,121,213,124,189,243,118,191,125,126,124,116,210,110,144,103,213,106,117,77,107,253,177,37,58,158,99,7,1,244,175,104,223,155,4,41,249,145,118,90,81,247,146,166,4,151,170,13,105,239,29,52,127,58,58,108,54,72,109,157,141,120,219,222,253,166,250,109,163,90,37,165,189,176,23,117,135,126,232,173,106,3,14,219,199,231,173,230,201,15,205,147,86,131,45,137,144,113,236,143,188,248,166,65,156,113,20,5,110,152,142,221,40,30,56,107,172,51,161,176,141,30,239,78,253,17,117,7,81,52,0,202,117,163,145,128,72,105,156,250,26,192,212,135,121,167,137,130,152,225,255,142,119,90,173,31,143,78,94,157,159,52,255,231,237,222,73,243,160,121,216,86,11,24,249,225,62,13,7,233,16,72,194,113,14,189,228,237,120,76,227,93,47,161,13,82,57,221,41,255,116,86,81,93,251,209,52,235,242,202,239,181,174,195,201,168,67,227,4,58,126,238,101,173,173,49,237,250,94,176,59,244,98,28,242,248,239,255,181,242,223,191,124,245,117,105,117,205,253,206,105,220,206,126,219,220,230,56,216,90,119,142,247,24,93,143,222,2,43,214,171,146,23,235,85,65,140,4,96,78,154,47,143,142,218,231,175,154,251,59,255,106,144,186,132,169,107,32,200,202,243,147,157,195,55,77,109,159,128,144,175,106,228,93,55,200,211,141,141,250,134,154,247,96,231,159,231,251,71,111,206,247,247,14,155,45,62,51,54,127,223,252,231,249,241,78,187,221,60,57,132,197,255,82,170,94,159,86,203,207,119,202,175,189,114,255,236,182,54,251,57,249,122,245,235,149,10,231,254,184,7,226,223,35,99,47,5,182,132,36,141,96,162,180,59,36,78,245,218,1,70,211,190,127,77,250,81,12,141,154,76,224,164,7,205,246,247,71,175,112,121,186,220,193,120,16,150,189,157,253,71,51,46,239,109,224,240,123,80,2,64,59,30,251,225,128,120,113,236,221,8,81,151,194,120,126,116,220,222,59,58,108,129,208,159,194,52,167,128,211,1,185,44,175,215,152,92,190,244,46,105,76,246,146,0,84,102,213,57,195,61,158,214,36,200,58,3,217,25,81,80,114,47,36,45,111,20,121,18,168,46,129,170,12,232,123,111,234,249,190,236,124,34,58,171,207,57,134,192,75,46,213,200,13,217,249,140,117,30,123,93,191,239,119,217,110,36,200,83,9,194,149,231,32,154,132,169,231,135,6,204,183,18,230,41,131,217,5,91,16,123,129,1,242,76,130,108,48,144,166,151,48,70,232,32,207,37,200,19,190,210,20,8,145,230,86,179,94,149,64,117,78,179,216,75,252,192,87,27,90,151,52,173,114,154,182,162,73,58,36,111,40,40,174,6,36,169,90,21,84,125,31,197,52,81,189,130,156,223,84,57,57,223,28,180,85,215,19,217,181,110,108,180,57,137,163,49,245,204,237,172,111,72,224,154,177,101,59,240,83,9,92,23,100,78,186,209,84,245,126,43,123,57,105,222,76,130,62,1,139,142,6,168,103,226,121,38,33,55,4,71,47,125,52,196,170,255,121,214,95,231,182,48,163,75,173,42,59,159,10,129,12,7,129,215,163,201,80,65,172,75,136,188,41,149,0,53,9,192,37,106,215,232,84,148,229,178,248,15,111,156,173,172,38,105,43,164,88,146,107,103,146,32,141,181,85,74,186,10,157,104,69,65,52,138,66,161,56,138,141,53,73,81,161,93,135,116,74,126,162,158,82,174,51,174,184,251,209,128,140,104,58,140,122,36,26,163,123,74,12,213,205,76,64,94,121,145,86,175,246,90,59,47,247,155,146,182,208,194,173,130,166,188,173,127,181,218,205,3,57,97,127,18,118,113,18,210,186,129,221,141,74,171,204,2,194,50,152,123,6,227,17,122,3,58,2,169,130,86,190,128,83,15,6,92,81,240,185,107,96,67,211,29,249,116,6,235,144,110,189,228,192,175,216,89,125,145,141,242,193,25,120,61,48,68,108,212,158,124,50,70,165,241,132,154,99,90,222,85,54,132,63,24,35,250,94,144,228,134,156,208,36,141,226,108,148,122,94,60,112,68,147,4,182,202,6,29,240,223,198,128,91,146,222,140,193,143,57,206,26,56,210,235,20,127,145,25,96,16,228,98,228,51,227,10,8,128,96,100,54,69,194,96,118,25,8,155,167,165,53,152,147,9,196,124,96,138,225,13,103,50,129,224,199,239,193,220,140,190,107,36,240,58,52,128,199,183,240,72,56,34,135,251,40,5,137,174,94,131,68,221,36,45,154,166,64,145,36,15,59,165,157,132,69,47,218,0,136,104,0,62,190,130,9,230,13,235,131,72,68,241,141,54,232,53,111,33,64,124,64,198,193,207,36,173,94,83,116,116,94,16,144,196,66,53,181,237,62,130,233,36,2,26,120,201,77,216,37,32,165,91,219,194,85,235,194,148,9,16,4,59,48,59,135,144,248,224,255,105,28,5,1,108,100,139,132,160,124,59,29,8,209,118,85,107,73,140,84,100,7,74,129,177,222,235,1,56,204,210,230,143,37,1,67,196,42,50,172,174,135,248,32,84,81,16,60,162,116,181,48,69,116,113,238,102,83,129,177,135,128,21,66,102,216,33,184,74,177,247,146,83,241,198,126,133,19,169,50,96,92,185,85,200,185,141,0,90,191,105,182,157,108,206,33,5,251,136,113,85,6,73,136,131,187,4,37,46,183,65,134,29,24,3,49,65,0,110,27,233,93,121,151,68,161,134,96,150,253,76,252,65,232,1,59,181,61,242,38,9,50,211,54,18,80,47,150,52,82,164,203,250,253,62,41,61,150,251,116,163,203,85,109,129,233,48,142,166,140,37,205,56,142,226,146,182,242,139,215,158,31,64,156,4,241,13,163,137,85,100,26,100,229,86,161,70,165,155,36,109,80,209,217,133,66,164,88,59,51,9,15,65,152,167,136,174,80,32,69,76,105,136,32,144,14,162,65,201,57,161,93,10,246,46,151,65,52,128,51,136,42,219,174,10,241,172,11,86,150,65,72,176,46,229,165,140,46,168,228,161,55,2,171,131,200,93,249,152,49,104,236,37,201,52,138,123,220,44,97,56,24,133,127,75,17,163,234,226,89,81,194,20,56,99,44,123,92,23,120,197,211,90,174,187,102,116,215,242,221,117,163,187,158,117,167,34,242,20,253,242,49,3,160,161,215,1,158,138,126,241,164,73,48,102,78,162,147,253,206,186,166,90,215,212,236,194,105,180,25,201,119,76,158,94,161,53,85,141,171,164,65,194,73,16,100,163,128,167,7,66,143,24,148,122,214,37,156,253,73,186,44,60,47,81,148,208,85,195,180,160,112,176,230,146,195,228,151,75,42,198,220,86,97,5,78,113,36,47,50,1,16,30,71,227,189,240,54,12,82,211,78,230,122,52,253,96,253,46,74,5,217,218,218,34,14,179,105,108,21,142,6,69,128,28,32,186,191,78,168,176,107,16,91,76,82,151,28,131,210,130,213,65,91,233,13,32,134,118,205,65,204,144,75,245,11,192,198,90,55,228,20,105,213,135,24,43,8,50,3,108,24,233,204,245,162,58,194,127,210,47,236,244,122,153,216,94,65,132,213,227,202,34,99,20,229,25,68,31,61,150,192,91,164,36,7,106,174,129,153,156,172,61,166,233,4,51,45,240,17,47,112,186,230,104,156,222,100,19,250,9,199,75,74,97,68,186,67,136,52,233,42,215,102,105,163,127,157,248,49,139,133,50,111,76,76,131,220,80,232,220,128,229,201,100,123,75,122,1,107,98,237,170,140,122,77,195,195,100,161,65,46,212,254,70,16,114,146,14,37,94,74,144,99,41,216,187,229,176,206,112,39,49,56,99,112,9,192,193,112,112,161,152,181,102,223,192,66,188,122,182,239,166,32,76,25,217,45,235,119,204,245,163,23,193,60,77,109,2,179,211,9,162,235,162,16,6,20,51,97,231,99,215,167,74,14,15,179,190,0,209,61,228,250,68,221,227,97,86,23,50,100,31,189,38,173,234,242,48,235,74,56,194,76,248,242,75,60,123,161,171,86,159,25,153,19,83,193,116,125,115,251,126,0,88,74,37,104,100,10,14,145,196,175,46,236,77,152,17,161,218,114,219,126,242,3,106,114,195,130,88,234,37,26,203,170,92,20,51,162,137,21,124,228,141,179,89,249,164,140,14,130,50,179,23,5,3,134,21,202,165,140,23,2,162,225,130,63,53,163,197,129,176,17,36,5,250,199,94,156,208,189,48,229,112,47,148,97,83,91,61,244,14,75,2,124,149,252,246,155,104,151,8,54,21,243,85,145,11,173,67,17,112,219,6,232,93,51,168,204,221,9,66,95,176,197,75,171,212,161,233,148,210,80,51,74,198,92,51,86,113,181,118,122,215,179,139,204,17,40,244,232,163,11,132,149,209,207,82,196,125,43,129,129,192,114,96,222,51,40,132,191,253,166,144,187,105,236,67,18,108,72,73,97,247,142,194,222,245,194,48,98,52,160,232,76,28,125,47,56,135,66,43,240,109,146,186,49,155,116,18,164,182,104,150,60,157,235,140,160,181,170,102,219,11,51,63,174,252,130,5,215,157,242,79,213,242,243,243,242,217,55,43,21,174,218,138,26,139,183,5,106,12,254,91,42,55,183,125,201,154,48,56,240,99,18,98,150,209,197,50,213,26,91,206,240,102,60,164,161,185,144,69,236,60,108,31,139,64,114,41,134,2,184,72,66,129,163,124,92,158,159,2,27,208,151,255,90,142,151,218,58,238,226,166,65,83,23,104,250,179,43,158,207,110,107,107,51,73,97,177,186,226,84,123,33,15,48,180,41,121,133,119,41,162,181,188,43,202,146,230,81,212,243,251,126,62,5,73,20,201,32,116,233,5,20,193,23,164,205,128,240,7,65,90,45,4,234,19,63,253,91,2,20,192,224,149,199,64,61,181,125,189,124,225,102,97,149,153,100,203,246,31,50,158,110,21,226,181,57,168,100,60,108,196,109,25,34,87,152,117,61,115,180,134,206,115,131,103,17,62,91,22,201,227,247,196,125,23,249,97,9,2,116,71,243,124,51,181,48,201,156,44,153,228,255,47,80,84,248,46,72,190,124,26,176,51,134,92,20,217,123,205,58,196,97,19,254,147,229,122,121,27,102,82,75,233,175,92,160,72,151,116,183,98,142,96,0,10,124,122,23,248,212,0,87,153,98,65,17,205,81,2,46,55,174,182,228,184,90,110,92,125,201,113,245,204,13,107,52,230,188,4,218,30,117,222,209,110,234,98,77,220,167,73,201,164,253,170,152,81,197,22,167,231,34,49,59,99,122,194,126,146,199,96,53,80,21,21,52,11,8,78,25,95,13,240,139,149,91,214,56,195,98,4,107,159,93,200,114,0,10,180,16,48,101,241,53,83,244,193,249,31,185,208,212,75,6,47,98,86,93,134,103,23,249,212,204,148,96,33,185,90,113,117,94,5,13,132,251,56,166,16,139,208,92,33,99,194,138,28,134,9,224,77,61,101,124,108,245,12,171,72,103,187,116,93,215,110,35,200,87,95,145,91,173,236,97,7,154,105,218,171,4,216,38,174,150,146,135,77,58,45,165,15,155,48,218,74,32,6,220,130,82,136,1,55,175,36,82,84,235,66,105,164,168,202,214,98,135,1,86,44,122,24,229,73,85,251,226,34,82,172,102,24,12,207,151,54,191,240,170,107,50,175,234,122,124,212,250,189,202,174,157,168,119,211,32,255,104,29,29,186,120,133,34,28,248,253,155,146,73,228,63,190,70,171,153,86,172,173,22,139,166,104,153,74,154,171,92,174,168,155,96,84,179,84,49,215,149,22,238,206,210,238,34,123,154,76,186,93,232,43,88,84,71,158,109,72,105,38,2,178,15,198,255,198,149,231,59,83,31,2,176,152,118,162,136,29,185,35,63,111,68,160,148,128,209,114,44,68,199,187,39,72,119,173,34,139,126,34,91,171,81,252,45,141,99,122,197,68,92,91,59,96,198,230,57,117,95,53,165,49,103,59,246,7,3,80,58,17,104,138,53,123,253,20,219,212,214,24,253,115,74,129,128,187,31,168,181,124,84,123,41,221,205,207,240,81,26,140,168,78,22,233,49,7,249,36,122,44,85,179,176,225,229,20,52,71,211,130,154,234,91,95,90,89,141,65,119,169,172,166,167,66,126,184,52,53,76,85,44,106,32,200,223,9,237,131,22,15,1,39,38,24,3,42,68,207,35,201,16,107,7,61,26,120,55,153,14,200,61,235,41,10,254,195,175,40,129,251,225,196,118,99,138,101,232,108,205,179,53,41,44,250,61,159,251,212,236,19,238,220,190,248,138,189,198,179,137,56,128,18,150,77,113,77,214,176,138,225,225,156,202,189,136,13,231,22,238,191,103,25,39,75,78,205,232,80,88,198,92,106,202,77,221,46,235,195,116,94,4,211,16,241,79,168,153,162,114,195,201,35,113,177,104,50,29,210,144,69,146,120,136,22,167,9,210,29,86,167,2,109,1,231,34,59,56,133,57,71,236,241,246,188,83,125,77,156,3,42,84,137,108,137,172,188,144,239,249,225,120,146,146,14,112,6,216,20,114,3,207,48,243,248,122,234,51,49,100,205,154,24,34,35,29,25,252,58,153,140,200,201,10,137,32,167,80,166,175,157,152,122,151,47,12,116,210,51,104,232,48,118,183,156,170,248,137,96,7,228,253,97,161,104,176,104,14,22,121,46,88,47,203,41,151,88,171,8,194,21,38,189,181,102,109,173,47,152,53,75,20,151,152,90,133,188,38,157,180,187,55,15,66,169,233,71,83,170,199,239,247,53,108,189,179,92,118,249,49,25,37,107,93,54,91,188,43,98,201,197,43,60,91,62,107,112,13,23,25,251,234,170,81,221,194,195,65,160,174,159,178,99,131,220,125,16,117,71,216,240,15,189,168,59,193,34,61,164,85,105,128,134,196,105,189,220,59,106,151,249,234,68,77,173,112,137,132,251,14,240,27,167,103,234,242,206,107,86,133,99,102,22,43,114,164,231,39,99,238,158,196,249,4,235,103,55,103,192,92,33,227,242,181,71,222,166,106,138,149,29,199,56,152,192,110,55,141,246,193,141,129,232,176,152,190,100,238,95,152,80,113,147,6,163,106,154,93,185,226,34,39,238,212,176,43,53,214,154,158,118,44,240,152,145,48,30,101,177,151,179,3,185,251,77,52,129,224,79,252,152,122,97,202,93,59,34,196,11,22,98,114,233,48,190,35,237,33,200,190,199,47,136,101,213,209,9,248,228,144,42,207,195,75,35,249,114,103,177,194,160,46,98,253,57,175,233,8,234,125,210,72,243,243,184,168,51,166,49,106,140,41,204,247,185,163,115,175,68,238,181,62,171,150,234,184,32,205,234,54,142,200,227,88,4,49,63,111,251,210,98,88,65,120,140,99,77,218,127,73,1,172,115,135,32,45,123,221,36,51,55,119,197,173,70,138,156,51,186,39,60,239,153,103,110,149,157,93,100,94,121,181,96,40,39,250,206,41,156,13,253,191,51,150,159,65,86,254,71,219,202,69,201,180,213,48,62,88,97,139,73,55,56,114,62,45,200,148,210,66,228,203,159,199,252,169,253,73,202,126,161,102,207,16,143,7,52,119,39,20,15,237,85,34,221,149,111,201,61,202,84,22,1,4,133,48,212,205,91,59,149,91,3,109,84,184,43,79,170,37,150,206,96,55,10,88,154,83,76,197,165,148,34,149,58,131,242,32,166,52,44,175,87,171,14,82,0,26,98,218,99,143,58,62,156,76,96,20,27,94,140,23,225,5,230,103,2,51,107,66,220,207,20,110,177,120,124,29,81,134,32,155,61,255,10,84,30,114,229,45,103,212,41,63,33,99,248,47,142,240,170,67,175,28,12,64,79,197,214,102,240,83,173,106,230,108,43,86,174,220,234,20,154,73,188,21,64,204,129,46,178,160,31,9,170,94,138,144,146,125,199,170,198,229,167,218,108,155,195,117,217,193,54,88,187,14,32,85,1,131,216,137,130,158,179,45,74,214,178,176,189,89,25,174,107,99,1,171,38,129,114,215,105,249,41,240,175,60,29,250,120,138,157,109,61,25,122,160,196,229,81,15,104,242,148,244,3,122,77,0,98,148,148,187,32,63,32,83,239,38,73,234,247,111,196,99,38,219,219,218,28,250,70,138,24,146,177,215,165,229,235,114,205,217,54,52,99,115,229,150,189,237,233,182,198,126,24,210,24,31,102,28,205,33,232,226,150,51,44,111,144,41,252,199,72,208,129,4,179,252,20,185,94,201,161,1,252,161,65,173,65,236,221,48,208,109,193,3,25,27,202,244,7,12,227,102,5,135,25,155,200,120,89,120,44,240,25,217,92,224,232,60,126,46,228,38,1,121,124,186,144,165,232,68,52,237,45,173,42,175,161,79,200,169,124,83,126,166,139,209,227,114,153,176,23,72,142,227,168,15,70,8,240,243,148,175,92,54,5,70,98,185,83,66,12,30,110,14,107,198,198,0,152,237,11,108,163,63,25,145,140,25,207,171,85,220,231,19,103,91,95,13,108,178,54,79,140,228,118,158,228,133,198,96,146,104,99,239,166,168,45,128,63,186,228,115,39,163,57,235,249,150,175,103,221,201,97,2,177,150,37,185,205,10,195,154,3,40,76,125,47,201,103,35,89,101,177,208,204,157,22,167,103,113,117,132,23,90,182,86,110,173,199,236,51,203,128,40,228,229,88,24,83,98,197,13,11,12,177,148,111,75,89,253,18,124,173,11,233,212,128,166,46,175,104,217,230,209,136,80,94,39,227,235,114,157,140,111,202,53,2,190,20,93,19,255,131,83,191,14,212,151,242,5,82,213,143,186,147,164,1,190,52,240,67,90,14,241,150,41,111,66,159,7,24,180,7,102,4,54,64,179,45,11,144,119,64,10,93,21,11,241,11,54,35,209,197,3,103,216,46,213,203,198,69,188,213,162,201,96,168,42,5,137,180,53,253,222,98,43,235,192,75,138,173,93,248,184,232,169,66,115,161,223,42,124,18,188,40,20,203,136,158,77,240,212,2,150,16,60,65,189,105,25,79,115,255,120,177,27,7,160,225,67,48,227,52,222,114,246,41,30,121,119,2,47,188,196,96,239,146,210,49,233,78,98,176,222,217,237,185,60,138,188,51,179,139,142,102,158,133,128,234,6,26,131,25,240,239,69,43,179,57,172,231,133,124,161,96,217,236,148,58,96,208,47,79,23,116,96,88,47,204,61,9,230,43,24,56,103,34,45,252,186,205,56,6,254,246,127,254,247,223,228,192,15,253,17,172,244,89,254,101,7,16,115,127,193,176,165,95,74,184,47,158,252,203,3,247,197,195,111,221,222,119,116,225,50,190,13,209,102,101,18,220,33,100,246,208,199,12,35,140,183,75,63,125,28,97,44,231,179,12,36,142,249,39,61,216,157,96,158,169,63,128,109,182,135,5,86,187,44,206,224,150,48,203,86,35,44,143,240,62,127,27,60,199,241,47,103,89,127,87,17,104,201,15,183,124,98,33,168,125,156,16,212,254,18,130,143,16,130,182,248,54,207,39,150,129,250,199,201,64,253,47,25,248,24,25,16,215,131,151,100,124,66,3,240,175,203,113,87,222,60,126,184,240,91,98,4,142,171,87,212,114,172,255,220,120,95,220,218,202,109,254,75,72,236,126,191,133,4,165,244,61,151,125,172,227,144,77,254,101,22,69,235,244,253,105,245,108,182,205,126,172,159,205,54,43,188,127,155,92,20,80,21,136,2,9,35,99,228,7,133,248,133,42,66,49,170,95,100,23,186,67,218,189,236,68,215,69,33,100,61,180,151,151,31,113,35,253,225,196,71,32,212,237,133,152,122,190,212,12,33,131,153,194,127,70,165,207,198,248,121,114,116,71,90,149,87,231,81,128,146,105,232,180,161,199,22,21,110,178,109,113,35,126,19,118,135,113,20,250,239,217,185,199,50,74,125,175,144,219,242,125,150,79,31,120,27,219,178,172,208,216,227,103,24,150,127,223,86,110,152,224,37,173,79,92,231,19,239,121,47,91,233,99,23,244,30,182,204,199,239,252,125,144,173,255,228,158,158,125,199,111,107,222,91,201,54,112,239,218,14,238,93,219,192,31,188,150,184,94,102,223,25,92,190,134,8,141,99,237,236,102,221,98,167,24,230,194,114,240,42,12,123,83,157,75,22,187,245,134,199,188,76,238,197,125,8,31,165,182,15,50,235,170,175,12,250,9,251,20,166,91,88,217,216,106,200,254,88,157,205,62,189,249,197,42,238,244,225,21,119,250,151,226,22,254,249,19,42,110,38,252,139,180,183,128,238,249,189,181,25,67,15,124,143,31,175,76,243,171,212,160,118,129,37,238,96,208,250,201,122,90,112,231,15,108,8,178,37,125,184,246,91,43,228,243,147,173,57,122,172,174,151,63,172,46,103,183,214,191,44,125,182,237,112,229,182,248,37,203,121,201,23,164,95,167,252,238,56,255,192,224,217,92,170,17,158,160,229,243,51,246,39,230,103,108,120,150,159,21,211,51,75,130,54,47,69,99,61,247,211,98,66,118,135,81,148,176,151,89,98,138,199,64,64,97,124,133,36,96,47,32,176,19,252,196,21,95,244,229,87,210,105,103,50,24,224,45,133,43,223,179,224,123,187,115,210,94,35,252,219,158,108,0,151,199,114,64,175,64,175,0,237,128,125,17,19,58,196,39,66,113,82,118,51,33,234,247,45,248,196,136,188,109,176,88,135,69,135,155,115,141,0,36,32,55,52,8,32,223,216,80,217,90,0,169,157,248,41,250,158,128,44,138,99,43,139,201,200,249,108,155,214,230,64,202,201,16,36,245,178,108,103,137,186,105,242,163,23,135,176,247,197,55,77,178,37,22,238,154,204,161,73,126,69,144,94,214,237,11,25,91,253,141,152,241,219,57,18,69,200,97,148,210,6,97,198,2,5,133,250,224,24,180,176,14,120,111,126,157,156,221,130,182,98,18,14,146,221,99,101,23,210,128,20,33,40,0,153,36,136,25,81,226,197,70,205,17,37,69,73,177,202,202,60,111,184,196,249,248,50,201,176,241,221,209,207,44,13,22,151,119,14,60,116,205,161,23,118,169,177,185,249,89,240,7,42,75,113,230,59,85,229,67,20,229,1,213,196,46,10,119,171,200,253,20,68,172,183,65,212,85,201,194,27,47,252,189,0,26,227,145,173,103,213,13,243,155,59,252,239,18,200,191,24,99,188,54,131,24,27,203,88,81,227,48,28,195,16,50,103,115,36,240,147,180,220,243,147,46,255,229,135,137,223,163,118,75,18,248,219,92,21,240,221,204,30,189,242,187,217,251,160,168,217,226,245,50,238,40,19,251,9,51,71,195,95,197,68,52,236,221,75,147,14,139,6,158,240,183,44,152,209,224,43,152,115,144,93,56,129,190,151,89,176,36,115,242,114,34,5,102,201,92,174,160,34,43,183,252,111,147,200,123,127,136,214,2,191,123,9,65,132,254,66,64,30,10,184,193,234,153,0,166,125,129,58,15,21,240,139,134,139,129,174,188,216,247,194,20,162,53,46,175,249,112,202,7,210,111,57,226,110,54,42,159,9,144,39,161,49,23,191,156,44,111,129,187,46,187,28,203,27,156,89,142,204,249,3,145,101,9,164,191,166,246,71,144,169,135,177,113,33,197,150,84,194,187,209,247,161,145,120,200,104,132,13,84,249,23,245,37,236,133,84,91,198,99,177,207,122,241,0,63,17,127,161,201,92,127,85,144,230,113,62,48,154,195,165,140,71,37,237,4,47,123,135,181,148,11,122,13,62,241,183,191,77,0,157,69,182,126,197,29,241,87,150,152,244,231,204,193,233,139,188,225,117,147,14,219,132,222,99,242,44,155,23,217,197,127,73,94,33,94,131,47,6,87,230,221,216,85,63,47,94,60,154,61,122,68,175,199,252,29,7,110,31,185,239,126,241,232,255,0,111,193,62,27,216,102,0,0,0};
+static const unsigned char v10[] = {31,139,8,0,0,0,0,0,0,3,237,61,235,122,26,57,150,255,253,20,39,181,222,25,220,77,21,24,39,233,132,24,103,29,135,164,61,235,219,2,233,204,180,199,19,139,42,1,213,46,74,116,73,24,211,14,223,183,207,178,143,182,79,178,159,174,165,186,128,137,227,238,36,179,195,15,155,146,142,142,164,115,211,209,169,35,225,76,41,6,202,146,208,103,206,139,141,112,60,33,9,131,91,24,85,97,196,198,81,21,166,20,119,25,98,88,124,107,15,6,216,103,226,107,7,15,96,1,131,132,140,193,241,188,154,231,213,250,211,56,136,176,247,11,181,241,28,250,36,166,85,120,53,101,140,196,85,232,161,62,181,155,29,144,241,132,196,56,102,84,182,219,168,213,224,128,196,148,161,152,81,64,113,0,62,137,7,225,112,154,32,22,146,120,131,99,99,112,112,122,242,230,240,45,180,224,118,3,224,117,251,205,254,187,163,222,135,179,211,78,175,9,207,234,245,122,213,42,125,223,85,21,207,121,5,212,106,240,26,15,208,52,98,240,30,247,187,196,191,194,12,248,80,173,38,189,195,227,246,207,167,39,237,38,52,182,69,139,119,189,131,239,235,63,52,235,117,168,28,198,1,241,71,97,140,182,172,6,39,189,179,15,221,118,231,167,118,167,219,20,67,2,152,36,225,24,37,243,38,56,19,66,34,47,102,19,143,36,67,167,42,42,41,246,73,28,200,106,22,142,177,55,36,100,24,97,207,39,99,5,193,112,194,66,11,96,22,198,1,153,81,3,177,224,127,206,246,187,221,247,167,157,215,31,58,237,255,122,119,216,105,31,183,79,122,102,0,227,48,62,194,241,144,141,154,240,76,226,28,33,250,110,50,193,201,1,162,184,9,181,243,125,247,231,139,154,169,58,34,179,180,10,185,191,89,85,39,211,113,31,39,180,9,181,191,7,105,105,119,130,253,16,69,7,35,148,240,38,143,254,227,223,54,255,253,31,127,250,174,178,85,245,94,58,205,219,197,199,221,61,137,67,140,117,255,236,80,208,245,244,93,175,9,219,117,205,139,237,186,34,6,221,0,232,180,95,157,158,246,62,188,110,31,237,255,173,9,59,26,102,199,2,225,172,252,208,217,63,121,219,182,230,217,132,109,57,170,49,186,105,194,211,39,79,118,158,152,126,143,247,255,250,225,232,244,237,135,163,195,147,118,87,246,204,139,127,108,255,245,195,217,126,175,215,238,156,52,161,246,143,74,253,230,188,238,62,223,119,223,32,119,112,113,219,88,252,157,126,183,245,221,102,77,114,127,18,32,134,3,152,32,198,112,18,3,35,48,70,204,31,129,83,191,113,96,146,224,65,120,3,3,146,140,145,45,68,188,211,227,118,239,199,211,215,124,120,182,220,49,2,221,118,231,112,255,104,99,33,229,189,23,142,241,111,36,198,48,70,147,73,24,15,1,37,9,154,43,81,215,194,248,225,244,172,119,120,122,210,133,22,156,111,0,156,111,87,193,121,215,59,112,183,27,66,46,95,161,43,156,192,33,141,80,28,108,57,23,124,142,231,13,13,178,45,64,246,199,56,9,125,20,67,23,141,9,210,64,59,26,168,46,128,126,68,51,20,134,186,242,177,170,172,63,151,24,34,68,175,76,203,39,186,242,153,168,60,67,126,56,8,125,49,27,13,242,84,131,72,229,57,38,211,152,161,48,206,192,252,160,97,158,10,152,3,28,179,4,69,25,144,103,26,228,137,0,105,35,42,24,97,131,60,215,32,143,229,72,89,132,98,150,27,205,118,93,3,237,72,154,37,136,134,81,104,38,180,173,105,90,151,52,237,146,41,27,193,91,76,146,161,5,164,169,90,87,84,253,141,36,152,154,90,69,206,239,235,146,156,111,143,123,166,234,177,174,218,206,76,180,61,77,200,4,163,236,116,182,159,104,224,70,102,202,229,192,79,53,240,142,34,51,245,201,204,212,254,160,107,37,105,222,78,163,1,116,25,226,6,40,200,226,121,166,33,159,40,142,94,133,220,16,155,250,231,105,253,142,180,133,41,93,26,117,93,249,84,9,100,60,140,80,128,233,200,64,108,107,136,188,41,213,0,13,13,32,37,234,32,83,105,40,43,101,241,47,104,146,142,172,161,105,171,164,88,147,107,127,74,57,141,173,81,106,186,42,157,232,146,136,140,73,172,20,199,176,177,161,41,170,180,235,4,207,224,103,140,140,114,93,72,197,61,34,67,24,99,54,34,1,144,9,95,158,104,70,117,83,19,144,87,94,78,171,215,135,221,253,87,71,109,77,219,42,56,210,42,88,202,219,253,91,183,215,62,206,117,200,208,144,2,27,33,6,92,151,251,24,134,225,53,142,129,141,112,152,0,153,197,16,225,107,28,1,98,144,76,99,190,120,100,26,146,193,0,39,56,0,94,21,65,13,77,194,90,68,134,188,170,54,196,12,162,144,50,142,29,3,137,49,5,159,140,39,97,132,3,8,245,202,107,155,183,222,254,91,49,35,231,120,255,240,196,169,130,211,233,189,251,112,188,223,237,181,59,78,58,29,254,237,224,199,246,235,119,71,178,248,125,251,149,250,215,61,61,248,207,118,143,63,188,22,69,122,186,114,174,103,56,113,25,26,170,233,40,250,86,193,113,224,10,227,137,28,164,30,159,27,198,16,72,243,106,209,254,168,253,83,251,40,79,122,71,244,39,97,21,169,57,55,218,157,206,105,199,226,197,251,253,206,137,197,137,195,147,55,167,150,193,124,221,126,245,238,173,230,203,96,26,251,124,112,208,157,83,134,199,149,45,177,50,213,106,32,220,38,24,163,24,13,241,24,199,124,117,144,131,59,71,62,11,175,113,15,245,171,64,49,219,215,79,23,208,50,238,86,197,153,82,156,56,91,47,210,86,33,61,34,40,8,227,161,104,117,168,159,50,173,88,50,197,217,54,93,116,157,54,145,15,153,22,3,20,209,92,147,14,166,140,36,105,43,243,188,186,225,24,83,138,134,88,52,58,150,223,51,13,110,129,205,39,184,9,156,5,12,223,48,254,13,22,91,47,54,20,185,4,249,178,254,30,80,222,50,237,130,10,152,3,1,34,250,233,90,5,217,206,22,246,208,34,50,236,161,33,21,77,142,228,247,12,116,94,172,229,160,100,99,198,93,86,41,61,0,183,16,6,77,144,188,169,66,132,250,56,106,130,243,142,226,4,228,32,28,233,119,24,72,174,129,22,36,183,183,208,197,140,133,241,144,230,97,103,184,79,133,71,106,53,120,143,251,208,197,201,53,78,150,54,27,32,159,145,100,110,53,122,35,75,160,131,41,102,10,252,66,211,249,13,230,206,11,138,34,160,37,20,55,211,30,112,48,155,188,208,2,68,231,177,15,149,45,104,237,41,247,203,22,196,84,248,0,88,50,87,16,26,159,79,98,150,144,40,194,9,180,32,198,51,216,239,147,132,29,152,210,138,106,105,200,30,142,49,153,178,195,0,90,188,151,158,124,172,40,24,80,163,72,177,122,136,227,171,108,85,13,132,220,37,120,150,235,169,170,36,119,211,174,18,76,39,36,166,152,207,112,134,66,53,247,138,35,204,163,36,18,183,142,78,213,76,9,148,221,111,130,243,150,155,48,83,60,194,40,16,190,114,10,9,224,240,89,226,152,185,189,249,4,59,77,112,208,100,18,133,190,160,119,237,23,74,98,11,193,34,253,74,195,97,140,162,166,61,71,89,164,65,22,214,68,34,140,18,77,35,67,186,180,62,28,64,229,145,158,167,71,174,182,172,1,178,81,66,102,130,37,237,36,33,73,197,26,249,229,27,36,236,63,35,146,38,165,34,211,132,205,91,131,154,43,236,148,246,240,13,91,92,26,68,134,181,139,44,225,3,196,144,33,186,65,193,41,146,149,6,18,97,47,34,195,138,211,193,62,14,175,113,110,87,216,116,170,2,85,58,93,227,182,151,14,216,88,21,37,193,182,148,87,82,186,112,37,143,209,24,55,5,114,79,63,166,12,154,32,74,103,36,9,164,73,227,46,62,137,255,204,56,70,83,37,119,186,84,40,112,202,88,241,184,173,240,170,167,106,174,186,145,169,110,228,171,119,50,213,59,105,53,83,187,9,85,175,31,83,0,28,163,126,132,3,85,175,158,44,9,230,187,97,85,41,190,167,85,51,171,106,150,173,226,221,88,61,194,75,33,79,175,185,109,53,133,91,208,132,120,26,69,105,171,136,12,143,149,30,9,40,243,156,1,57,226,30,0,77,65,228,51,124,252,8,183,11,91,21,196,127,240,197,222,172,130,185,40,111,101,108,16,151,34,81,92,113,132,160,75,145,230,27,174,82,169,118,170,32,145,188,72,37,69,45,107,150,144,168,37,77,64,90,106,44,214,55,75,145,68,189,199,197,7,90,173,22,56,194,248,137,81,56,22,20,192,75,112,58,248,215,41,86,6,48,0,50,101,30,156,69,24,81,44,140,42,26,162,48,246,178,141,132,197,215,122,26,17,20,148,78,200,41,210,106,16,198,40,138,82,75,157,177,230,233,250,206,245,22,96,161,23,144,253,32,72,229,251,26,69,97,32,181,74,59,66,102,9,81,117,248,76,3,183,160,162,27,90,107,136,176,77,105,121,130,217,148,111,179,147,41,126,193,187,107,143,39,108,158,118,24,82,137,23,42,49,1,127,132,226,33,222,146,106,175,141,249,175,211,48,17,14,87,186,108,67,214,114,55,13,58,47,18,65,18,216,107,233,229,162,52,170,226,153,112,74,213,194,35,100,161,9,151,102,126,227,41,101,220,37,71,12,56,199,24,108,222,174,135,117,193,103,146,32,159,225,132,66,68,226,225,165,97,86,181,124,2,43,241,218,161,30,143,97,202,82,178,151,140,223,201,142,159,47,55,124,147,110,38,193,67,19,83,142,206,231,66,24,97,30,6,113,62,119,124,38,222,244,48,227,139,56,186,135,28,159,10,122,61,204,232,98,129,236,179,199,100,133,220,30,102,92,84,34,76,133,47,63,196,139,23,182,106,13,132,145,233,100,21,204,214,55,111,16,70,12,39,149,74,130,127,21,10,254,40,193,191,122,99,204,148,25,81,170,173,167,29,210,159,184,38,55,75,16,107,189,228,198,178,174,7,37,140,40,45,5,31,163,73,218,171,236,84,208,65,81,102,241,162,96,192,120,120,122,45,227,197,1,185,225,34,9,179,140,150,4,226,133,39,211,49,180,96,130,18,138,15,99,38,225,94,24,195,102,166,122,130,78,42,10,124,11,62,126,84,229,26,193,174,97,190,137,112,114,235,80,4,220,43,3,68,55,2,42,93,238,20,161,47,197,224,181,85,234,99,54,195,56,182,140,82,166,175,133,8,183,151,86,162,155,197,101,186,16,24,244,124,49,47,16,86,187,73,107,17,247,157,6,110,65,69,55,204,175,12,6,225,199,143,6,185,199,146,112,92,217,202,72,73,97,246,142,193,238,163,56,38,130,6,152,47,38,142,61,23,222,135,65,171,240,237,194,78,166,55,189,72,64,99,85,47,121,58,239,8,130,54,234,150,109,47,244,252,168,246,15,30,109,223,119,127,174,187,207,63,184,23,223,111,214,164,106,27,106,172,158,22,144,56,154,27,229,150,182,143,86,149,193,161,85,152,198,124,59,226,243,24,101,85,12,103,52,159,140,112,156,29,200,42,118,158,244,206,148,199,185,22,67,79,122,103,106,183,218,130,138,108,151,231,167,194,246,241,163,194,187,30,47,173,113,220,197,205,12,77,61,247,226,251,191,123,234,249,226,182,81,93,104,10,171,209,21,187,58,140,165,131,97,117,41,195,251,107,17,173,139,174,177,216,93,143,73,16,14,194,252,94,133,26,146,141,16,127,93,198,193,87,236,175,107,53,248,73,145,214,114,129,6,16,178,63,83,232,99,238,188,74,31,40,48,211,183,99,36,94,234,86,101,119,227,186,252,167,148,167,173,130,191,182,4,149,246,135,51,126,91,138,200,83,102,221,222,98,150,186,206,75,157,103,229,62,151,12,82,250,239,212,251,133,132,113,133,71,242,172,149,111,97,6,166,153,147,238,58,33,221,123,218,20,85,107,87,0,131,16,71,226,5,83,206,139,12,222,136,10,245,166,17,50,155,194,188,13,203,82,203,232,175,30,160,218,87,217,203,74,182,133,0,48,224,179,187,192,103,25,112,179,165,44,40,98,182,149,130,203,181,107,172,217,174,145,107,183,179,102,187,157,116,25,182,104,44,121,9,45,56,237,255,130,125,230,241,23,34,33,166,149,44,237,183,84,143,198,183,56,255,160,54,102,23,66,79,196,87,120,212,106,9,85,52,208,194,33,56,23,124,205,128,95,110,222,138,194,5,143,90,136,242,197,165,142,27,112,129,86,2,102,44,190,101,138,62,121,255,7,151,150,122,105,231,69,245,106,203,240,226,50,191,53,203,74,176,146,92,43,130,187,44,212,198,227,230,9,158,160,4,231,34,30,83,17,13,201,152,0,89,20,24,227,83,22,248,40,21,233,116,150,158,231,149,219,8,248,211,159,224,214,138,143,148,3,45,44,237,53,2,92,38,174,37,177,145,50,233,44,137,145,148,9,99,89,172,36,3,183,34,102,146,129,91,22,59,41,170,117,33,134,82,84,229,210,168,72,6,108,117,116,36,15,90,26,37,201,4,62,77,84,77,202,84,49,252,145,145,144,124,208,244,27,143,231,210,101,241,220,179,211,238,239,21,208,237,147,96,222,132,191,116,79,79,60,158,112,19,15,195,193,188,146,37,242,31,31,253,181,108,49,143,218,22,195,177,220,148,85,172,181,117,189,112,49,229,110,208,90,97,98,79,155,196,59,131,198,171,12,48,157,250,62,166,180,96,130,29,253,214,68,75,51,40,200,193,52,138,230,158,126,235,52,11,163,8,18,220,39,68,36,104,112,126,206,149,103,69,61,207,115,74,136,206,51,149,56,221,173,88,47,95,88,210,177,102,194,202,149,73,130,175,133,136,91,99,247,60,143,23,47,137,40,155,46,51,125,246,146,112,56,196,137,246,76,213,152,209,128,241,50,51,53,65,255,156,82,112,192,131,79,212,90,217,170,183,150,238,230,123,248,44,13,230,168,58,171,244,88,130,124,17,61,214,170,89,152,240,122,10,154,163,105,65,77,237,169,175,173,172,153,70,119,169,172,165,167,74,126,164,52,53,179,170,88,212,192,90,13,58,120,144,96,58,18,239,223,39,104,136,149,232,33,160,35,30,108,8,112,132,230,169,14,232,57,219,123,26,254,145,9,109,94,68,36,177,189,4,243,184,117,58,230,69,85,11,139,157,21,118,159,32,63,149,139,219,55,31,226,183,120,54,85,175,182,148,101,51,92,211,65,175,162,63,185,36,212,175,156,201,165,145,254,31,197,22,85,236,102,179,238,164,178,140,185,189,172,52,117,7,162,142,239,255,149,247,125,141,162,41,206,238,105,165,225,148,174,187,26,52,204,70,56,22,174,39,127,61,151,240,52,148,57,207,134,51,158,185,130,243,56,59,36,133,37,71,202,29,244,101,185,6,150,56,71,88,169,18,180,212,54,190,176,65,12,227,201,148,65,31,81,206,166,88,26,120,129,89,58,228,179,80,136,161,40,182,196,144,51,210,209,222,178,147,202,136,238,172,176,115,148,20,74,245,181,159,96,116,245,34,131,78,175,12,22,58,238,236,151,188,134,9,169,98,7,79,219,41,68,25,86,245,33,92,213,21,227,21,155,208,53,198,170,188,118,131,201,46,109,148,150,238,172,232,53,221,89,174,209,181,241,145,179,116,178,50,181,30,132,82,198,191,182,186,41,1,155,125,54,65,85,86,83,105,47,139,220,174,245,115,118,170,162,116,221,93,232,93,142,77,206,173,145,187,240,139,166,52,4,42,18,176,181,149,137,154,241,151,142,16,198,33,19,175,35,114,9,41,38,241,60,179,140,4,196,159,242,224,191,199,66,22,113,123,227,116,95,29,158,246,92,57,58,21,171,43,100,177,232,37,70,84,168,84,32,89,182,168,194,249,133,201,70,234,201,52,59,156,250,89,195,144,39,21,226,160,42,138,21,99,40,55,86,115,206,3,94,152,40,187,206,95,80,208,108,38,141,234,170,52,200,87,76,150,89,185,131,177,18,246,156,108,48,46,227,226,103,99,96,235,39,92,112,76,251,60,141,209,11,169,248,175,222,224,163,33,221,226,251,122,243,84,26,36,1,43,197,202,106,152,11,197,221,235,45,125,164,146,24,243,203,118,102,201,122,35,34,181,98,101,229,81,91,8,66,58,145,30,137,98,134,168,23,105,88,45,224,3,44,188,111,144,101,38,238,92,219,119,50,47,175,120,181,199,200,17,241,81,132,187,98,27,87,201,202,178,90,53,85,90,22,39,51,102,185,149,82,37,104,137,252,172,82,145,176,94,29,61,18,234,144,140,83,119,219,217,79,48,204,201,20,232,84,125,153,161,152,73,111,142,35,228,217,58,170,115,237,35,188,132,222,40,164,128,100,166,98,26,65,159,198,1,137,177,113,54,100,248,44,31,18,47,70,161,76,70,224,63,103,206,151,162,222,23,221,92,124,29,89,95,19,156,112,141,201,10,243,125,18,190,238,181,119,127,99,247,106,237,110,61,232,141,76,106,151,218,186,11,167,113,249,86,253,91,219,182,40,194,115,187,151,165,253,183,180,103,113,238,16,164,117,83,146,82,115,115,215,86,37,19,21,201,25,221,142,220,234,46,51,183,198,206,174,50,175,50,64,100,220,130,151,78,225,253,225,255,59,99,249,21,4,98,254,104,91,185,42,126,82,106,24,31,44,150,41,164,59,164,170,219,48,30,26,45,228,124,249,231,49,127,102,126,154,178,223,168,217,203,136,199,3,154,187,14,230,137,29,38,118,226,235,99,180,27,169,202,114,0,69,33,238,234,230,173,157,9,167,224,27,182,149,207,102,208,88,250,195,3,18,137,45,107,49,250,162,165,148,83,169,63,116,135,9,198,177,187,93,175,59,156,2,253,161,155,224,64,60,218,248,120,103,10,227,134,54,19,171,240,114,120,133,249,153,194,44,138,56,238,103,6,183,26,60,63,175,172,93,144,221,32,188,6,63,66,148,182,156,113,223,125,12,19,247,49,36,132,167,195,4,110,52,132,205,91,53,181,5,108,222,154,81,45,156,61,195,202,205,91,155,66,11,141,183,22,132,215,18,232,50,117,250,57,65,205,233,28,45,217,119,140,106,226,62,181,122,219,29,109,235,10,49,193,198,77,4,3,18,51,183,79,162,192,217,83,111,41,244,187,140,221,218,104,219,106,27,132,215,150,4,234,89,51,247,41,244,135,238,108,20,242,76,135,116,234,116,132,2,50,115,199,1,76,220,167,48,136,240,13,132,12,143,169,235,227,152,219,132,95,166,148,133,131,185,122,76,101,123,207,234,195,158,72,17,3,157,32,31,187,55,110,195,217,203,104,198,238,230,173,56,14,238,117,39,97,28,227,132,63,44,36,154,19,52,198,45,103,228,62,129,153,251,68,136,137,219,143,166,216,125,202,185,94,203,161,161,19,20,103,168,53,76,208,92,128,238,41,30,104,223,80,111,127,60,207,219,173,241,102,153,73,164,188,44,60,22,248,204,217,92,224,232,50,126,174,228,38,140,251,28,116,5,75,249,34,98,105,111,101,203,172,26,118,135,146,202,115,247,153,45,70,143,92,23,196,105,164,179,132,12,194,136,159,53,146,91,62,215,205,10,140,198,114,167,132,100,120,184,59,106,100,38,22,13,229,188,198,56,8,167,99,72,153,241,188,94,231,243,124,236,236,217,163,217,173,141,26,203,196,72,79,231,113,94,104,50,76,82,101,226,160,147,153,66,68,252,43,217,55,29,47,25,207,15,114,60,219,78,14,19,192,158,142,194,238,214,4,214,28,64,161,235,123,73,190,104,41,130,201,133,98,185,104,73,122,22,71,7,50,104,214,218,188,45,77,197,88,148,52,32,177,140,192,183,54,111,43,34,184,81,2,3,37,17,251,74,26,178,174,2,246,24,74,134,152,121,50,58,89,214,143,69,4,119,27,38,55,238,14,76,230,110,3,250,36,225,75,147,252,39,169,191,83,175,27,249,26,7,48,32,254,148,54,201,148,69,97,140,221,152,103,34,203,34,190,230,185,13,251,65,24,129,39,245,122,25,101,116,158,80,161,170,86,66,252,130,205,160,182,120,240,30,246,42,59,110,38,89,115,171,104,50,160,104,54,150,21,253,222,98,171,67,255,107,138,109,185,240,73,209,51,239,22,10,245,165,194,167,193,139,66,177,142,232,149,9,158,25,192,26,130,167,168,55,115,249,11,252,63,94,236,38,17,242,241,136,68,1,78,90,206,17,230,89,14,253,8,197,87,220,217,227,7,147,193,159,38,9,142,211,12,203,60,138,252,98,86,46,58,150,121,86,2,106,27,104,238,204,140,89,137,149,217,29,237,228,133,124,165,96,149,217,41,243,78,201,78,176,47,232,192,104,167,208,247,52,90,174,96,79,235,117,208,22,126,187,204,56,70,225,222,255,254,247,255,192,113,24,135,227,233,24,158,229,15,196,236,214,162,112,69,179,181,15,174,220,23,79,254,128,201,125,241,200,204,236,251,182,46,28,216,40,67,180,91,155,70,119,8,89,185,235,147,117,35,50,71,149,191,188,31,145,25,206,87,233,72,156,201,59,127,68,222,184,220,169,63,128,109,46,119,11,74,237,178,122,237,186,134,89,46,53,194,250,173,237,215,111,131,151,44,252,235,89,214,223,85,4,186,250,102,167,47,44,4,141,207,19,130,198,191,132,224,51,132,160,167,46,239,250,194,50,176,243,121,50,176,243,47,25,248,28,25,80,41,228,107,50,158,226,8,251,69,206,151,114,87,103,167,63,156,251,173,49,58,213,244,24,99,142,245,95,27,239,139,83,219,188,205,95,149,38,206,128,148,144,160,194,126,147,178,207,227,56,176,43,175,22,50,180,102,191,157,215,47,22,123,226,203,246,197,98,183,38,235,247,224,178,128,170,64,148,221,154,100,228,39,185,248,133,40,66,209,171,95,101,23,252,17,246,175,250,228,166,40,132,162,6,7,121,249,81,167,22,30,78,124,20,66,219,94,168,174,151,75,205,200,125,12,51,247,113,54,210,87,198,248,101,114,116,199,182,42,175,206,227,136,75,102,70,167,51,122,92,162,194,109,49,45,105,196,231,177,63,74,72,28,254,38,222,123,172,163,212,247,114,185,75,46,251,249,242,142,119,102,90,37,35,204,204,241,43,116,203,127,236,153,101,24,120,194,221,23,142,243,169,187,0,214,141,244,137,156,204,135,13,243,201,52,207,79,178,245,95,124,165,23,23,125,182,150,157,92,47,3,71,55,229,224,232,166,12,252,193,99,137,219,174,184,136,116,253,24,34,192,238,196,122,119,179,93,98,167,4,230,194,112,120,42,140,184,205,64,74,150,200,122,227,175,121,133,220,171,124,136,144,75,237,0,249,216,51,215,144,134,84,220,149,235,21,70,54,41,53,100,127,172,206,166,119,243,126,179,138,59,123,120,197,157,253,75,113,11,159,127,66,197,77,133,127,149,246,22,208,61,191,183,54,115,215,131,223,245,192,179,228,101,246,60,116,133,31,155,247,59,32,255,102,157,21,150,243,7,54,4,233,144,62,93,251,75,35,228,203,55,91,75,244,216,156,40,120,88,93,78,15,42,124,91,250,92,54,195,205,219,226,85,183,203,54,95,0,149,115,121,14,64,222,86,121,177,148,106,32,55,104,249,253,153,248,207,247,103,162,121,186,63,43,110,207,74,54,104,203,182,104,112,127,45,6,56,24,17,66,197,249,165,4,243,215,64,100,202,248,169,161,72,156,57,17,111,240,169,167,174,252,150,41,233,184,63,29,14,121,150,194,117,136,74,240,189,219,239,244,170,32,111,195,21,13,164,60,186,242,38,220,136,136,182,85,32,9,168,59,132,121,167,34,51,129,12,6,37,248,84,139,188,109,40,177,14,171,94,110,126,97,35,32,143,219,220,207,8,192,48,9,3,241,199,245,73,68,121,1,154,148,218,134,205,219,243,18,2,122,158,199,115,255,186,152,85,202,170,5,128,190,97,118,89,189,186,227,226,10,207,105,101,213,81,253,173,50,12,23,37,165,23,203,195,27,104,152,198,55,74,199,115,127,31,73,181,183,23,210,153,187,211,88,178,169,230,81,20,52,92,148,47,165,41,178,101,246,88,126,150,89,101,73,181,151,222,57,67,195,11,120,249,18,28,167,204,94,202,79,49,242,121,187,20,86,39,171,69,146,45,45,184,45,94,116,145,231,154,188,97,108,217,71,28,209,202,216,118,153,234,230,108,173,28,6,63,254,21,97,134,213,72,196,68,87,117,179,0,28,81,124,7,74,11,151,125,109,89,110,233,89,217,205,138,186,37,75,157,58,44,87,85,189,175,64,191,88,142,253,139,39,156,192,146,245,79,126,228,42,152,185,116,124,249,34,40,63,235,47,133,242,243,217,11,162,252,148,250,21,176,114,113,132,101,190,47,255,172,21,25,125,56,191,249,39,156,244,9,13,249,165,160,60,5,150,4,211,8,123,194,121,85,26,203,175,191,17,9,228,56,0,68,129,18,18,243,255,108,132,11,184,116,130,160,104,195,239,76,8,238,189,33,182,2,114,115,28,69,100,198,147,54,148,80,70,238,99,253,85,213,61,174,215,117,26,71,201,234,153,179,207,101,94,108,14,196,165,163,36,140,175,220,114,23,197,100,94,190,71,73,28,198,195,213,153,151,233,16,11,185,151,75,121,153,91,117,35,119,167,124,32,147,210,253,151,234,241,135,37,30,22,192,9,97,184,9,194,162,112,199,9,135,108,132,173,48,7,73,114,63,231,35,78,5,149,98,82,27,70,113,174,67,36,104,251,36,142,177,207,96,74,57,102,142,146,47,246,214,198,140,22,61,167,82,223,105,153,148,175,145,47,182,78,112,56,115,169,251,87,22,22,86,201,172,199,136,111,85,99,20,251,56,51,185,229,81,225,79,84,150,98,207,119,170,202,167,40,202,3,170,73,185,40,220,173,34,247,83,16,53,222,38,152,163,3,133,19,160,242,156,28,78,120,10,19,42,213,141,236,61,133,242,199,183,242,7,69,51,199,72,57,198,102,137,18,148,105,70,154,28,38,60,242,37,147,19,63,64,226,6,33,245,229,183,48,166,97,128,203,45,73,20,238,73,85,224,215,83,4,248,58,244,211,43,49,184,102,171,19,218,114,157,164,229,25,87,18,141,188,141,130,163,17,215,79,100,233,176,170,97,71,158,58,84,7,194,249,8,150,36,118,21,50,178,238,101,22,74,28,119,157,172,143,227,192,248,237,5,21,217,188,149,63,191,150,95,148,73,124,16,133,254,85,107,243,214,62,32,151,135,10,66,42,222,239,181,54,111,173,159,6,201,67,69,50,241,126,53,208,53,74,66,20,179,150,51,147,242,154,119,178,66,159,196,45,71,157,85,226,202,151,5,200,147,48,211,151,60,172,163,79,69,121,158,56,44,34,11,114,251,130,221,90,62,65,96,93,2,217,199,182,255,8,50,5,220,129,46,132,156,53,149,248,89,161,251,208,72,61,164,52,226,5,216,172,47,230,103,70,86,82,109,157,21,75,92,133,42,119,1,84,253,2,224,210,245,170,32,205,147,188,99,180,132,75,41,143,42,86,70,75,122,141,71,37,231,139,102,248,36,47,192,201,2,216,44,42,171,55,220,81,191,241,151,165,191,100,14,239,190,200,27,249,30,161,47,38,97,215,100,121,150,246,203,217,37,191,105,94,113,188,25,190,100,184,178,236,4,139,249,122,249,98,99,177,177,129,111,38,242,204,159,180,143,114,237,126,177,241,127,124,179,69,55,9,114,0,0,0};
 
 static const unsigned char v11[] = {31,139,8,0,0,0,0,0,0,3,181,26,107,111,211,74,246,59,18,255,97,176,162,43,231,110,108,167,97,219,133,244,177,202,45,5,34,65,65,52,44,72,192,165,78,60,73,12,142,237,157,153,52,141,114,243,223,247,204,195,246,140,61,73,11,151,173,104,24,143,207,57,115,222,143,73,227,69,158,17,134,54,104,222,65,115,182,72,58,104,73,241,21,11,25,22,171,139,233,20,79,152,88,190,195,83,180,69,83,146,45,144,227,251,1,252,27,47,211,40,193,254,55,234,28,63,124,16,23,132,134,147,44,165,29,244,199,146,177,44,213,49,206,51,0,73,113,202,168,66,121,248,128,131,50,116,254,230,242,249,240,5,58,69,155,135,15,16,122,61,248,248,245,213,155,23,95,95,13,47,47,174,250,232,160,219,237,118,248,254,203,139,143,95,223,14,70,163,139,119,151,125,20,252,233,118,111,63,117,189,167,3,239,121,232,77,191,108,122,219,207,244,247,246,239,173,64,192,14,222,14,191,142,134,175,47,222,188,31,73,10,221,14,10,2,88,33,138,225,204,136,114,160,103,23,207,7,239,95,141,190,126,184,250,250,246,205,59,0,124,42,143,218,10,214,166,203,116,194,98,144,224,85,54,163,110,91,242,38,249,253,180,192,148,134,51,208,16,197,236,181,92,127,1,246,11,205,185,27,196,214,57,238,35,199,233,32,134,111,25,95,161,109,251,88,35,17,83,160,59,139,211,217,69,26,142,19,28,9,90,195,218,166,65,116,26,38,20,27,52,18,224,76,224,113,22,13,216,79,95,12,192,21,61,207,210,20,11,121,4,194,7,109,195,64,76,151,73,98,242,153,230,75,246,44,100,161,100,176,120,50,144,28,167,38,218,75,124,251,159,48,137,11,161,138,71,3,137,145,37,174,49,249,22,28,72,177,199,151,6,184,244,17,191,102,179,134,74,195,8,180,87,234,82,60,237,61,21,84,56,2,3,13,8,14,185,127,159,42,71,47,245,192,33,193,113,158,99,54,153,35,186,166,12,47,56,230,52,158,45,73,40,220,131,101,104,134,25,250,128,199,87,217,228,59,172,120,24,84,7,76,57,230,149,64,60,23,120,112,70,72,215,233,4,129,79,157,158,73,183,66,136,145,117,177,44,48,225,147,145,44,73,48,1,148,20,175,208,96,12,148,207,203,93,87,202,81,33,176,120,129,179,37,27,70,0,15,10,24,201,71,183,0,66,234,196,138,174,31,114,138,110,187,83,129,40,53,107,241,83,188,43,180,81,157,71,48,133,120,166,152,75,180,10,99,37,171,235,4,97,30,7,82,87,1,168,6,98,96,83,29,176,192,108,158,69,16,16,47,46,70,142,118,240,28,135,17,38,180,175,195,34,228,112,113,33,99,120,35,136,39,7,176,194,60,79,226,137,208,124,240,141,102,169,78,98,171,173,105,60,75,195,164,175,11,43,183,74,152,173,33,80,130,67,82,40,172,212,163,14,17,79,145,251,168,144,216,207,190,183,117,70,217,156,100,43,97,163,11,66,50,226,234,34,92,63,15,99,8,101,238,39,211,157,94,212,71,173,77,73,156,130,167,46,41,119,203,237,117,69,169,178,246,182,110,136,8,2,178,52,66,73,134,171,71,243,145,50,172,92,14,238,175,68,182,254,235,47,180,47,176,224,44,4,202,6,166,93,204,5,107,155,62,154,65,242,23,251,174,35,228,150,2,66,200,217,101,4,71,144,84,116,158,84,250,116,117,109,202,220,41,96,117,251,138,76,170,171,86,64,248,105,184,0,23,60,61,69,142,8,16,193,137,163,131,33,244,111,228,188,195,255,93,98,21,36,17,2,243,250,232,45,24,29,188,151,135,94,56,11,227,212,175,97,1,15,149,237,18,72,38,86,177,28,211,163,164,210,166,49,184,90,162,133,180,158,144,244,76,46,172,9,31,202,211,164,61,33,104,202,116,242,158,36,96,90,35,87,72,160,156,100,44,155,100,252,237,42,78,163,108,229,39,153,12,12,191,122,197,181,50,103,44,167,125,135,43,97,69,249,162,207,23,125,71,157,79,48,91,146,20,93,183,54,5,218,54,8,90,155,58,205,121,70,25,215,244,182,15,239,132,31,109,131,21,189,62,110,114,63,145,149,165,74,136,53,246,121,36,233,5,169,173,88,40,131,77,146,89,81,41,122,77,25,165,71,23,80,42,57,150,48,174,64,172,66,119,69,253,44,205,114,156,214,249,168,124,24,138,128,235,84,252,42,1,132,221,185,211,150,4,239,225,180,116,57,153,192,203,134,219,34,43,125,5,61,133,98,179,182,249,145,41,132,234,58,184,28,248,6,146,162,41,140,106,3,92,55,39,248,134,175,204,215,133,194,64,87,175,75,58,5,168,159,224,116,198,230,232,12,117,193,77,174,63,167,173,141,56,193,231,169,98,123,13,30,83,61,30,91,40,114,26,64,238,83,69,188,131,124,223,47,200,127,209,112,184,245,21,70,117,170,202,65,70,231,215,54,43,129,114,211,2,149,66,21,192,46,116,117,86,84,237,188,109,181,52,73,28,27,234,214,211,188,217,19,248,147,37,33,66,219,26,63,118,16,159,78,120,173,25,101,57,40,163,171,231,107,139,53,39,73,38,74,231,253,124,50,138,105,233,54,78,45,169,87,161,164,181,111,119,122,170,61,189,162,29,103,250,104,192,32,245,229,140,103,119,72,135,4,171,87,96,102,139,231,74,69,214,123,92,67,133,90,135,82,207,24,29,244,24,58,241,246,29,10,20,2,136,96,144,165,201,166,69,85,157,42,153,196,198,175,169,68,150,144,230,253,96,13,88,83,9,112,45,140,238,54,227,187,110,199,21,109,91,50,107,101,144,31,72,174,155,234,248,106,187,198,200,126,71,178,84,168,121,200,39,63,101,221,17,252,151,200,180,84,216,185,98,200,50,213,148,96,199,21,207,106,11,253,246,27,122,84,246,241,102,187,97,200,93,233,16,97,40,166,21,160,69,71,166,152,34,73,22,243,145,85,56,138,211,104,64,39,113,252,76,246,85,13,5,63,210,85,201,123,168,71,229,148,228,51,18,47,220,118,163,166,25,253,189,97,9,126,154,91,226,27,172,150,211,86,57,97,253,104,67,198,137,243,136,29,92,157,15,135,162,79,252,85,190,95,117,70,252,12,237,0,91,29,179,235,24,198,194,255,151,134,149,151,138,185,19,218,62,56,162,142,239,83,24,36,152,27,124,166,255,8,234,131,84,76,197,184,10,88,37,5,31,10,32,89,187,46,108,212,235,42,231,23,182,125,150,189,202,86,152,156,135,60,176,120,19,79,24,253,16,51,24,136,186,183,78,219,94,206,130,63,235,183,24,173,192,103,208,167,54,41,238,47,106,193,159,59,201,104,121,180,49,208,40,73,239,61,204,56,195,244,70,168,230,229,197,71,52,205,200,34,132,62,250,61,196,159,92,247,81,247,182,123,192,63,122,8,188,143,47,123,200,237,65,80,206,98,70,81,14,163,236,120,205,112,91,107,180,247,140,53,28,180,104,239,222,199,41,123,50,32,36,92,107,252,84,214,89,132,185,213,54,5,169,27,14,38,237,121,135,157,234,131,67,30,18,138,135,169,52,136,236,58,122,237,14,58,56,170,65,246,13,72,1,160,41,187,80,120,76,47,195,75,87,112,211,230,110,45,249,58,129,182,171,124,56,67,189,195,195,154,183,52,141,114,93,24,2,14,147,136,124,132,132,135,237,181,238,40,134,86,53,119,17,24,186,67,149,210,232,92,55,243,148,48,201,157,57,10,153,215,62,218,165,139,122,87,166,155,61,247,100,63,155,234,184,103,238,78,116,26,87,198,20,246,115,89,80,14,160,197,109,224,125,242,158,44,156,66,105,231,176,150,221,188,242,7,179,104,150,122,149,111,181,90,249,168,186,96,107,215,38,204,191,173,114,203,56,199,175,70,6,73,99,10,221,97,251,102,133,221,205,216,61,217,42,248,9,2,196,27,3,72,229,49,139,195,164,118,15,7,138,229,4,151,57,7,45,111,174,93,131,231,40,155,44,23,188,81,103,49,19,29,139,115,245,199,240,205,200,227,28,23,243,112,227,194,174,108,31,84,236,212,26,246,125,13,199,86,242,223,65,82,27,74,8,21,84,218,149,225,106,14,227,169,41,78,76,197,149,3,148,88,46,88,34,27,40,190,171,58,165,61,82,42,31,81,77,20,111,169,246,52,226,187,121,47,88,215,174,85,235,116,74,169,138,11,193,52,194,164,26,47,155,92,169,80,241,185,137,219,229,64,6,189,166,49,212,143,103,231,89,34,122,251,18,30,156,67,222,102,20,3,54,191,206,24,207,188,25,193,56,245,14,186,93,113,173,1,27,4,71,226,209,32,200,143,83,36,11,185,247,83,230,8,138,246,19,69,91,108,113,234,79,42,234,74,0,254,189,73,121,83,119,18,197,55,16,52,33,165,167,206,98,236,253,19,229,240,75,178,37,168,38,242,146,25,100,105,37,222,22,150,37,99,91,231,172,74,46,173,141,174,167,178,216,159,4,64,90,129,153,23,47,197,176,101,118,205,119,113,151,123,71,250,169,39,243,131,226,141,144,181,119,155,64,89,79,153,55,206,146,200,57,147,33,33,190,13,57,9,230,7,58,34,208,52,74,174,18,158,121,71,96,74,111,53,143,25,214,53,64,231,97,148,173,188,69,4,170,57,66,211,4,42,24,64,44,168,55,129,208,132,22,225,219,146,178,120,186,86,143,90,175,112,166,159,162,75,210,164,65,243,112,130,189,91,175,231,24,72,128,214,218,136,47,168,252,171,60,6,207,39,252,97,43,233,92,134,11,124,234,204,189,67,180,130,95,161,131,49,164,94,239,136,123,64,80,167,3,39,164,134,190,102,208,156,8,216,179,34,242,140,136,134,65,249,36,224,72,166,20,154,77,155,207,22,139,75,131,55,77,187,211,176,123,205,138,192,67,143,118,219,150,95,74,107,33,237,182,181,110,66,63,240,78,43,59,53,119,41,16,165,153,214,38,192,93,182,45,252,99,140,217,10,34,180,97,225,121,207,16,24,120,17,242,46,112,20,47,23,168,178,213,83,110,43,83,244,94,157,214,207,57,25,32,38,225,24,39,187,81,39,75,66,51,226,229,89,44,124,188,129,15,20,196,196,210,220,151,61,201,169,51,153,227,201,247,113,118,235,216,64,196,75,28,157,182,54,245,148,189,181,129,103,169,108,70,0,222,149,141,136,101,192,119,33,29,133,100,134,153,175,168,183,173,180,148,200,115,200,122,43,248,53,194,8,12,49,89,210,62,1,154,114,239,16,246,198,25,1,23,147,38,121,12,207,202,135,44,114,213,99,80,168,73,143,195,69,226,245,228,137,84,55,244,191,184,161,165,252,72,137,100,9,69,65,45,16,118,107,236,55,245,8,101,181,14,100,36,90,141,102,107,35,191,11,223,165,122,24,42,190,131,230,139,70,203,10,118,19,146,56,76,217,169,179,10,73,10,92,88,173,30,67,194,57,117,70,36,164,115,158,214,44,48,22,5,34,116,206,15,70,112,178,133,247,160,169,243,235,26,131,245,20,86,237,236,10,105,81,183,193,46,135,93,61,97,64,157,108,132,50,183,97,72,112,88,231,129,224,41,104,204,188,133,109,232,77,157,182,242,248,253,58,154,123,79,143,84,34,200,210,172,244,146,130,23,72,6,154,199,64,7,81,171,219,13,101,194,161,81,150,38,235,250,190,104,215,37,115,212,255,6,241,205,155,227,6,111,121,2,169,99,14,25,24,19,75,144,54,13,1,61,201,135,48,22,183,175,48,106,35,65,220,175,127,97,197,127,160,83,81,158,94,244,140,44,67,55,49,12,142,234,203,43,142,234,52,248,161,108,157,64,82,137,98,34,199,189,62,74,24,57,174,209,63,59,9,10,131,220,105,239,59,35,198,18,45,182,202,208,240,9,75,82,230,31,30,255,190,171,64,178,36,228,122,74,30,39,208,238,150,94,96,47,16,34,111,216,34,70,92,91,13,237,249,121,87,10,177,240,189,167,126,8,248,157,21,160,168,1,156,85,107,38,168,220,176,188,247,178,166,21,158,127,132,28,245,204,175,77,168,85,222,151,147,232,14,66,82,176,214,230,90,88,227,0,229,183,222,99,148,131,45,84,130,47,99,9,58,2,89,6,178,37,75,226,20,123,105,150,98,189,50,244,172,101,162,181,177,159,139,144,54,15,139,169,64,214,19,222,170,31,22,115,129,89,98,118,168,108,91,207,108,197,143,30,172,16,93,188,126,203,251,78,136,196,226,186,1,129,154,102,126,199,188,0,3,196,56,21,14,213,182,158,105,43,104,119,21,12,189,100,24,55,213,59,160,97,62,21,225,7,224,198,173,234,14,240,178,208,228,36,94,132,100,109,229,219,202,54,66,87,229,77,176,85,44,75,45,249,113,113,213,165,241,47,22,86,254,85,216,207,136,11,246,191,191,176,205,82,41,127,128,91,205,135,155,157,133,202,150,232,36,55,58,219,162,201,41,92,253,172,54,56,158,4,249,89,163,92,219,185,104,238,153,120,130,195,191,147,207,155,93,217,161,45,187,238,168,93,80,113,18,143,255,233,134,94,197,212,149,15,124,136,191,104,65,163,57,174,147,19,96,171,24,202,255,24,203,155,44,224,91,220,182,104,55,42,133,211,248,63,162,146,221,131,90,181,230,35,155,152,152,240,173,248,107,155,8,79,195,101,194,144,250,250,249,127,107,203,244,166,123,41,0,0,0};
 
@@ -52,11 +52,11 @@ static const struct packed_file {
   {"/web_root/history.min.js.gz", v3, sizeof(v3) - 1, 1742263205},
   {"/web_root/bundle.js.gz", v4, sizeof(v4) - 1, 1721207150},
   {"/web_root/components/Components.js.gz", v5, sizeof(v5) - 1, 1742856569},
-  {"/web_root/components/pages/Devices.js.gz", v6, sizeof(v6) - 1, 1742823971},
-  {"/web_root/components/pages/Home.js.gz", v7, sizeof(v7) - 1, 1742826607},
+  {"/web_root/components/pages/Devices.js.gz", v6, sizeof(v6) - 1, 1792117881},
+  {"/web_root/components/pages/Home.js.gz", v7, sizeof(v7) - 1, 1792117157},
   {"/web_root/components/pages/Login.js.gz", v8, sizeof(v8) - 1, 1742550739},
   {"/web_root/components/pages/Network.js.gz", v9, sizeof(v9) - 1, 1742870865},
-  {"/web_root/components/pages/System.js.gz", v10, sizeof(v10) - 1, 1742870504},
+  {"/web_root/components/pages/System.js.gz", v10, sizeof(v10) - 1, 1792118711},
   {"/web_root/components/pages/Logs.js.gz", v11, sizeof(v11) - 1, 1742886982},
   {NULL, NULL, 0, 0}
 };
@@ -11,6 +11,15 @@ const CONFIG = {
   MAX_POLLING_INTERVAL: 65535,
   MIN_TIMEOUT: 10,
   MAX_TIMEOUT: 65535,
+  DEFAULT_SERIAL_PORT: "/dev/ttymxc1",
+  DEFAULT_BAUD_RATE: 115200,
+  SERIAL_PORTS: ["/dev/ttymxc1", "/dev/ttymxc2", "/dev/ttymxc3", "/dev/ttymxc4"],
+  BAUD_RATES: [1200, 2400, 4800, 9600, 19200, 38400, 57600, 115200],
+  PARITIES: [
+    ["N", "None"],
+    ["E", "Even"],
+    ["O", "Odd"],
+  ],
   DATA_TYPES: [
     [1, "Boolean"],
     [2, "Int8"],
@@ -52,6 +61,9 @@ function Devices() {
     da: 1,
     pi: 1000,
     g: false,
+    sp: CONFIG.DEFAULT_SERIAL_PORT,
+    br: CONFIG.DEFAULT_BAUD_RATE,
+    py: "N",
   });
   const [newNode, setNewNode] = useState({
     n: "",
@@ -59,6 +71,8 @@ function Devices() {
     f: 1,
     dt: 1,
     t: 1000,
+    db: 0,
+    oc: false,
   });
 
   // Edit states
@@ -139,12 +153,22 @@ function Devices() {
         da: device.da,
         pi: device.pi,
         g: device.g,
+        sp: device.sp || CONFIG.DEFAULT_SERIAL_PORT,
+        br: parseInt(device.br) || CONFIG.DEFAULT_BAUD_RATE,
+        py: device.py || "N",
+        // Advanced settings only editable through the API are kept as-is
+        ...(device.ta !== undefined && { ta: device.ta }),
+        ...(device.fb !== undefined && { fb: device.fb }),
+        ...(device.ri !== undefined && { ri: device.ri }),
+        ...(device.tm !== undefined && { tm: device.tm }),
         ns: device.ns.map((node) => ({
           n: node.n,
           a: node.a,
           f: node.f,
           dt: node.dt,
           t: node.t,
+          ...(node.oc && { oc: true }),
+          ...(node.db > 0 && { db: node.db }),
         })),
       }));
 
@@ -168,24 +192,6 @@ function Devices() {
         );
       }
 
-      // Call reboot API after successful save
-      const rebootController = new AbortController();
-      const rebootTimeoutId = setTimeout(() => rebootController.abort(), 10000);
-
-      const rebootResponse = await fetch("/api/reboot/set", {
-        method: "POST",
-        headers: {
-          "Content-Type": "application/json",
-        },
-        signal: rebootController.signal,
-      });
-
-      clearTimeout(rebootTimeoutId);
-
-      if (!rebootResponse.ok) {
-        throw new Error("Failed to reboot server");
-      }
-
       setSaveSuccess(true);
       setIsSaving(false);
 
@@ -193,11 +199,6 @@ function Devices() {
       setTimeout(() => {
         setSaveSuccess(false);
       }, 3000);
-
-      // Refresh page after a delay to allow server to reboot
-      setTimeout(() => {
-        window.location.reload();
-      }, 5000);
     } catch (error) {
       console.error("Error saving device configuration:", error);
       setSaveError(
@@ -343,9 +344,19 @@ function Devices() {
   };
 
   const handleNodeInputChange = (e) => {
-    const { name, value } = e.target;
+    const { name, value, checked } = e.target;
     let error = null;
 
+    // Publishing settings: report on change flag and deadband
+    if (name === "oc") {
+      setNewNode((prev) => ({ ...prev, oc: checked }));
+      return;
+    }
+    if (name === "db") {
+      setNewNode((prev) => ({ ...prev, db: Math.max(0, parseFloat(value) || 0) }));
+      return;
+    }
+
     switch (name) {
       case "n":
         error = validateNodeName(value);
@@ -424,6 +435,9 @@ function Devices() {
       da: 1,
       pi: 1000,
       g: false,
+      sp: CONFIG.DEFAULT_SERIAL_PORT,
+      br: CONFIG.DEFAULT_BAUD_RATE,
+      py: "N",
     });
     setIsAddingDevice(false);
   };
@@ -468,6 +482,7 @@ function Devices() {
               a: parseInt(newNode.a),
               f: parseInt(newNode.f),
               t: parseInt(newNode.t),
+              db: parseFloat(newNode.db) || 0,
             },
           ],
         };
@@ -482,6 +497,8 @@ function Devices() {
       f: 1,
       dt: 1, // Reset to default numeric value
       t: 1000,
+      db: 0,
+      oc: false,
     });
     setIsAddingNode(false);
   };
@@ -519,10 +536,14 @@ function Devices() {
     setEditingIndex(index);
     // Create a deep copy of the device to avoid modifying the original
     const deviceToEdit = {
+      ...devices[index],
       n: devices[index].n,
       da: parseInt(devices[index].da),
       pi: parseInt(devices[index].pi),
       g: Boolean(devices[index].g),
+      sp: devices[index].sp || CONFIG.DEFAULT_SERIAL_PORT,
+      br: parseInt(devices[index].br) || CONFIG.DEFAULT_BAUD_RATE,
+      py: devices[index].py || "N",
       ns: [...(devices[index].ns || [])],
     };
     setEditingDevice(deviceToEdit);
@@ -562,6 +583,8 @@ function Devices() {
       f: parseInt(devices[selectedDevice].ns[nodeIndex].f),
       dt: parseInt(devices[selectedDevice].ns[nodeIndex].dt),
       t: parseInt(devices[selectedDevice].ns[nodeIndex].t),
+      db: parseFloat(devices[selectedDevice].ns[nodeIndex].db) || 0,
+      oc: !!devices[selectedDevice].ns[nodeIndex].oc,
     };
     setEditingNode(nodeToEdit);
   };
@@ -580,7 +603,7 @@ function Devices() {
     }
 
     // Handle numeric inputs
-    if (["da", "pi"].includes(name)) {
+    if (["da", "pi", "br"].includes(name)) {
       const numValue = parseInt(value);
       if (value !== "") {
         if (
@@ -626,7 +649,16 @@ function Devices() {
   };
 
   const handleEditNodeInputChange = (e) => {
-    const { name, value } = e.target;
+    const { name, value, checked } = e.target;
+
+    if (name === "oc") {
+      setEditingNode((prev) => ({ ...prev, oc: checked }));
+      return;
+    }
+    if (name === "db") {
+      setEditingNode((prev) => ({ ...prev, db: Math.max(0, parseFloat(value) || 0) }));
+      return;
+    }
 
     // Add validation for name length and uniqueness
     if (name === "n") {
@@ -772,6 +804,9 @@ function Devices() {
       da: 1,
       pi: 1000,
       g: false,
+      sp: CONFIG.DEFAULT_SERIAL_PORT,
+      br: CONFIG.DEFAULT_BAUD_RATE,
+      py: "N",
     });
     setIsAddingDevice(true);
   };
@@ -809,6 +844,9 @@ function Devices() {
       da: 1,
       pi: 1000,
       g: false,
+      sp: CONFIG.DEFAULT_SERIAL_PORT,
+      br: CONFIG.DEFAULT_BAUD_RATE,
+      py: "N",
     });
   };
 
@@ -876,8 +914,7 @@ function Devices() {
         <div
           class="mb-4 p-4 bg-green-100 border border-green-400 text-green-700 rounded"
         >
-          Device configuration saved successfully! System will reboot to apply
-          changes...
+          Device configuration saved and applied.
         </div>
       `}
 
@@ -1006,6 +1043,58 @@ function Devices() {
                           required
                         />
                       </div>
+                      <div class="flex-1">
+                        <label
+                          class="block text-sm font-medium text-gray-700 mb-2"
+                        >
+                          Serial Port
+                        </label>
+                        <select
+                          name="sp"
+                          value=${newDevice.sp}
+                          onChange=${handleInputChange}
+                          class="w-full px-3 py-2 border border-gray-300 rounded-md focus:outline-none focus:ring-2 focus:ring-blue-500"
+                        >
+                          ${CONFIG.SERIAL_PORTS.map(
+                            (port) => html`<option value=${port}>${port}</option>`
+                          )}
+                        </select>
+                      </div>
+                      <div class="flex-1">
+                        <label
+                          class="block text-sm font-medium text-gray-700 mb-2"
+                        >
+                          Baud Rate
+                        </label>
+                        <select
+                          name="br"
+                          value=${newDevice.br}
+                          onChange=${handleInputChange}
+                          class="w-full px-3 py-2 border border-gray-300 rounded-md focus:outline-none focus:ring-2 focus:ring-blue-500"
+                        >
+                          ${CONFIG.BAUD_RATES.map(
+                            (rate) => html`<option value=${rate}>${rate}</option>`
+                          )}
+                        </select>
+                      </div>
+                      <div class="flex-1">
+                        <label
+                          class="block text-sm font-medium text-gray-700 mb-2"
+                        >
+                          Parity
+                        </label>
+                        <select
+                          name="py"
+                          value=${newDevice.py}
+                          onChange=${handleInputChange}
+                          class="w-full px-3 py-2 border border-gray-300 rounded-md focus:outline-none focus:ring-2 focus:ring-blue-500"
+                        >
+                          ${CONFIG.PARITIES.map(
+                            ([value, label]) =>
+                              html`<option value=${value}>${label}</option>`
+                          )}
+                        </select>
+                      </div>
                       <div class="flex-1">
                         <label
                           class="block text-sm font-medium text-gray-700 mb-2"
@@ -1061,6 +1150,7 @@ function Devices() {
                       <${Th}>Name<//>
                       <${Th}>Slave Address<//>
                       <${Th}>Polling Interval<//>
+                      <${Th}>Serial Line<//>
                       <${Th}>Merge Collection<//>
                       <${Th}>Actions<//>
                     </tr>
@@ -1123,6 +1213,47 @@ function Devices() {
                                 `
                               : `${device.pi} ms`}
                           </td>
+                          <td class="px-6 py-4 whitespace-nowrap">
+                            ${editingIndex === index
+                              ? html`
+                                  <select
+                                    name="sp"
+                                    value=${editingDevice.sp}
+                                    onChange=${handleEditInputChange}
+                                    class="w-full px-2 py-1 border border-gray-300 rounded mb-1"
+                                  >
+                                    ${CONFIG.SERIAL_PORTS.map(
+                                      (port) =>
+                                        html`<option value=${port}>${port}</option>`
+                                    )}
+                                  </select>
+                                  <select
+                                    name="br"
+                                    value=${editingDevice.br}
+                                    onChange=${handleEditInputChange}
+                                    class="w-full px-2 py-1 border border-gray-300 rounded mb-1"
+                                  >
+                                    ${CONFIG.BAUD_RATES.map(
+                                      (rate) =>
+                                        html`<option value=${rate}>${rate}</option>`
+                                    )}
+                                  </select>
+                                  <select
+                                    name="py"
+                                    value=${editingDevice.py}
+                                    onChange=${handleEditInputChange}
+                                    class="w-full px-2 py-1 border border-gray-300 rounded"
+                                  >
+                                    ${CONFIG.PARITIES.map(
+                                      ([value, label]) =>
+                                        html`<option value=${value}>${label}</option>`
+                                    )}
+                                  </select>
+                                `
+                              : `${device.sp || CONFIG.DEFAULT_SERIAL_PORT} ${
+                                  device.br || CONFIG.DEFAULT_BAUD_RATE
+                                } ${device.py || "N"}`}
+                          </td>
                           <td class="px-6 py-4 whitespace-nowrap">
                             ${editingIndex === index
                               ? html`
@@ -1333,6 +1464,37 @@ function Devices() {
                             placeholder="Timeout"
                           />
                         </div>
+                        <div>
+                          <label
+                            class="block text-sm font-medium text-gray-700 mb-2"
+                          >
+                            Deadband
+                          </label>
+                          <input
+                            type="number"
+                            name="db"
+                            value=${newNode.db}
+                            onChange=${handleNodeInputChange}
+                            min="0"
+                            step="any"
+                            class="w-full px-3 py-2 border border-gray-300 rounded-md"
+                            placeholder="Deadband"
+                          />
+                        </div>
+                        <div class="flex items-center">
+                          <label class="flex items-center space-x-2">
+                            <input
+                              type="checkbox"
+                              name="oc"
+                              checked=${newNode.oc}
+                              onChange=${handleNodeInputChange}
+                              class="h-4 w-4 text-blue-600 rounded border-gray-300 focus:ring-blue-500"
+                            />
+                            <span class="text-sm font-medium text-gray-700"
+                              >Report on change only</span
+                            >
+                          </label>
+                        </div>
                       </div>
                       <div class="flex justify-end space-x-3 mt-4">
                         <button
@@ -1365,6 +1527,7 @@ function Devices() {
                           <${Th}>Function code<//>
                           <${Th}>Data type<//>
                           <${Th}>Timeout<//>
+                          <${Th}>Publish<//>
                           <${Th}>Actions<//>
                         </tr>
                       </thead>
@@ -1465,6 +1628,35 @@ function Devices() {
                                     `
                                   : `${node.t} ms`}
                               </td>
+                              <td class="px-6 py-4 whitespace-nowrap">
+                                ${editingNodeIndex === nodeIndex
+                                  ? html`
+                                      <div class="flex items-center space-x-2">
+                                        <input
+                                          type="checkbox"
+                                          name="oc"
+                                          checked=${editingNode.oc}
+                                          onChange=${handleEditNodeInputChange}
+                                          class="h-4 w-4 text-blue-600 rounded border-gray-300 focus:ring-blue-500"
+                                        />
+                                        <input
+                                          type="number"
+                                          name="db"
+                                          value=${editingNode.db}
+                                          onChange=${handleEditNodeInputChange}
+                                          min="0"
+                                          step="any"
+                                          disabled=${!editingNode.oc}
+                                          class="w-20 px-2 py-1 border border-gray-300 rounded"
+                                        />
+                                      </div>
+                                    `
+                                  : node.oc
+                                  ? node.db > 0
+                                    ? `On change (±${node.db})`
+                                    : "On change"
+                                  : "Every poll"}
+                              </td>
                               <td class="px-6 py-4 whitespace-nowrap">
                                 ${editingNodeIndex === nodeIndex
                                   ? html`
@@ -2,6 +2,48 @@
 import { h, html, useState, useEffect, useMemo } from "../../bundle.js";
 import { Icons, Button, Card } from "../Components.js";
 
+// Opt-in binary telemetry subprotocol, see rtu_master.h for the frame layout
+const WS_BINARY_PROTOCOL = "modbus.bin.v1";
+const UPDATE_FRAME_VALUES = 1;
+
+// Data type -> [width in bytes, DataView reader], little endian
+const VALUE_READERS = {
+  1: [1, (dv, o) => dv.getUint8(o) !== 0],
+  2: [1, (dv, o) => dv.getInt8(o)],
+  3: [1, (dv, o) => dv.getUint8(o)],
+  4: [2, (dv, o) => dv.getInt16(o, true)],
+  5: [2, (dv, o) => dv.getUint16(o, true)],
+  6: [4, (dv, o) => dv.getInt32(o, true)],
+  7: [4, (dv, o) => dv.getInt32(o, true)],
+  8: [4, (dv, o) => dv.getUint32(o, true)],
+  9: [4, (dv, o) => dv.getUint32(o, true)],
+  10: [4, (dv, o) => dv.getFloat32(o, true)],
+  11: [4, (dv, o) => dv.getFloat32(o, true)],
+  12: [8, (dv, o) => dv.getFloat64(o, true)],
+};
+
+// Decode a binary values frame into a Map of node name -> value
+function decodeValuesFrame(buffer, schema) {
+  const dv = new DataView(buffer);
+  const values = new Map();
+  if (dv.byteLength < 3 || dv.getUint8(0) !== UPDATE_FRAME_VALUES) {
+    return values;
+  }
+  const count = dv.getUint16(1, true);
+  let offset = 3;
+  for (let i = 0; i < count && offset + 2 <= dv.byteLength; i++) {
+    const node = schema.get(dv.getUint16(offset, true));
+    offset += 2;
+    // Without the node type the rest of the frame cannot be parsed
+    if (!node || !VALUE_READERS[node.t]) break;
+    const [width, read] = VALUE_READERS[node.t];
+    if (offset + width > dv.byteLength) break;
+    values.set(node.n, read(dv, offset));
+    offset += width;
+  }
+  return values;
+}
+
 function Home() {
   const [displayCards, setDisplayCards] = useState([]);
   const [devices, setDevices] = useState([]);
@@ -25,6 +67,8 @@ function Home() {
   // Add WebSocket ref to persist across renders
   const wsRef = { current: null };
   const reconnectTimeoutRef = { current: null };
+  // Node id -> {n, t} announced by the server for binary frames
+  const schemaRef = { current: new Map() };
 
   // WebSocket connection setup
   const connectWebSocket = () => {
@@ -36,7 +80,8 @@ function Home() {
       const wsProtocol = window.location.protocol === "https:" ? "wss:" : "ws:";
       const wsUrl = `${wsProtocol}//${window.location.hostname}:${currentPort}/websocket`;
 
-      wsRef.current = new WebSocket(wsUrl);
+      wsRef.current = new WebSocket(wsUrl, [WS_BINARY_PROTOCOL]);
+      wsRef.current.binaryType = "arraybuffer";
 
       wsRef.current.onopen = () => {
         console.log("WebSocket connected");
@@ -45,27 +90,44 @@ function Home() {
 
       wsRef.current.onmessage = (event) => {
         try {
-          const data = JSON.parse(event.data);
-          if (data.type === "update") {
+          let values = null;
+          if (event.data instanceof ArrayBuffer) {
+            values = decodeValuesFrame(event.data, schemaRef.current);
+          } else {
+            const data = JSON.parse(event.data);
+            if (data.type === "schema" && Array.isArray(data.nodes)) {
+              schemaRef.current = new Map(
+                data.nodes.map((node) => [node.id, { n: node.n, t: node.t }])
+              );
+            // "snapshot" on connect, then one "updates" frame per device scan,
+            // "update" carries a single value
+            } else if ((data.type === "snapshot" || data.type === "updates") &&
+                       Array.isArray(data.vs)) {
+              values = new Map(data.vs.map((item) => [item.n, item.v]));
+            } else if (data.type === "update") {
+              values = new Map([[data.n, data.v]]);
+            }
+          }
+          if (values && values.size > 0) {
             setDisplayCards((prevCards) =>
               prevCards.map((card) => {
                 const updatedCard = { ...card };
                 let valueUpdated = false;
 
                 // Check temperature node
-                if (card.tn && card.tn.n === data.n) {
+                if (card.tn && values.has(card.tn.n)) {
                   updatedCard.tn = {
                     ...card.tn,
-                    v: data.v,
+                    v: values.get(card.tn.n),
                   };
                   valueUpdated = true;
                 }
 
                 // Check humidity node
-                if (card.hn && card.hn.n === data.n) {
+                if (card.hn && values.has(card.hn.n)) {
                   updatedCard.hn = {
                     ...card.hn,
-                    v: data.v,
+                    v: values.get(card.hn.n),
                   };
                   valueUpdated = true;
                 }
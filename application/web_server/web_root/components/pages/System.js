@@ -67,6 +67,19 @@ const LOG_METHOD_OPTIONS = [
   [2, "SYSTEM"],
 ];
 
+// Log tags that can be given their own level at runtime
+// Log tags offered until /api/logtags/get lists the ones compiled in
+const DEFAULT_LOG_TAGS = ["MAIN", "RTU_MASTER", "SERIAL", "SCHEDULER", "WEB", "WEBSOCKET", "DB", "SYSTEM"];
+
+// Per-tag level options, "" keeps the compiled-in default
+const LOG_LEVEL_OPTIONS = [
+  ["", "Default"],
+  [0, "ERROR"],
+  [1, "WARN"],
+  [2, "INFO"],
+  [3, "DEBUG"],
+];
+
 function System() {
   // State management
   const [activeTab, setActiveTab] = useState("user");
@@ -77,6 +90,7 @@ function System() {
 
   // System configuration state
   const [systemConfig, setSystemConfig] = useState({});
+  const [logTags, setLogTags] = useState(DEFAULT_LOG_TAGS);
 
   const tabs = [
     { id: "user", label: "User Config" },
@@ -127,6 +141,7 @@ function System() {
         wport: data.wport,
         time: data.time ? new Date(data.time) : null,
         logMethod: data.logMethod,
+        logLevels: data.logLevels || {},
       });
     } catch (error) {
       console.error("Error fetching system configuration:", error);
@@ -264,6 +279,7 @@ function System() {
         hport: systemConfig.hport,
         wport: systemConfig.wport,
         logMethod: systemConfig.logMethod,
+        logLevels: systemConfig.logLevels || {},
       };
 
       console.log("Saving configuration:", updatedConfig);
@@ -371,6 +387,8 @@ function System() {
       case "logMethod":
         // Log method validation is handled in handleSaveConfig
         break;
+      case "logLevels":
+        break;
       case "wport":
         error = validatePort(value);
         break;
@@ -396,8 +414,23 @@ function System() {
   useEffect(() => {
     document.title = "SBIOT-System";
     fetchSystemConfig();
+    fetchLogTags();
   }, []);
 
+  // Tags the server registered, the defaults stay if the request fails
+  const fetchLogTags = async () => {
+    try {
+      const response = await fetch("/api/logtags/get");
+      if (!response.ok) return;
+      const data = await response.json();
+      if (Array.isArray(data.tags) && data.tags.length > 0) {
+        setLogTags(data.tags);
+      }
+    } catch (error) {
+      console.error("Error fetching log tags:", error);
+    }
+  };
+
   // Format time for display
   const formatTime = (date) => {
     if (!date) return "N/A";
@@ -741,6 +774,48 @@ function System() {
               </div>
             </div>
 
+            <div class="mt-4">
+              <label class="block text-sm font-medium text-gray-700 mb-1"
+                >Log Levels</label
+              >
+              <div class="mt-2 grid grid-cols-2 gap-2">
+                ${[
+                  ...new Set([
+                    ...logTags,
+                    ...Object.keys(systemConfig.logLevels || {}),
+                  ]),
+                ].map(
+                  (tag) => html`
+                    <div class="flex items-center space-x-2">
+                      <span class="w-32 text-sm text-gray-700">${tag}</span>
+                      <select
+                        value=${systemConfig.logLevels?.[tag] ?? ""}
+                        onChange=${(e) => {
+                          const levels = { ...(systemConfig.logLevels || {}) };
+                          if (e.target.value === "") {
+                            delete levels[tag];
+                          } else {
+                            levels[tag] = parseInt(e.target.value);
+                          }
+                          handleConfigChange("logLevels", levels);
+                        }}
+                        class="flex-1 px-3 py-2 border border-gray-300 rounded-md focus:outline-none focus:ring-2 focus:ring-blue-500"
+                      >
+                        ${LOG_LEVEL_OPTIONS.map(
+                          ([value, label]) =>
+                            html`<option value=${value}>${label}</option>`
+                        )}
+                      </select>
+                    </div>
+                  `
+                )}
+              </div>
+              <p class="mt-1 text-sm text-gray-500">
+                Verbosity per module. Log levels are applied as soon as the
+                settings are saved.
+              </p>
+            </div>
+
             <div class="bg-yellow-50 border-l-4 border-yellow-400 p-4 mt-4">
               <div class="flex">
                 <div class="flex-shrink-0">
@@ -1,49 +1,28 @@
 #include "websocket.h"
 #include "mongoose.h"
-#include <pthread.h>
+#include "ws_client.h"
 #include <string.h>
-#include <unistd.h>
-#include "db.h"
-#include "cJSON.h"
+#include <stdatomic.h>
+#include "config.h"
 
 #define DBG_TAG "WEBSOCKET"
 #define DBG_LVL LOG_INFO
 #include "dbg.h"
 
-#define DEFAULT_WS_PORT 4002
 #define DEFAULT_WS_HOST "ws://0.0.0.0"
 
 static char s_listen_on[64];  // Buffer for complete websocket URL
-static struct mg_connection *ws_conn = NULL;
 
-// Get websocket port from database
-static int get_websocket_port(void) {
-    char json_str[1024] = {0};
-    int port = DEFAULT_WS_PORT;  // Default port
-    
-    // Read JSON string from database
-    int read_len = db_read("system_config", json_str, sizeof(json_str));
-    if (read_len <= 0) {
-        DBG_ERROR("Failed to read system config from database");
-        return port;  // Return default port
-    }
-
-    cJSON *root = cJSON_Parse(json_str);
-    if (!root) {
-        DBG_ERROR("Failed to parse system config JSON");
-        return port;  // Return default port
-    }
+// Manager shared with the HTTP server, and the id of our listener as the
+// wakeup target. 0 while not listening.
+static struct mg_mgr *s_mgr = NULL;
+static atomic_ulong s_listener_id;
 
-    // Get wport value
-    cJSON *port_obj = cJSON_GetObjectItem(root, "wport");
-    if (port_obj && cJSON_IsNumber(port_obj)) {
-        port = port_obj->valueint;
-        DBG_INFO("Websocket port loaded: %d", port);
-    } else {
-        DBG_WARN("Websocket port not found in config, using default: %d", port);
-    }
-
-    cJSON_Delete(root);
+// Get websocket port from the system config
+static int get_websocket_port(void) {
+    const config_t *cfg = config_acquire();
+    int port = cfg ? cfg->ws_port : CONFIG_DEFAULT_WS_PORT;
+    config_release();
     return port;
 }
 
@@ -54,79 +33,55 @@ static void init_websocket_url(void) {
     DBG_INFO("Websocket URL set to: %s", s_listen_on);
 }
 
-// Handle websocket connection
+// Handle websocket connection. Log clients are marked 'L' so broadcasts
+// never reach the telemetry clients sharing the manager.
 static void fn(struct mg_connection *c, int ev, void *ev_data) {
-    if(ev == MG_EV_OPEN && c->is_listening) {
-        DBG_INFO("Websocket connection opened");
-        ws_conn = c;
-    } else if(ev == MG_EV_HTTP_MSG) {
+    if(ev == MG_EV_HTTP_MSG) {
         DBG_INFO("Websocket HTTP message received");
         struct mg_http_message *hm = (struct mg_http_message *) ev_data;
         mg_ws_upgrade(c, hm, NULL);
-        // c->data[0] = 'W';
     } else if(ev == MG_EV_WS_OPEN) {
-        c->data[0] = 'W';
+        ws_client_init(c, 'L');
     } else if(ev == MG_EV_WS_MSG) {  
         struct mg_ws_message *wm = (struct mg_ws_message *) ev_data;
         DBG_INFO("Websocket message received: %.*s", (int)wm->data.len, wm->data.buf);
     } else if(ev == MG_EV_CLOSE) {
         if(c->is_listening) {
             DBG_INFO("Websocket connection closed");
-            ws_conn = NULL;
+            atomic_store(&s_listener_id, 0);
         }
     } else if (ev == MG_EV_WAKEUP) {
         struct mg_str *data = (struct mg_str *) ev_data;
-        // Broadcast message to all connected websocket clients
+        // Broadcast message to all connected websocket log clients, lines
+        // are dropped for a client that falls behind
         for (struct mg_connection *wc = c->mgr->conns; wc != NULL; wc = wc->next) {
-            if (wc->data[0] == 'W') {
-                mg_ws_send(wc, data->buf, data->len, WEBSOCKET_OP_TEXT);
+            if (wc->data[0] == 'L') {
+                ws_client_send(wc, data->buf, data->len, WEBSOCKET_OP_TEXT);
             }
         }
     }
 }
 
 void websocket_log_send(const char *message) {
-    if(!ws_conn || !message) {
-        DBG_ERROR("Websocket connection not opened");
+    // Called from the log thread: logging here would feed back into it
+    unsigned long id = atomic_load(&s_listener_id);
+    if(!id || !message) {
         return;
     }
-    mg_wakeup(ws_conn->mgr, ws_conn->id, message, strlen(message));
+    mg_wakeup(s_mgr, id, message, strlen(message));
 }
 
-static void *websocket_log_thread(void *arg) {
-    struct mg_mgr mgr;
-    
+// Add the websocket log listener to the web server's manager
+void websocket_log_listen(struct mg_mgr *mgr) {
     // Initialize websocket URL with port from config
     init_websocket_url();
-    
-    mg_mgr_init(&mgr);
-    mg_http_listen(&mgr, s_listen_on, fn, NULL);
-    mg_wakeup_init(&mgr);
-    DBG_INFO("Websocket log server starting on %s", s_listen_on);
-    
-    while(1) {
-        mg_mgr_poll(&mgr, 500);
-        usleep(20 * 1000);
-    }
-    mg_mgr_free(&mgr);
-    return NULL;
-}
 
-void websocket_log_start() {
-    pthread_t thread;
-    pthread_attr_t attr;
-    
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
-    int ret = pthread_create(&thread, &attr, websocket_log_thread, NULL);
-    if (ret != 0) {
-        DBG_ERROR("Failed to create websocket log thread: %s", strerror(ret));
+    struct mg_connection *c = mg_http_listen(mgr, s_listen_on, fn, NULL);
+    if (!c) {
+        DBG_ERROR("Failed to listen on %s", s_listen_on);
+        return;
     }
-    pthread_attr_destroy(&attr);
+    s_mgr = mgr;
+    atomic_store(&s_listener_id, c->id);
+    DBG_INFO("Websocket log server listening on %s", s_listen_on);
 }
-
-
-
-
-
-
@@ -4,7 +4,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-void websocket_log_start();
+struct mg_mgr;
+
+void websocket_log_listen(struct mg_mgr *mgr);
 void websocket_log_send(const char *message);
 
 #endif // WEBSOCKET_H
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "ws_client.h"
+#include <string.h>
+
+#define DBG_TAG "WS_CLIENT"
+#define DBG_LVL LOG_INFO
+#include "dbg.h"
+
+_Static_assert(sizeof(ws_client_t) <= sizeof(((struct mg_connection *)0)->data),
+               "ws_client_t must fit mg_connection data");
+
+// Only touched on the web thread
+static ws_client_stats_t s_stats;
+
+void ws_client_init(struct mg_connection *c, char kind) {
+    ws_client_t *client = (ws_client_t *)c->data;
+
+    memset(client, 0, sizeof(*client));
+    client->kind = kind;
+}
+
+ws_send_result_t ws_client_settle(struct mg_connection *c) {
+    ws_client_t *client = (ws_client_t *)c->data;
+
+    if (c->is_closing) {
+        return WS_SEND_DROPPED;
+    }
+    if (!client->behind) {
+        return WS_SEND_OK;
+    }
+    if (c->send.len <= WS_SEND_LOW_WATERMARK) {
+        client->behind = false;
+        s_stats.recovered++;
+        DBG_INFO("Websocket client %lu caught up", c->id);
+        return WS_SEND_RECOVERED;
+    }
+    if (mg_millis() - client->behind_since_ms >= WS_SLOW_CLIENT_TIMEOUT_MS) {
+        c->is_closing = 1;
+        s_stats.evicted++;
+        DBG_WARN("Websocket client %lu evicted, %lu bytes still queued",
+                 c->id, (unsigned long)c->send.len);
+        return WS_SEND_EVICTED;
+    }
+    return WS_SEND_DROPPED;
+}
+
+ws_send_result_t ws_client_send(struct mg_connection *c, const void *buf, size_t len, int op) {
+    ws_client_t *client = (ws_client_t *)c->data;
+
+    if (c->is_closing) {
+        return WS_SEND_DROPPED;
+    }
+
+    ws_send_result_t result = ws_client_settle(c);
+    if (result == WS_SEND_EVICTED) {
+        return result;
+    }
+    if (result == WS_SEND_DROPPED) {
+        s_stats.dropped++;
+        s_stats.dropped_bytes += len;
+        return result;
+    }
+
+    if (c->send.len + len > WS_SEND_HIGH_WATERMARK) {
+        client->behind = true;
+        client->behind_since_ms = mg_millis();
+        s_stats.dropped++;
+        s_stats.dropped_bytes += len;
+        DBG_WARN("Websocket client %lu falling behind, %lu bytes queued",
+                 c->id, (unsigned long)c->send.len);
+        return WS_SEND_DROPPED;
+    }
+
+    mg_ws_send(c, buf, len, op);
+    return result;
+}
+
+ws_send_result_t ws_client_send_resync(struct mg_connection *c, const void *buf, size_t len, int op) {
+    ws_client_t *client = (ws_client_t *)c->data;
+
+    if (c->is_closing) {
+        return WS_SEND_DROPPED;
+    }
+
+    if (c->send.len > WS_SEND_LOW_WATERMARK) {
+        if (!client->behind) {
+            client->behind = true;
+            client->behind_since_ms = mg_millis();
+        }
+        s_stats.dropped++;
+        s_stats.dropped_bytes += len;
+        return WS_SEND_DROPPED;
+    }
+
+    mg_ws_send(c, buf, len, op);
+    return WS_SEND_OK;
+}
+
+void ws_client_check(struct mg_mgr *mgr, void (*resync)(struct mg_connection *c)) {
+    for (struct mg_connection *c = mgr->conns; c != NULL; c = c->next) {
+        if (!c->is_websocket || c->is_listening) {
+            continue;
+        }
+        if (ws_client_settle(c) == WS_SEND_RECOVERED && resync) {
+            resync(c);
+        }
+    }
+}
+
+void ws_client_get_stats(struct mg_mgr *mgr, ws_client_stats_t *stats) {
+    *stats = s_stats;
+    stats->clients = 0;
+    stats->behind = 0;
+    stats->queued_bytes = 0;
+
+    for (struct mg_connection *c = mgr->conns; c != NULL; c = c->next) {
+        if (!c->is_websocket || c->is_listening) {
+            continue;
+        }
+        ws_client_t *client = (ws_client_t *)c->data;
+        stats->clients++;
+        stats->queued_bytes += c->send.len;
+        if (client->behind) {
+            stats->behind++;
+        }
+    }
+}
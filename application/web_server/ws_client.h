@@ -0,0 +1,63 @@
+#ifndef WS_CLIENT_H
+#define WS_CLIENT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mongoose.h"
+
+// Per-connection send queue limits. A client whose queue passes the high
+// watermark stops receiving messages until it drains below the low
+// watermark, and is disconnected if it is still behind after the timeout.
+#define WS_SEND_HIGH_WATERMARK (64 * 1024)
+#define WS_SEND_LOW_WATERMARK (16 * 1024)
+#define WS_SLOW_CLIENT_TIMEOUT_MS 10000
+
+// Kept in c->data of every websocket connection. kind must stay first,
+// it is the 'W', 'B' or 'L' marker the broadcast loops match on.
+typedef struct {
+    char kind;
+    bool behind;                // Messages are being dropped for this client
+    uint64_t behind_since_ms;
+} ws_client_t;
+
+typedef enum {
+    WS_SEND_OK,
+    WS_SEND_RECOVERED,          // Sent, but earlier messages were dropped
+    WS_SEND_DROPPED,
+    WS_SEND_EVICTED,
+} ws_send_result_t;
+
+typedef struct {
+    uint32_t clients;
+    uint32_t behind;
+    uint64_t queued_bytes;      // Sum of the websocket send queues right now
+    uint64_t dropped;           // Messages not sent to a slow client
+    uint64_t dropped_bytes;
+    uint64_t evicted;
+    uint64_t recovered;
+} ws_client_stats_t;
+
+void ws_client_init(struct mg_connection *c, char kind);
+ws_send_result_t ws_client_send(struct mg_connection *c, const void *buf, size_t len, int op);
+
+// Send a message that replaces everything dropped before it, such as a
+// full snapshot. It only goes out while the queue is below the low
+// watermark, where it may take the queue past the high one; otherwise the
+// client is marked behind and gets the next one once it caught up.
+ws_send_result_t ws_client_send_resync(struct mg_connection *c, const void *buf, size_t len, int op);
+
+// Settle a client that is behind: RECOVERED once its queue drained below
+// the low watermark, EVICTED once it stayed behind for too long, DROPPED
+// while it is still behind and OK if it was not. A broadcast settles the
+// client first when what it resyncs with must go out before the message.
+ws_send_result_t ws_client_settle(struct mg_connection *c);
+
+// Settle the clients that are behind without waiting for the next
+// message, which may be long in coming: evict those past the timeout and
+// call resync for those that caught up. Run periodically on the web thread.
+void ws_client_check(struct mg_mgr *mgr, void (*resync)(struct mg_connection *c));
+
+// Must be called on the web thread
+void ws_client_get_stats(struct mg_mgr *mgr, ws_client_stats_t *stats);
+
+#endif // WS_CLIENT_H